@@ -38,6 +38,7 @@
 #define GAFFER_CONTEXT_INL
 
 #include "IECore/SimpleTypedData.h"
+#include "IECore/VectorTypedData.h"
 
 #include "boost/format.hpp"
 
@@ -253,6 +254,22 @@ void Context::Storage::updateHash( const IECore::InternedString &name )
 	{
 		hash = IECore::MurmurHash( 0, 0 );
 	}
+	else if( data->typeId() == IECore::InternedStringVectorDataTypeId )
+	{
+		// Fast path for the `scene:path` variable, which GafferScene sets for
+		// every location it visits. InternedStrings are unique, so we can hash
+		// their addresses rather than their contents, just as we do for the
+		// entry name. This is much cheaper than `Object::hash()` for deep paths.
+		const std::vector<IECore::InternedString> &v = static_cast<const IECore::InternedStringVectorData *>( data )->readable();
+		hash = IECore::MurmurHash();
+		hash.append( (uint64_t)IECore::InternedStringVectorDataTypeId );
+		hash.append( (uint64_t)v.size() );
+		for( const auto &x : v )
+		{
+			hash.append( (uint64_t)&x.string() );
+		}
+		hash.append( (uint64_t)&nameStr );
+	}
 	else
 	{
 		hash = data->Object::hash();
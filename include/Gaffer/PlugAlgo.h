@@ -63,6 +63,13 @@ GAFFER_API ValuePlugPtr createPlugFromData( const std::string &name, Plug::Direc
 /// Extracts a Data value from a plug previously created with createPlugFromData().
 GAFFER_API IECore::DataPtr extractDataFromPlug( const ValuePlug *plug );
 
+/// Sets the value of a plug from Data of the type returned by `extractDataFromPlug()`.
+/// Returns false if the plug type is unsupported or the type of the data doesn't
+/// match. Spline plugs and TransformPlugs are not supported.
+/// > Note : Vector data may be referenced directly by the plug, so must not
+/// > be modified after the call.
+GAFFER_API bool setValueFromData( ValuePlug *plug, const IECore::Data *value );
+
 /// Promotion
 /// =========
 ///
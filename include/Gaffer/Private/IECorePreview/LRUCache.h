@@ -104,8 +104,33 @@ class LRUCache : private boost::noncopyable
 		typedef boost::function<Value ( const GetterKey &key, Cost &cost )> GetterFunction;
 		/// The optional RemovalCallback is called whenever an item is discarded from the cache.
 		typedef boost::function<void ( const Key &key, const Value &data )> RemovalCallback;
+		/// Function returning a cost associated with resources referenced
+		/// by an item. See SharedCostFunctions.
+		typedef boost::function<Cost ( const Key &key, const Value &data )> SharedCostFunction;
+		/// The optional SharedCostFunctions allow resources shared between several
+		/// items to be charged to the cache only once. These costs are included in
+		/// `currentCost()` in addition to the per-item costs returned by the
+		/// GetterFunction. All functions must be threadsafe unless the Serial
+		/// policy is used.
+		struct SharedCostFunctions
+		{
+			/// Must return the total cost of the resources referenced by an
+			/// item, regardless of whether or not they are shared. Items whose
+			/// cost plus shared cost exceeds `getMaxCost()` are not cached.
+			SharedCostFunction cost;
+			/// Called when an item is added to the cache, and must return the
+			/// cost of any resources it references that were not already referenced
+			/// by another item.
+			SharedCostFunction acquire;
+			/// Called when an item is removed from the cache, and must return the
+			/// cost of any resources that are no longer referenced by any item.
+			SharedCostFunction release;
+		};
 
-		LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback = RemovalCallback(), bool cacheErrors = true );
+		LRUCache(
+			GetterFunction getter, Cost maxCost, RemovalCallback removalCallback = RemovalCallback(), bool cacheErrors = true,
+			const SharedCostFunctions &sharedCostFunctions = SharedCostFunctions()
+		);
 		virtual ~LRUCache();
 
 		/// Retrieves an item from the cache, computing it if necessary.
@@ -161,6 +186,8 @@ class LRUCache : private boost::noncopyable
 		// A function for computing values, and one for notifying of removals.
 		GetterFunction m_getter;
 		RemovalCallback m_removalCallback;
+		// Functions for accounting for resources shared between items.
+		SharedCostFunctions m_sharedCostFunctions;
 
 		// Status of each item in the cache.
 		enum Status
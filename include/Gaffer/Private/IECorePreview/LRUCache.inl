@@ -1027,8 +1027,8 @@ typename LRUCache<Key, Value, Policy, GetterKey>::Status LRUCache<Key, Value, Po
 // =======================================================================
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-LRUCache<Key, Value, Policy, GetterKey>::LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback, bool cacheErrors )
-	:	m_getter( getter ), m_removalCallback( removalCallback ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors )
+LRUCache<Key, Value, Policy, GetterKey>::LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback, bool cacheErrors, const SharedCostFunctions &sharedCostFunctions )
+	:	m_getter( getter ), m_removalCallback( removalCallback ), m_sharedCostFunctions( sharedCostFunctions ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors )
 {
 }
 
@@ -1179,10 +1179,21 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, Cache
 		return false;
 	}
 
+	if( m_sharedCostFunctions.cost && cost + m_sharedCostFunctions.cost( key, value ) > m_maxCost )
+	{
+		// The shared resources alone may exceed the limit, in which case
+		// admitting the item would just evict everything, including itself.
+		return false;
+	}
+
 	cacheEntry.state = value;
 	cacheEntry.cost = cost;
 
 	m_policy.currentCost += cost;
+	if( m_sharedCostFunctions.acquire )
+	{
+		m_policy.currentCost += m_sharedCostFunctions.acquire( key, value );
+	}
 
 	return true;
 }
@@ -1225,6 +1236,10 @@ bool LRUCache<Key, Value, Policy, GetterKey>::eraseInternal( const Key &key, Cac
 			m_removalCallback( key, boost::get<Value>( cacheEntry.state ) );
 		}
 		m_policy.currentCost -= cacheEntry.cost;
+		if( m_sharedCostFunctions.release )
+		{
+			m_policy.currentCost -= m_sharedCostFunctions.release( key, boost::get<Value>( cacheEntry.state ) );
+		}
 	}
 
 	cacheEntry.state = boost::blank();
@@ -46,6 +46,8 @@
 #include "Gaffer/TypedPlug.h"
 #include "Gaffer/UndoScope.h"
 
+#include "IECore/CompoundObject.h"
+
 #include "boost/container/flat_set.hpp"
 
 #include <functional>
@@ -180,6 +182,9 @@ class GAFFER_API ScriptNode : public Node
 		/// serialised nodes to those contained in the set.
 		std::string serialise( const Node *parent = nullptr, const Set *filter = nullptr ) const;
 		/// Calls serialise() and saves the result into the specified file.
+		/// If the file has a ".gfrb" extension, then a binary serialisation is
+		/// saved instead. This records plug values and connections as data,
+		/// so that they can be loaded without the overhead of executing Python.
 		void serialiseToFile( const std::string &fileName, const Node *parent = nullptr, const Set *filter = nullptr ) const;
 		/// Executes a previously generated serialisation. If continueOnError is true, then
 		/// errors are reported via IECore::MessageHandler rather than as exceptions, and
@@ -188,7 +193,8 @@ class GAFFER_API ScriptNode : public Node
 		/// may have been renamed. A true return value indicates that one or more errors
 		/// were ignored.
 		bool execute( const std::string &serialisation, Node *parent = nullptr, bool continueOnError = false );
-		/// As above, but loads the serialisation from the specified file.
+		/// As above, but loads the serialisation from the specified file,
+		/// which may be binary.
 		bool executeFile( const std::string &fileName, Node *parent = nullptr, bool continueOnError = false );
 		/// Returns true if a script is currently being executed. Note that
 		/// `execute()`, `executeFile()`, `load()`, `importFile()` and `paste()` are all
@@ -311,11 +317,13 @@ class GAFFER_API ScriptNode : public Node
 		// Serialisation and execution
 		// ===========================
 
-		std::string serialiseInternal( const Node *parent, const Set *filter ) const;
-		bool executeInternal( const std::string &serialisation, Node *parent, bool continueOnError, const std::string &context = "" );
+		// If `binaryData` is non-null, a binary serialisation is made, and the
+		// accompanying data is returned via it.
+		std::string serialiseInternal( const Node *parent, const Set *filter, IECore::CompoundObjectPtr *binaryData = nullptr ) const;
+		bool executeInternal( const std::string &serialisation, const IECore::CompoundObject *binaryData, Node *parent, bool continueOnError, const std::string &context = "" );
 
-		typedef std::function<std::string ( const Node *, const Set * )> SerialiseFunction;
-		typedef std::function<bool ( ScriptNode *, const std::string &, Node *, bool, const std::string &context )> ExecuteFunction;
+		typedef std::function<std::string ( const Node *, const Set *, IECore::CompoundObjectPtr * )> SerialiseFunction;
+		typedef std::function<bool ( ScriptNode *, const std::string &, const IECore::CompoundObject *, Node *, bool, const std::string &context )> ExecuteFunction;
 
 		// Actual implementations reside in libGafferBindings (due to Python
 		// dependency), and are injected into these functions.
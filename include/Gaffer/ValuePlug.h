@@ -40,8 +40,11 @@
 
 #include "Gaffer/Plug.h"
 
+#include "IECore/Data.h"
 #include "IECore/Object.h"
 
+#include <functional>
+
 namespace Gaffer
 {
 
@@ -167,10 +170,35 @@ class GAFFER_API ValuePlug : public Plug
 		static size_t getCacheMemoryLimit();
 		/// Sets the maximum amount of memory the cache may use in bytes.
 		static void setCacheMemoryLimit( size_t bytes );
-		/// Returns the current memory usage of the cache in bytes.
+		/// Returns the current memory usage of the cache in bytes. Large
+		/// data buffers shared between several cached values (via
+		/// IECore's copy-on-write mechanism) are counted only once, so
+		/// this reflects the physical memory actually held by the cache.
+		/// It is this value that is compared against the memory limit.
 		static size_t cacheMemoryUsage();
-		/// Clears the cache.
+		/// Returns the sum of `memoryUsage()` for all values in the cache,
+		/// counting shared data buffers once for each value referencing
+		/// them. Comparing this with `cacheMemoryUsage()` gives an
+		/// indication of how much memory is saved by sharing.
+		static size_t cacheLogicalMemoryUsage();
+		/// Clears the cache, and calls all functions registered with
+		/// `registerCacheClearer()`.
 		static void clearCache();
+		/// Registers a function to be called by `clearCache()`. This
+		/// allows other caches holding data derived from computed values
+		/// to be cleared at the same time. Registration is not threadsafe,
+		/// and should be performed at startup.
+		using CacheClearer = std::function<void ()>;
+		static void registerCacheClearer( CacheClearer clearer );
+		/// Shared data buffers are found automatically for Data,
+		/// CompoundData and CompoundObject values. Other object types
+		/// may register a function to call `dataFunctor` for each
+		/// Data they hold, so that it can be considered for sharing.
+		/// Enumerators are called for the object's type and all its
+		/// base types. Registration is not threadsafe, and should be
+		/// performed at startup.
+		using CacheDataEnumerator = std::function<void ( const IECore::Object *object, const std::function<void ( const IECore::Data * )> &dataFunctor )>;
+		static void registerCacheDataEnumerator( IECore::TypeId objectType, CacheDataEnumerator enumerator );
 		//@}
 
 		/// @name Hash cache management
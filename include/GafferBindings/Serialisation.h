@@ -44,7 +44,18 @@
 #include "Gaffer/Set.h"
 
 #include "IECore/Canceller.h"
+#include "IECore/CompoundObject.h"
 #include "IECore/Object.h"
+#include "IECore/ObjectVector.h"
+#include "IECore/VectorTypedData.h"
+
+namespace Gaffer
+{
+
+IE_CORE_FORWARDDECLARE( Plug )
+IE_CORE_FORWARDDECLARE( ValuePlug )
+
+} // namespace Gaffer
 
 namespace GafferBindings
 {
@@ -55,8 +66,10 @@ class GAFFERBINDINGS_API Serialisation : boost::noncopyable
 	public :
 
 		/// Supports cancellation via the usual mechanism of scoping a Context
-		/// containing an `IECore::Canceller`.
-		Serialisation( const Gaffer::GraphComponent *parent, const std::string &parentName = "parent", const Gaffer::Set *filter = nullptr );
+		/// containing an `IECore::Canceller`. If `binary` is true, then simple
+		/// plug values and connections are recorded as data rather than as
+		/// Python code - see `binaryData()`.
+		Serialisation( const Gaffer::GraphComponent *parent, const std::string &parentName = "parent", const Gaffer::Set *filter = nullptr, bool binary = false );
 
 		/// Returns the parent passed to the constructor.
 		const Gaffer::GraphComponent *parent() const;
@@ -80,6 +93,29 @@ class GAFFERBINDINGS_API Serialisation : boost::noncopyable
 		/// Returns the result of the serialisation.
 		std::string result() const;
 
+		/// Binary serialisation
+		/// ====================
+		///
+		/// Executing Python to set plug values and make connections accounts
+		/// for the majority of the time taken to load large scripts. Binary
+		/// serialisations record these as data instead, so that they can be
+		/// applied natively. Node construction, metadata and anything else
+		/// requiring custom serialisation remains as Python code in `result()`.
+		///
+		/// Records the value of `plug` in the binary data, returning
+		/// false if the serialisation is not binary or the plug type is not
+		/// supported. In this case, the value must be serialised as Python
+		/// instead.
+		bool addValue( const Gaffer::ValuePlug *plug );
+		/// As for `addValue()`, but records the connection from
+		/// `plug->getInput()`.
+		bool addInput( const Gaffer::Plug *plug );
+		/// Returns the data recorded by `addValue()` and `addInput()`, or null
+		/// if the serialisation is not binary. The Python code returned by
+		/// `result()` applies the data via `ScriptNode._applyBinaryData()`, and
+		/// must be executed with it available as the `__binaryData` variable.
+		IECore::CompoundObjectPtr binaryData() const;
+
 		/// Convenience function to return the name of the module where object is defined.
 		static std::string modulePath( const IECore::RefCounted *object );
 		/// As above, but returns the empty string for built in python types.
@@ -165,6 +201,11 @@ class GAFFERBINDINGS_API Serialisation : boost::noncopyable
 		const Gaffer::Set *m_filter;
 		const bool m_protectParentNamespace;
 
+		IECore::StringVectorDataPtr m_binaryValuePaths;
+		IECore::ObjectVectorPtr m_binaryValues;
+		IECore::StringVectorDataPtr m_binaryInputPaths;
+		IECore::StringVectorDataPtr m_binaryInputSourcePaths;
+
 		std::string m_hierarchyScript;
 		std::string m_connectionScript;
 		std::string m_postScript;
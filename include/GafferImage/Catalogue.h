@@ -92,6 +92,13 @@ class GAFFERIMAGE_API Catalogue : public ImageNode
 				static Ptr load( const std::string &fileName );
 				void save( const std::string &fileName ) const;
 
+				/// Returns the number of bytes used to hold rendered
+				/// image data in memory. Completed renders are held in
+				/// a compressed form until they have been saved, after
+				/// which they are loaded from disk on demand, and
+				/// memory usage falls to zero.
+				size_t memoryUsage() const;
+
 				Gaffer::PlugPtr createCounterpart( const std::string &name, Direction direction ) const override;
 
 			private :
@@ -126,6 +133,8 @@ class GAFFERIMAGE_API Catalogue : public ImageNode
 		/// to receive rendered images. To send an image to the catalogues,
 		/// use an IECoreImage::ClientDisplayDriver with the "displayPort" parameter
 		/// set to match `Catalogue::displayDriverServer()->portNumber()`.
+		/// Renders on the same host may instead use a SharedMemoryDisplayDriver
+		/// with the same parameters, to avoid the overhead of the socket.
 		static IECoreImage::DisplayDriverServer *displayDriverServer();
 
 		/// Generates a filename that could be used for storing
@@ -82,6 +82,13 @@ class GAFFERIMAGE_API ChannelDataProcessor : public ImageProcessor
 		/// @param outData The tile where the result of the operation should be written. It is initialized with the coresponding tile data from inPlug() which should be used as the input data.
 		virtual void processChannelData( const Gaffer::Context *context, const ImagePlug *parent, const std::string &channel, IECore::FloatVectorDataPtr outData ) const = 0;
 
+		/// May be implemented to return true if `processChannelData()` accepts an `outData`
+		/// containing just a single value, which is used to process constant input tiles (see
+		/// `ImagePlug::constantTile()`) in constant time. Implementations which combine
+		/// `outData` with other non-constant data must resize it to a full tile first. The
+		/// default implementation returns false.
+		virtual bool processesConstantTiles() const;
+
 		void hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 
 	private :
@@ -84,6 +84,11 @@ class GAFFERIMAGE_API ColorProcessor : public ImageProcessor
 		virtual void hashColorData( const Gaffer::Context *context, IECore::MurmurHash &h ) const;
 		/// Must be implemented by derived classes to modify R, G and B in place.
 		virtual void processColorData( const Gaffer::Context *context, IECore::FloatVectorData *r, IECore::FloatVectorData *g, IECore::FloatVectorData *b ) const = 0;
+		/// May be implemented to return true if `processColorData()` accepts R, G
+		/// and B containing just a single value, which is used to process constant
+		/// input tiles (see `ImagePlug::constantTile()`) in constant time. The
+		/// default implementation returns false.
+		virtual bool processesConstantTiles() const;
 
 	private :
 
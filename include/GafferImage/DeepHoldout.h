@@ -59,6 +59,9 @@ class GAFFERIMAGE_API DeepHoldout : public ImageProcessor
 		GafferImage::ImagePlug *holdoutPlug();
 		const GafferImage::ImagePlug *holdoutPlug() const;
 
+		Gaffer::FloatPlug *opacityThresholdPlug();
+		const Gaffer::FloatPlug *opacityThresholdPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
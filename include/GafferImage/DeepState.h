@@ -74,6 +74,9 @@ class GAFFERIMAGE_API DeepState : public ImageProcessor
 		Gaffer::FloatPlug *occludedThresholdPlug();
 		const Gaffer::FloatPlug *occludedThresholdPlug() const;
 
+		Gaffer::FloatPlug *opacityThresholdPlug();
+		const Gaffer::FloatPlug *opacityThresholdPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
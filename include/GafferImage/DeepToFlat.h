@@ -65,6 +65,9 @@ class GAFFERIMAGE_API DeepToFlat : public ImageProcessor
 		Gaffer::IntPlug *depthModePlug();
 		const Gaffer::IntPlug *depthModePlug() const;
 
+		Gaffer::FloatPlug *opacityThresholdPlug();
+		const Gaffer::FloatPlug *opacityThresholdPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
@@ -67,6 +67,15 @@ class GAFFERIMAGE_API Display : public ImageNode
 		IECoreImage::DisplayDriver *getDriver();
 		const IECoreImage::DisplayDriver *getDriver() const;
 
+		/// Losslessly compresses the data held by the driver, to reduce
+		/// memory usage once an image is complete. Tiles are decompressed
+		/// on demand when computed, and the driver continues to accept
+		/// new data after compression.
+		void compressDriver();
+		/// Returns the number of bytes used to store the driver's
+		/// channel data.
+		size_t driverMemoryUsage() const;
+
 		/// Emitted when a new driver has been created. This can
 		/// then be passed to `Display::setDriver()` to populate
 		/// a Display with an incoming image.
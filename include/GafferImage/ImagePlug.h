@@ -196,7 +196,22 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 		static const IECore::FloatVectorData *emptyTile();
 		static const IECore::FloatVectorData *blackTile();
 		static const IECore::FloatVectorData *whiteTile();
+		/// Returns a tile with every pixel set to `value`. Tiles are shared
+		/// between all callers requesting the same value, so sources should
+		/// use this for uniform regions. This keeps the memory cost of such
+		/// regions constant, and allows downstream nodes to process them in
+		/// constant time using `isConstantTile()`.
+		static IECore::ConstFloatVectorDataPtr constantTile( float value );
+		/// Returns true if `tile` was returned by `constantTile()`, `blackTile()`
+		/// or `whiteTile()`, filling `value` with the value of its pixels.
+		/// This is a constant time test, so a uniform tile which was not
+		/// created via `constantTile()` will not be recognised.
+		static bool isConstantTile( const IECore::FloatVectorData *tile, float &value );
 
+		/// The tile size is a process-wide setting, fixed at startup. It
+		/// defaults to 128, and may be overridden by setting the
+		/// `GAFFERIMAGE_TILESIZE` environment variable to a power of
+		/// two between 32 and 1024.
 		inline static int tileSize() { return 1 << tileSizeLog2(); };
 		inline static int tilePixels() { return tileSize() * tileSize(); };
 
@@ -229,7 +244,8 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 
 	private :
 
-		static int tileSizeLog2() { return 7; };
+		static int tileSizeLog2() { return g_tileSizeLog2; };
+		static const int g_tileSizeLog2;
 
 		static void compoundObjectToCompoundData( const IECore::CompoundObject *object, IECore::CompoundData *data );
 
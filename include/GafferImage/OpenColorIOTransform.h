@@ -98,6 +98,9 @@ class GAFFERIMAGE_API OpenColorIOTransform : public ColorProcessor
 		/// OpenColorIO Config and apply it to the output channels.
 		/// Derived classes should implement transform() instead.
 		void processColorData( const Gaffer::Context *context, IECore::FloatVectorData *r, IECore::FloatVectorData *g, IECore::FloatVectorData *b ) const override;
+		/// Implemented to return true, since `processColorData()` treats
+		/// the pixels as an arbitrary length line.
+		bool processesConstantTiles() const override;
 
 		/// Derived classes must implement this to return true if the specified input
 		/// is used in transform().
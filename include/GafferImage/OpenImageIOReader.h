@@ -87,6 +87,16 @@ class GAFFERIMAGE_API OpenImageIOReader : public ImageNode
 		static void setOpenFilesLimit( size_t maxOpenFiles );
 		static size_t getOpenFilesLimit();
 
+		/// When on, channels stored as half in the file are also stored as
+		/// half in the tile batches held in the cache, halving their memory
+		/// usage. They are converted to float as they are output. This only
+		/// affects tiles read after the call is made. Defaults to off.
+		/// > Note : ImageReader converts to the working colour space after
+		/// > reading, and caches the converted tiles as float. Half storage
+		/// > therefore only saves memory for files which require no conversion.
+		static void setHalfTileStorage( bool halfTileStorage );
+		static bool getHalfTileStorage();
+
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
 	protected :
@@ -0,0 +1,118 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2021, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef GAFFERIMAGE_SHAREDMEMORYDISPLAYDRIVER_H
+#define GAFFERIMAGE_SHAREDMEMORYDISPLAYDRIVER_H
+
+#include "GafferImage/Export.h"
+#include "GafferImage/TypeIds.h"
+
+#include "IECoreImage/DisplayDriver.h"
+
+#include <memory>
+
+namespace GafferImage
+{
+
+/// A DisplayDriver for sending images to a Catalogue running on the
+/// same host. Rather than serialising buckets through a socket as the
+/// IECoreImage::ClientDisplayDriver does, pixel data is written directly
+/// into a ring buffer in shared memory, from which it is read by a
+/// SharedMemoryDisplayDriverServer. The driver accepts the same parameters
+/// as the ClientDisplayDriver ("displayHost", "displayPort" and
+/// "remoteDisplayType"), and falls back to using a ClientDisplayDriver
+/// when the host is remote or no server is running.
+class GAFFERIMAGE_API SharedMemoryDisplayDriver : public IECoreImage::DisplayDriver
+{
+
+	public :
+
+		IE_CORE_DECLARERUNTIMETYPEDEXTENSION( GafferImage::SharedMemoryDisplayDriver, SharedMemoryDisplayDriverTypeId, IECoreImage::DisplayDriver );
+
+		SharedMemoryDisplayDriver( const Imath::Box2i &displayWindow, const Imath::Box2i &dataWindow, const std::vector<std::string> &channelNames, IECore::ConstCompoundDataPtr parameters );
+		~SharedMemoryDisplayDriver() override;
+
+		bool scanLineOrderOnly() const override;
+		bool acceptsRepeatedData() const override;
+		void imageData( const Imath::Box2i &box, const float *data, size_t dataSize ) override;
+		void imageClose() override;
+
+		/// Returns true if data is being sent via shared memory, and
+		/// false if the socket fallback is in use.
+		bool usingSharedMemory() const;
+
+	private :
+
+		class Connection;
+		std::unique_ptr<Connection> m_connection;
+		IECoreImage::DisplayDriverPtr m_fallback;
+
+		static const DisplayDriverDescription<SharedMemoryDisplayDriver> g_description;
+
+};
+
+IE_CORE_DECLAREPTR( SharedMemoryDisplayDriver )
+
+/// Receives images sent by SharedMemoryDisplayDriver, creating a
+/// DisplayDriver of the type specified by the client's "remoteDisplayType"
+/// parameter for each one. The server is identified by a port number, so
+/// that it can be paired with an IECoreImage::DisplayDriverServer and
+/// clients can choose whichever transport suits them.
+class GAFFERIMAGE_API SharedMemoryDisplayDriverServer : public IECore::RefCounted
+{
+
+	public :
+
+		/// Throws if the shared memory segment can not be created.
+		SharedMemoryDisplayDriverServer( int portNumber, size_t bufferSize = 64 * 1024 * 1024 );
+		~SharedMemoryDisplayDriverServer() override;
+
+		IE_CORE_DECLAREMEMBERPTR( SharedMemoryDisplayDriverServer );
+
+		int portNumber() const;
+
+	private :
+
+		class PrivateData;
+		std::unique_ptr<PrivateData> m_data;
+
+};
+
+IE_CORE_DECLAREPTR( SharedMemoryDisplayDriverServer )
+
+} // namespace GafferImage
+
+#endif // GAFFERIMAGE_SHAREDMEMORYDISPLAYDRIVER_H
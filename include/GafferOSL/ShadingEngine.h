@@ -105,6 +105,12 @@ class GAFFEROSL_API ShadingEngine : public IECore::RefCounted
 
 		bool m_hasDeformation;
 
+		// Outputs whose names and types can be determined from the
+		// shader network in advance, so that they can be allocated
+		// before shading starts. Stored as `( name, type )` pairs.
+		typedef std::vector<std::pair<std::string, std::string>> KnownOutputs;
+		KnownOutputs m_knownOutputs;
+
 		void *m_shaderGroupRef;
 
 };
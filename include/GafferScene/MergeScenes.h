@@ -40,6 +40,7 @@
 #include "GafferScene/SceneProcessor.h"
 
 #include <bitset>
+#include <vector>
 
 namespace GafferScene
 {
@@ -83,6 +84,9 @@ class GAFFERSCENE_API MergeScenes : public SceneProcessor
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
 
+		Gaffer::ValuePlug::CachePolicy hashCachePolicy( const Gaffer::ValuePlug *output ) const override;
+		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+
 		void hashBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const override;
 		Imath::Box3f computeBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const override;
 
@@ -150,6 +154,16 @@ class GAFFERSCENE_API MergeScenes : public SceneProcessor
 		template<typename Visitor>
 		void visit( InputMask inputMask, Visitor &&visitor, VisitOrder order = VisitOrder::Forwards ) const;
 
+		// Returns `evaluator( inputIndex, input )` for each input that `visit()` would visit, in
+		// the same order. Inputs are evaluated in parallel when there are enough of them to make
+		// it worthwhile.
+		template<typename T, typename Evaluator>
+		std::vector<T> evaluateInputs( InputMask inputMask, Evaluator &&evaluator, VisitOrder order = VisitOrder::Forwards ) const;
+
+		// Returns the subset of `inputMask` for which the input has a location at the current
+		// `scene:path`.
+		InputMask existingInputs( InputMask inputMask ) const;
+
 		static size_t g_firstPlugIndex;
 
 };
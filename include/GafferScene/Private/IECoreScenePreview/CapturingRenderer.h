@@ -156,6 +156,7 @@ class IECORESCENE_API CapturingRenderer : public Renderer
 		ObjectInterfacePtr object( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes ) override;
 		void render() override;
 		void pause() override;
+		bool waitForRender() override;
 
 	private :
 
@@ -96,6 +96,10 @@ class IECORESCENE_API Renderer : public IECore::RefCounted
 		/// The renderer must scope the supplied handler before calling out to other code that makes use of static
 		/// IECore::msg logging.
 		static Ptr create( const IECore::InternedString &type, RenderType renderType = Batch, const std::string &fileName = "", const IECore::MessageHandlerPtr &messageHandler = IECore::MessageHandlerPtr() );
+		/// Returns true if Interactive renderers of the specified type
+		/// implement `waitForRender()`. This allows clients to decide
+		/// how to render without the expense of creating a renderer.
+		static bool supportsWaitForRender( const IECore::InternedString &type );
 
 		/// Returns the name of this renderer, for instance "OpenGL" or "Arnold".
 		virtual IECore::InternedString name() const = 0;
@@ -297,6 +301,16 @@ class IECORESCENE_API Renderer : public IECore::RefCounted
 		/// If an interactive render is running, pauses it so
 		/// that edits may be made.
 		virtual void pause() = 0;
+		/// Blocks until an Interactive render started by render()
+		/// has completed, after which edits may be made without
+		/// calling pause(). Returns false if this is not supported,
+		/// in which case it returns immediately. Used to render a
+		/// sequence of frames with a single Interactive renderer.
+		/// The default implementation returns false. Renderers
+		/// which implement it should declare so in their
+		/// TypeDescription, so that support can be queried using
+		/// `supportsWaitForRender()`.
+		virtual bool waitForRender();
 
 		/// Performs an arbitrary renderer-specific action.
 		virtual IECore::DataPtr command( const IECore::InternedString name, const IECore::CompoundDataMap &parameters = IECore::CompoundDataMap() );
@@ -313,9 +327,9 @@ class IECORESCENE_API Renderer : public IECore::RefCounted
 		{
 
 			/// \todo Take the type name from RunTimeTyped::staticTypeId().
-			TypeDescription( const IECore::InternedString &typeName )
+			TypeDescription( const IECore::InternedString &typeName, bool supportsWaitForRender = false )
 			{
-				registerType( typeName, creator );
+				registerType( typeName, creator, supportsWaitForRender );
 			}
 
 			private :
@@ -329,7 +343,7 @@ class IECORESCENE_API Renderer : public IECore::RefCounted
 
 	private :
 
-		static void registerType( const IECore::InternedString &typeName, Ptr (*creator)( RenderType, const std::string &, const IECore::MessageHandlerPtr & ) );
+		static void registerType( const IECore::InternedString &typeName, Ptr (*creator)( RenderType, const std::string &, const IECore::MessageHandlerPtr & ), bool supportsWaitForRender );
 
 
 };
@@ -93,6 +93,13 @@ class GAFFERSCENE_API Render : public GafferDispatch::TaskNode
 		void postTasks( const Gaffer::Context *context, Tasks &tasks ) const override;
 		IECore::MurmurHash hash( const Gaffer::Context *context ) const override;
 		void execute() const override;
+		/// Renders sequences using a single Interactive renderer where
+		/// possible, so that only the parts of the scene that change
+		/// between frames need to be translated again. Falls back to
+		/// `execute()` for each frame if the renderer doesn't support
+		/// `waitForRender()`, or if the renderer or mode varies between
+		/// frames.
+		void executeSequence( const std::vector<float> &frames ) const override;
 
 	private :
 
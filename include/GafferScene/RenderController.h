@@ -51,6 +51,7 @@ namespace GafferScene
 {
 
 IE_CORE_FORWARDDECLARE( ScenePlug )
+IE_CORE_FORWARDDECLARE( FilteredSceneProcessor )
 
 /// Utility class used to make interactive updates to a Renderer.
 class GAFFERSCENE_API RenderController : public boost::signals::trackable
@@ -105,7 +106,17 @@ class GAFFERSCENE_API RenderController : public boost::signals::trackable
 		void dirtyGlobals( unsigned components );
 		void dirtySceneGraphs( unsigned components );
 
+		// Dirty path tracking. When an edit is made to one of the
+		// filtered processors feeding directly into `m_scene`, only
+		// the locations matched by its filter can have changed, so
+		// we can restrict the next update to those locations.
+		void updateUpstreamProcessors();
+		void upstreamPlugDirtied( const Gaffer::Plug *plug );
+		void upstreamPlugInputChanged( const Gaffer::Plug *plug );
+		bool updateDirtyPaths();
+
 		void updateInternal( const ProgressCallback &callback = ProgressCallback(), const IECore::PathMatcher *pathsToUpdate = nullptr );
+		void updateSceneGraphs( const ProgressCallback &callback, const IECore::PathMatcher *pathsToUpdate, bool pathsToUpdateComplete );
 		void updateDefaultCamera();
 		void cancelBackgroundTask();
 
@@ -122,6 +133,16 @@ class GAFFERSCENE_API RenderController : public boost::signals::trackable
 		boost::signals::scoped_connection m_plugDirtiedConnection;
 		boost::signals::scoped_connection m_contextChangedConnection;
 
+		std::vector<ConstFilteredSceneProcessorPtr> m_upstreamProcessors;
+		std::vector<boost::signals::connection> m_upstreamConnections;
+		std::vector<ConstFilteredSceneProcessorPtr> m_pendingDirtyPathsSources;
+		bool m_pendingDirtyPathsInvalid;
+		unsigned m_pendingDirtyComponents;
+		std::vector<ConstFilteredSceneProcessorPtr> m_dirtyPathsSources;
+		unsigned m_dirtyPathsComponents;
+		bool m_dirtyPathsValid;
+		IECore::PathMatcher m_dirtyPaths;
+
 		UpdateRequiredSignal m_updateRequiredSignal;
 		bool m_updateRequired;
 		bool m_updateRequested;
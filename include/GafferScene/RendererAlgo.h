@@ -50,7 +50,6 @@
 #include "boost/container/flat_map.hpp"
 
 #include "tbb/concurrent_hash_map.h"
-#include "tbb/spin_mutex.h"
 
 #include <functional>
 
@@ -211,9 +210,8 @@ class GAFFERSCENE_API LightLinks : boost::noncopyable
 		void addFilterLink( const IECoreScenePreview::Renderer::ObjectInterfacePtr &lightFilter, const std::string &filteredLightsExpression );
 		void removeFilterLink( const IECoreScenePreview::Renderer::ObjectInterfacePtr &lightFilter, const std::string &filteredLightsExpression );
 		std::string filteredLightsExpression( const IECore::CompoundObject *attributes ) const;
-		IECoreScenePreview::Renderer::ConstObjectSetPtr linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene ) const;
+		IECoreScenePreview::Renderer::ConstObjectSetPtr linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene, uint64_t &version ) const;
 		void outputLightFilterLinks( const std::string &lightName, IECoreScenePreview::Renderer::ObjectInterface *light ) const;
-		void clearLightLinks();
 
 		/// Storage for lights. This maps from the light name to the light itself.
 		using LightMap = tbb::concurrent_hash_map<std::string, IECoreScenePreview::Renderer::ObjectInterfacePtr>;
@@ -227,11 +225,28 @@ class GAFFERSCENE_API LightLinks : boost::noncopyable
 		/// ===========================
 		///
 		/// This maps from `linkedLights` expressions to ObjectSets containing
-		/// the relevant lights.
+		/// the relevant lights. Rather than discard the ObjectSets whenever
+		/// sets or lights change, we bump a generation count, and each
+		/// LightLink is brought up to date lazily by `linkedLights()`. The
+		/// expression is only reevaluated if the hash of the sets it
+		/// references has changed, and `version` is only incremented if the
+		/// lights themselves have changed, allowing `outputLightLinks()`
+		/// to skip objects whose links are unaffected.
+
+		struct LightLink
+		{
+			IECore::MurmurHash setExpressionHash;
+			IECore::PathMatcher paths;
+			IECoreScenePreview::Renderer::ObjectSetPtr lights;
+			uint64_t setsGeneration = 0;
+			uint64_t lightsGeneration = 0;
+			uint64_t version = 0;
+		};
 
-		using LightLinkMap = tbb::concurrent_hash_map<std::string, IECoreScenePreview::Renderer::ObjectSetPtr>;
+		using LightLinkMap = tbb::concurrent_hash_map<std::string, LightLink>;
 		mutable LightLinkMap m_lightLinks;
-		tbb::spin_mutex m_lightLinksClearMutex;
+		std::atomic<uint64_t> m_setsGeneration;
+		std::atomic<uint64_t> m_lightsGeneration;
 
 		/// Storage for links between lights and light filters
 		/// ==================================================
@@ -265,6 +280,13 @@ GAFFERSCENE_API void outputLightFilters( const ScenePlug *scene, const IECore::C
 GAFFERSCENE_API void outputLights( const ScenePlug *scene, const IECore::CompoundObject *globals, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer );
 GAFFERSCENE_API void outputObjects( const ScenePlug *scene, const IECore::CompoundObject *globals, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
 
+/// Outputs cameras, lights, light filters and objects in a single traversal of
+/// the scene, computing attributes and transforms only once per location. This
+/// is equivalent to calling the functions above followed by
+/// `LightLinks::outputLightFilterLinks()`, but is more efficient. Light links
+/// are output once the traversal is complete.
+GAFFERSCENE_API void outputScene( const ScenePlug *scene, const IECore::CompoundObject *globals, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer );
+
 /// Applies the resolution, aspect ratio etc from the globals to the camera.
 GAFFERSCENE_API void applyCameraGlobals( IECoreScene::Camera *camera, const IECore::CompoundObject *globals, const ScenePlug *scene );
 
@@ -47,9 +47,12 @@
 #include "IECore/Export.h"
 
 IECORE_PUSH_DEFAULT_VISIBILITY
+#include "OpenEXR/ImathPlane.h"
 #include "OpenEXR/ImathVec.h"
 IECORE_POP_DEFAULT_VISIBILITY
 
+#include <limits>
+#include <memory>
 #include <unordered_set>
 
 namespace IECore
@@ -59,6 +62,13 @@ IE_CORE_FORWARDDECLARE( CompoundData )
 
 } // namespace IECore
 
+namespace IECoreScene
+{
+
+IE_CORE_FORWARDDECLARE( PrimitiveEvaluator )
+
+} // namespace IECoreScene
+
 namespace GafferScene
 {
 
@@ -267,6 +277,69 @@ GAFFERSCENE_API IECore::PathMatcher linkedLights( const ScenePlug *scene, const
 /// Returns the paths to all lights which are linked to at least one of the specified objects.
 GAFFERSCENE_API IECore::PathMatcher linkedLights( const ScenePlug *scene, const IECore::PathMatcher &objects );
 
+/// Spatial queries
+/// ===============
+///
+/// An acceleration structure for making world space queries against the
+/// objects at a set of locations. Indices are cached using the hashes of
+/// the objects and transforms they were built from, so repeated queries
+/// against an unchanged scene share a single index. All queries may be
+/// made concurrently from multiple threads.
+
+class GAFFERSCENE_API SpatialIndex : public IECore::RefCounted
+{
+
+	public :
+
+		IE_CORE_DECLAREMEMBERPTR( SpatialIndex )
+
+		/// Builds an index for the objects at `paths`. Generally
+		/// `spatialIndex()` should be used instead, to take advantage
+		/// of caching.
+		SpatialIndex( const ScenePlug *scene, const std::vector<ScenePlug::ScenePath> &paths );
+		~SpatialIndex() override;
+
+		/// Returns the approximate memory used by the index, including
+		/// the PrimitiveEvaluators it references.
+		size_t memoryUsage() const;
+
+		/// Returns the world space bound of all the indexed objects.
+		Imath::Box3f bound() const;
+
+		/// Finds the closest intersection of a world space ray with the
+		/// indexed primitives, returning true if one is found within
+		/// `maxDistance` of `origin`.
+		bool rayCast( const Imath::V3f &origin, const Imath::V3f &direction, ScenePlug::ScenePath &hitPath, Imath::V3f &hitPoint, float maxDistance = std::numeric_limits<float>::max() ) const;
+		/// Finds the closest point on the indexed primitives to a world
+		/// space point, returning true if one is found within `maxDistance`.
+		bool closestPoint( const Imath::V3f &point, ScenePlug::ScenePath &closestPath, Imath::V3f &closestPoint, float maxDistance = std::numeric_limits<float>::max() ) const;
+		/// Returns the locations whose world space bounds are not entirely
+		/// outside the convex volume defined by `planes`. Points at a positive
+		/// distance from a plane are considered to be inside it. This is
+		/// suitable for conservative frustum queries.
+		IECore::PathMatcher frustumQuery( const std::vector<Imath::Plane3f> &planes ) const;
+
+	private :
+
+		class Implementation;
+		std::unique_ptr<Implementation> m_implementation;
+
+};
+
+IE_CORE_DECLAREPTR( SpatialIndex )
+
+/// Returns an index for the objects at the locations in `paths`. Paths which
+/// don't exist in the scene are ignored.
+GAFFERSCENE_API ConstSpatialIndexPtr spatialIndex( const ScenePlug *scene, const IECore::PathMatcher &paths );
+/// As above, but indexing the locations matched by a filter.
+GAFFERSCENE_API ConstSpatialIndexPtr spatialIndex( const FilterPlug *filterPlug, const ScenePlug *scene );
+
+/// Returns a PrimitiveEvaluator for the object at `path`, or null if the
+/// object is not a primitive supported by PrimitiveEvaluator. Meshes are
+/// triangulated as necessary. Evaluators are cached using the hash of the
+/// object, so repeated calls for the same object share a single evaluator.
+GAFFERSCENE_API IECoreScene::ConstPrimitiveEvaluatorPtr primitiveEvaluator( const ScenePlug *scene, const ScenePlug::ScenePath &path );
+
 /// Miscellaneous
 /// =============
 
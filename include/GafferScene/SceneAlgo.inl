@@ -36,7 +36,8 @@
 
 #include "Gaffer/Context.h"
 
-#include "tbb/task.h"
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
 
 namespace GafferScene
 {
@@ -44,141 +45,94 @@ namespace GafferScene
 namespace Detail
 {
 
-template <class ThreadableFunctor>
-class TraverseTask : public tbb::task
+// Visits the children of `parent`, which must already have been passed to
+// the functor. Rather than spawning a task per location, we use a
+// `parallel_for()` over ranges of child names, letting TBB's partitioner
+// choose chunk sizes adaptively. Each chunk shares a single PathScope and
+// path buffer between all its locations, so that the context and path are
+// updated in place rather than being copied for every location. This keeps
+// the overhead low for very wide hierarchies, while still splitting down to
+// individual locations when there are only a few expensive children.
+template<typename ThreadableFunctor>
+void traverseChildren(
+	const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState,
+	const ScenePlug::ScenePath &parent, ThreadableFunctor &f,
+	tbb::task_group_context &taskGroupContext
+)
 {
+	IECore::ConstInternedStringVectorDataPtr childNamesData = scene->childNamesPlug()->getValue();
+	const std::vector<IECore::InternedString> &childNames = childNamesData->readable();
+	if( childNames.empty() )
+	{
+		return;
+	}
 
-	public :
-
-		TraverseTask(
-			const GafferScene::ScenePlug *scene,
-			const Gaffer::ThreadState &threadState,
-			ThreadableFunctor &f
-		)
-			:	m_scene( scene ), m_threadState( threadState ), m_f( f )
-		{
-		}
-
-		TraverseTask(
-			const GafferScene::ScenePlug *scene,
-			const Gaffer::ThreadState &threadState,
-			const ScenePlug::ScenePath &path,
-			ThreadableFunctor &f
-		)
-			:	m_scene( scene ), m_threadState( threadState ), m_f( f ), m_path( path )
-		{
-		}
-
-
-		~TraverseTask() override
-		{
-		}
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, childNames.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
 
-		task *execute() override
-		{
-			ScenePlug::PathScope pathScope( m_threadState, m_path );
+			ScenePlug::PathScope pathScope( threadState );
+			ScenePlug::ScenePath childPath;
+			childPath.reserve( parent.size() + 1 );
+			childPath.insert( childPath.end(), parent.begin(), parent.end() );
+			childPath.push_back( IECore::InternedString() ); // space for the child name
 
-			if( m_f( m_scene, m_path ) )
+			for( size_t i = range.begin(); i != range.end(); ++i )
 			{
-				IECore::ConstInternedStringVectorDataPtr childNamesData = m_scene->childNamesPlug()->getValue();
-				const std::vector<IECore::InternedString> &childNames = childNamesData->readable();
-
-				set_ref_count( 1 + childNames.size() );
-
-				ScenePlug::ScenePath childPath = m_path;
-				childPath.push_back( IECore::InternedString() ); // space for the child name
-				for( std::vector<IECore::InternedString>::const_iterator it = childNames.begin(), eIt = childNames.end(); it != eIt; it++ )
+				childPath.back() = childNames[i];
+				pathScope.setPath( childPath );
+				if( f( scene, childPath ) )
 				{
-					childPath[m_path.size()] = *it;
-					TraverseTask *t = new( allocate_child() ) TraverseTask( *this, childPath );
-					spawn( *t );
+					traverseChildren( scene, threadState, childPath, f, taskGroupContext );
 				}
-				wait_for_all();
 			}
 
-			return nullptr;
-		}
-
-	protected :
-
-		TraverseTask( const TraverseTask &other, const ScenePlug::ScenePath &path )
-			:	m_scene( other.m_scene ),
-			m_threadState( other.m_threadState ),
-			m_f( other.m_f ),
-			m_path( path )
-		{
-		}
-
-	private :
-
-		const GafferScene::ScenePlug *m_scene;
-		const Gaffer::ThreadState &m_threadState;
-		ThreadableFunctor &m_f;
-		GafferScene::ScenePlug::ScenePath m_path;
-
-};
+		},
+		taskGroupContext
+	);
+}
 
+// As above, but giving each location its own copy of the parent's functor,
+// as required by `parallelProcessLocations()`.
 template<typename ThreadableFunctor>
-class LocationTask : public tbb::task
+void processChildLocations(
+	const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState,
+	const ScenePlug::ScenePath &parent, const ThreadableFunctor &parentFunctor,
+	tbb::task_group_context &taskGroupContext
+)
 {
+	IECore::ConstInternedStringVectorDataPtr childNamesData = scene->childNamesPlug()->getValue();
+	const std::vector<IECore::InternedString> &childNames = childNamesData->readable();
+	if( childNames.empty() )
+	{
+		return;
+	}
 
-	public :
-
-		LocationTask(
-			const GafferScene::ScenePlug *scene,
-			const Gaffer::ThreadState &threadState,
-			const ScenePlug::ScenePath &path,
-			ThreadableFunctor &f
-		)
-			:	m_scene( scene ), m_threadState( threadState ), m_path( path ), m_f( f )
-		{
-		}
-
-		~LocationTask() override
-		{
-		}
-
-		task *execute() override
-		{
-			ScenePlug::PathScope pathScope( m_threadState, m_path );
-
-			if( !m_f( m_scene, m_path ) )
-			{
-				return nullptr;
-			}
-
-			IECore::ConstInternedStringVectorDataPtr childNamesData = m_scene->childNamesPlug()->getValue();
-			const std::vector<IECore::InternedString> &childNames = childNamesData->readable();
-			if( childNames.empty() )
-			{
-				return nullptr;
-			}
-
-			std::vector<ThreadableFunctor> childFunctors( childNames.size(), m_f );
-
-			set_ref_count( 1 + childNames.size() );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, childNames.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
 
-			ScenePlug::ScenePath childPath = m_path;
+			ScenePlug::PathScope pathScope( threadState );
+			ScenePlug::ScenePath childPath;
+			childPath.reserve( parent.size() + 1 );
+			childPath.insert( childPath.end(), parent.begin(), parent.end() );
 			childPath.push_back( IECore::InternedString() ); // space for the child name
-			for( size_t i = 0, e = childNames.size(); i < e; ++i )
+
+			for( size_t i = range.begin(); i != range.end(); ++i )
 			{
 				childPath.back() = childNames[i];
-				LocationTask *t = new( allocate_child() ) LocationTask( m_scene, m_threadState, childPath, childFunctors[i] );
-				spawn( *t );
+				pathScope.setPath( childPath );
+				ThreadableFunctor childFunctor( parentFunctor );
+				if( childFunctor( scene, childPath ) )
+				{
+					processChildLocations( scene, threadState, childPath, childFunctor, taskGroupContext );
+				}
 			}
-			wait_for_all();
-
-			return nullptr;
-		}
-
-	private :
-
-		const GafferScene::ScenePlug *m_scene;
-		const Gaffer::ThreadState &m_threadState;
-		const GafferScene::ScenePlug::ScenePath m_path;
-		ThreadableFunctor &m_f;
 
-};
+		},
+		taskGroupContext
+	);
+}
 
 template <class ThreadableFunctor>
 struct ThreadableFilteredFunctor
@@ -250,24 +204,30 @@ template <class ThreadableFunctor>
 void parallelProcessLocations( const GafferScene::ScenePlug *scene, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
 {
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated ); // Prevents outer tasks silently cancelling our tasks
-	Detail::LocationTask<ThreadableFunctor> *task = new( tbb::task::allocate_root( taskGroupContext ) ) Detail::LocationTask<ThreadableFunctor>( scene, Gaffer::ThreadState::current(), root, f );
-	tbb::task::spawn_root_and_wait( *task );
+	const Gaffer::ThreadState &threadState = Gaffer::ThreadState::current();
+	ScenePlug::PathScope pathScope( threadState, root );
+	if( f( scene, root ) )
+	{
+		Detail::processChildLocations( scene, threadState, root, f, taskGroupContext );
+	}
 }
 
 template <class ThreadableFunctor>
 void parallelTraverse( const GafferScene::ScenePlug *scene, ThreadableFunctor &f )
 {
-	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated ); // Prevents outer tasks silently cancelling our tasks
-	Detail::TraverseTask<ThreadableFunctor> *task = new( tbb::task::allocate_root( taskGroupContext ) ) Detail::TraverseTask<ThreadableFunctor>( scene, Gaffer::ThreadState::current(), f );
-	tbb::task::spawn_root_and_wait( *task );
+	parallelTraverse( scene, f, ScenePlug::ScenePath() );
 }
 
 template <class ThreadableFunctor>
 void parallelTraverse( const ScenePlug *scene, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
 {
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated ); // Prevents outer tasks silently cancelling our tasks
-	Detail::TraverseTask<ThreadableFunctor> *task = new( tbb::task::allocate_root( taskGroupContext ) ) Detail::TraverseTask<ThreadableFunctor>( scene, Gaffer::ThreadState::current(), root, f );
-	tbb::task::spawn_root_and_wait( *task );
+	const Gaffer::ThreadState &threadState = Gaffer::ThreadState::current();
+	ScenePlug::PathScope pathScope( threadState, root );
+	if( f( scene, root ) )
+	{
+		Detail::traverseChildren( scene, threadState, root, f, taskGroupContext );
+	}
 }
 
 template <class ThreadableFunctor>
@@ -70,6 +70,19 @@ class GAFFERSCENE_API SceneNode : public Gaffer::ComputeNode
 		/// Implemented so that enabledPlug() affects outPlug().
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
+		/// By default, `ScenePlug::childBoundsPlug()` is computed by
+		/// unioning the transformed bounds of all children. When a
+		/// non-zero block size is specified, the children of locations
+		/// with more than that number of children are divided into blocks,
+		/// and the union for each block is cached separately. After an edit
+		/// to a single child, only the union for its block must then be
+		/// recomputed, which can significantly speed up bound computation
+		/// in very wide hierarchies. Defaults to the value of the
+		/// `GAFFERSCENE_CHILDBOUNDS_BLOCKSIZE` environment variable,
+		/// or 0 (no blocking) if that is not set.
+		static void setChildBoundsBlockSize( size_t blockSize );
+		static size_t getChildBoundsBlockSize();
+
 	protected :
 
 		typedef ScenePlug::ScenePath ScenePath;
@@ -145,6 +158,9 @@ class GAFFERSCENE_API SceneNode : public Gaffer::ComputeNode
 		void hashChildBounds( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const;
 		Imath::Box3f computeChildBounds( const Gaffer::Context *context, const ScenePlug *parent ) const;
 
+		void hashChildBoundsBlock( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const;
+		Imath::Box3f computeChildBoundsBlock( const Gaffer::Context *context, const ScenePlug *parent ) const;
+
 		static size_t g_firstPlugIndex;
 
 };
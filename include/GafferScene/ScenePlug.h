@@ -274,6 +274,10 @@ class GAFFERSCENE_API ScenePlug : public Gaffer::ValuePlug
 		// Private plug used for the computation of `existsPlug()` by SceneNode.
 		Gaffer::InternedStringVectorDataPlug *sortedChildNamesPlug();
 		const Gaffer::InternedStringVectorDataPlug *sortedChildNamesPlug() const;
+		// Private plug used for the computation of `childBoundsPlug()` by SceneNode,
+		// providing the union of the bounds for a single block of children.
+		Gaffer::AtomicBox3fPlug *childBoundsBlockPlug();
+		const Gaffer::AtomicBox3fPlug *childBoundsBlockPlug() const;
 		friend class SceneNode;
 
 };
@@ -43,6 +43,12 @@ namespace GafferSceneTest
 {
 
 GAFFERSCENETEST_API void testManyStringToPathCalls();
+/// Constructs a new PathScope for each of many sibling locations, hashing
+/// the resulting context.
+GAFFERSCENETEST_API void testPathScopeConstructionPerformance( int pathDepth );
+/// As above, but reusing a single PathScope for each range of siblings, as
+/// `SceneAlgo::parallelTraverse()` does.
+GAFFERSCENETEST_API void testPathScopeHashPerformance( int pathDepth );
 
 } // namespace GafferSceneTest
 
@@ -37,6 +37,7 @@
 
 import re
 import ast
+import sys
 import functools
 import inspect
 import imath
@@ -63,6 +64,18 @@ class PythonExpressionEngine( Gaffer.Expression.Engine ) :
 		outPlugs.extend( [ self.__plug( node, p ) for p in self.__outPlugPaths ] )
 		contextNames.extend( parser.contextReads )
 
+		try :
+			self.__nativeProgram = _NativeCompiler( expression, self.__inPlugPaths, self.__outPlugPaths ).program
+		except _NativeCompiler.Unsupported :
+			self.__nativeProgram = None
+
+	# Called by the Expression node after `parse()`. If this returns a program,
+	# it is used to evaluate the expression natively, without the GIL. See
+	# `_NativeCompiler` for details.
+	def _nativeProgram( self ) :
+
+		return self.__nativeProgram
+
 	def execute( self, context, inputs ) :
 
 		plugDict = {}
@@ -332,6 +345,221 @@ class _Parser( ast.NodeVisitor ) :
 		else :
 			return path[1]
 
+##########################################################################
+# Native compiler. This translates a simple subset of Python - arithmetic,
+# string concatenation, comparisons and reads from plugs and the context -
+# into a flat stack-based program which can be evaluated in C++ without
+# holding the GIL. Anything outside the subset raises `Unsupported`, and
+# the expression is evaluated by Python as usual.
+##########################################################################
+
+class _NativeCompiler( object ) :
+
+	class Unsupported( Exception ) :
+
+		pass
+
+	__binaryOps = {
+		ast.Add : "add",
+		ast.Sub : "subtract",
+		ast.Mult : "multiply",
+		# Python 2 uses "classic" division unless `division`
+		# is imported from `__future__`.
+		ast.Div : "divide" if sys.version_info[0] >= 3 else "classicDivide",
+		ast.FloorDiv : "floorDivide",
+		ast.Mod : "modulo",
+		ast.Pow : "power",
+	}
+
+	__compareOps = {
+		ast.Eq : "equal",
+		ast.NotEq : "notEqual",
+		ast.Lt : "less",
+		ast.LtE : "lessEqual",
+		ast.Gt : "greater",
+		ast.GtE : "greaterEqual",
+	}
+
+	__unaryOps = {
+		ast.USub : "negate",
+		ast.UAdd : "positive",
+		ast.Not : "not",
+	}
+
+	__functions = { "int" : 1, "float" : 1, "str" : 1, "abs" : 1, "min" : None, "max" : None }
+
+	__contextMethods = { "getFrame" : "frame", "getTime" : "time", "getFramesPerSecond" : "framesPerSecond" }
+
+	def __init__( self, expression, inPlugPaths, outPlugPaths ) :
+
+		self.__inPlugIndices = { p : i for i, p in enumerate( inPlugPaths ) }
+		self.__outPlugIndices = { p : i for i, p in enumerate( outPlugPaths ) }
+		self.__locals = {}
+		self.__instructions = []
+
+		for statement in ast.parse( expression ).body :
+			self.__statement( statement )
+
+		self.program = ( self.__instructions, len( self.__locals ), len( outPlugPaths ) )
+
+	def __statement( self, node ) :
+
+		if not isinstance( node, ast.Assign ) or len( node.targets ) != 1 :
+			raise self.Unsupported()
+
+		self.__expression( node.value )
+
+		target = node.targets[0]
+		if isinstance( target, ast.Name ) :
+			index = self.__locals.setdefault( target.id, len( self.__locals ) )
+			self.__emit( "store", index )
+		else :
+			path = self.__path( target )
+			plugPath = ".".join( path[1:] ) if len( path ) > 1 and path[0] == "parent" else ""
+			if plugPath not in self.__outPlugIndices :
+				raise self.Unsupported()
+			self.__emit( "output", self.__outPlugIndices[plugPath] )
+
+	def __expression( self, node ) :
+
+		constant = self.__constant( node )
+		if constant is not None :
+			self.__emit( "constant", constant[0] )
+		elif isinstance( node, ast.Name ) :
+			if node.id not in self.__locals :
+				raise self.Unsupported()
+			self.__emit( "load", self.__locals[node.id] )
+		elif isinstance( node, ast.Subscript ) :
+			path = self.__path( node )
+			if len( path ) > 1 and path[0] == "parent" and ".".join( path[1:] ) in self.__inPlugIndices :
+				self.__emit( "input", self.__inPlugIndices[".".join( path[1:] )] )
+			elif len( path ) == 2 and path[0] == "context" :
+				self.__emit( "context", path[1] )
+			else :
+				raise self.Unsupported()
+		elif isinstance( node, ast.BinOp ) and type( node.op ) in self.__binaryOps :
+			self.__expression( node.left )
+			self.__expression( node.right )
+			self.__emit( self.__binaryOps[type( node.op )] )
+		elif isinstance( node, ast.UnaryOp ) and type( node.op ) in self.__unaryOps :
+			self.__expression( node.operand )
+			self.__emit( self.__unaryOps[type( node.op )] )
+		elif isinstance( node, ast.Compare ) and len( node.ops ) == 1 :
+			if type( node.ops[0] ) in self.__compareOps :
+				self.__expression( node.left )
+				self.__expression( node.comparators[0] )
+				self.__emit( self.__compareOps[type( node.ops[0] )] )
+			elif isinstance( node.ops[0], ( ast.In, ast.NotIn ) ) :
+				self.__emit( "contains", self.__contextName( node.left, node.comparators[0] ) )
+				if isinstance( node.ops[0], ast.NotIn ) :
+					self.__emit( "not" )
+			else :
+				raise self.Unsupported()
+		elif isinstance( node, ast.BoolOp ) :
+			self.__expression( node.values[0] )
+			for value in node.values[1:] :
+				self.__expression( value )
+				self.__emit( "and" if isinstance( node.op, ast.And ) else "or" )
+		elif isinstance( node, ast.IfExp ) :
+			self.__expression( node.body )
+			self.__expression( node.orelse )
+			self.__expression( node.test )
+			self.__emit( "select" )
+		elif isinstance( node, ast.Call ) :
+			self.__call( node )
+		else :
+			raise self.Unsupported()
+
+	def __call( self, node ) :
+
+		if node.keywords or getattr( node, "starargs", None ) or getattr( node, "kwargs", None ) :
+			raise self.Unsupported()
+
+		if isinstance( node.func, ast.Name ) and node.func.id in self.__functions and node.func.id not in self.__locals :
+			numArgs = self.__functions[node.func.id]
+			if numArgs is not None and len( node.args ) != numArgs :
+				raise self.Unsupported()
+			if numArgs is None and len( node.args ) < 2 :
+				# Single argument `min()` and `max()` take an iterable.
+				raise self.Unsupported()
+			for arg in node.args :
+				self.__expression( arg )
+			self.__emit( node.func.id, len( node.args ) )
+		elif (
+			isinstance( node.func, ast.Attribute ) and isinstance( node.func.value, ast.Name ) and
+			node.func.value.id == "context"
+		) :
+			if node.func.attr in self.__contextMethods and not node.args :
+				self.__emit( self.__contextMethods[node.func.attr] )
+			elif node.func.attr == "get" and len( node.args ) == 2 :
+				name = self.__constant( node.args[0] )
+				if name is None or not isinstance( name[0], str ) :
+					raise self.Unsupported()
+				self.__expression( node.args[1] )
+				self.__emit( "contextGet", name[0] )
+			else :
+				raise self.Unsupported()
+		else :
+			raise self.Unsupported()
+
+	def __contextName( self, left, right ) :
+
+		name = self.__constant( left )
+		if name is None or not isinstance( name[0], str ) :
+			raise self.Unsupported()
+
+		if not isinstance( right, ast.Name ) or right.id != "context" :
+			raise self.Unsupported()
+
+		return name[0]
+
+	def __constant( self, node ) :
+
+		# Returns a single element tuple containing the value,
+		# or None if the node is not a supported constant.
+
+		if isinstance( node, ast.Name ) and node.id in ( "True", "False" ) :
+			# Python 2
+			value = node.id == "True"
+		elif hasattr( ast, "NameConstant" ) and isinstance( node, ast.NameConstant ) :
+			value = node.value
+		elif isinstance( node, ast.Num ) :
+			value = node.n
+		elif isinstance( node, ast.Str ) :
+			value = node.s
+		elif hasattr( ast, "Constant" ) and isinstance( node, ast.Constant ) :
+			value = node.value
+		else :
+			return None
+
+		if type( value ) not in ( bool, int, float, str ) :
+			raise self.Unsupported()
+
+		if type( value ) == int and not -2**63 <= value < 2**63 :
+			raise self.Unsupported()
+
+		return ( value, )
+
+	def __path( self, node ) :
+
+		result = []
+		while not isinstance( node, ast.Name ) :
+			if not isinstance( node, ast.Subscript ) :
+				raise self.Unsupported()
+			index = node.slice.value if isinstance( node.slice, ast.Index ) else node.slice
+			index = self.__constant( index )
+			if index is None or not isinstance( index[0], str ) :
+				raise self.Unsupported()
+			result.insert( 0, index[0] )
+			node = node.value
+
+		result.insert( 0, node.id )
+		return result
+
+	def __emit( self, opcode, argument = None ) :
+
+		self.__instructions.append( ( opcode, argument ) )
+
 ##########################################################################
 # Functions for setting plug values.
 ##########################################################################
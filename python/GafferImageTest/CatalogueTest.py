@@ -36,6 +36,7 @@
 
 import os
 import threading
+import time
 import stat
 import shutil
 import six
@@ -206,6 +207,38 @@ class CatalogueTest( GafferImageTest.ImageTestCase ) :
 		self.assertEqual( c["imageIndex"].getValue(), 1 )
 		self.assertImagesEqual( r["out"], c["out"] )
 
+	def testMemoryUsage( self ) :
+
+		c = GafferImage.Catalogue()
+
+		r = GafferImage.ImageReader()
+		r["fileName"].setValue( "${GAFFER_ROOT}/python/GafferImageTest/images/noisyRamp.exr" )
+
+		driver = self.sendImage( r["out"], c, close = False )
+		uncompressedMemoryUsage = c["images"][0].memoryUsage()
+		self.assertGreater( uncompressedMemoryUsage, 0 )
+
+		# Completed renders are compressed on a background thread,
+		# and must be decompressed losslessly on demand.
+
+		driver.close()
+		timeout = time.time() + 30.0
+		while c["images"][0].memoryUsage() >= uncompressedMemoryUsage and time.time() < timeout :
+			time.sleep( 0.01 )
+
+		self.assertLess( c["images"][0].memoryUsage(), uncompressedMemoryUsage )
+		self.assertGreater( c["images"][0].memoryUsage(), 0 )
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+		self.assertImagesEqual( r["out"], c["out"] )
+
+		# Images loaded from disk have no rendered
+		# data to account for.
+
+		c["images"].addChild( c.Image.load( "${GAFFER_ROOT}/python/GafferImageTest/images/checker.exr" ) )
+		self.assertEqual( c["images"][1].memoryUsage(), 0 )
+
 	def testDisplayDriverAOVGrouping( self ) :
 
 		c = GafferImage.Catalogue()
@@ -125,6 +125,23 @@ class ConstantTest( GafferImageTest.ImageTestCase ) :
 			)
 		)
 
+	def testConstantTiles( self ) :
+
+		c = GafferImage.Constant()
+		c["color"].setValue( imath.Color4f( 0.18, 0.5, 1, 0 ) )
+
+		for channelName in [ "R", "G", "B", "A" ] :
+			tile = c["out"].channelData( channelName, imath.V2i( 0 ), _copy = False )
+			self.assertTrue( GafferImage.ImagePlug.isConstantTile( tile ) )
+			self.assertTrue( tile.isSame( GafferImage.ImagePlug.constantTile( tile[0], _copy = False ) ) )
+
+		# Copies are not recognised as constant tiles, because the test
+		# is based on identity rather than content.
+		self.assertFalse( GafferImage.ImagePlug.isConstantTile( c["out"].channelData( "R", imath.V2i( 0 ) ) ) )
+
+		self.assertTrue( GafferImage.ImagePlug.constantTile( 0, _copy = False ).isSame( GafferImage.ImagePlug.blackTile( _copy = False ) ) )
+		self.assertTrue( GafferImage.ImagePlug.constantTile( 1, _copy = False ).isSame( GafferImage.ImagePlug.whiteTile( _copy = False ) ) )
+
 	def testEnableBehaviour( self ) :
 
 		c = GafferImage.Constant()
@@ -186,5 +186,35 @@ class DeepHoldoutTest( GafferImageTest.ImageTestCase ) :
 		self.assertIn( "__flattened.channelNames", dirtiedPlugs )
 		del cs[:]
 
+	def testOpacityThreshold( self ) :
+
+		representativeImage = GafferImage.ImageReader()
+		representativeImage["fileName"].setValue( self.representativeImagePath )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( representativeImage["out"] )
+		offset["offset"].setValue( imath.V2i( 13, 31 ) )
+
+		holdout = GafferImage.DeepHoldout()
+		holdout["in"].setInput( representativeImage["out"] )
+		holdout["holdout"].setInput( offset["out"] )
+
+		reference = GafferImage.ImageAlgo.image( holdout["out"] )
+
+		cs = GafferTest.CapturingSlot( holdout.plugDirtiedSignal() )
+		holdout["opacityThreshold"].setValue( 0.5 )
+		self.assertIn( "out.channelData", { x[0].relativeName( holdout ) for x in cs } )
+
+		# Compositing stops early, so samples can only be
+		# omitted, and the alpha can be no higher than before.
+
+		thresholded = GafferImage.ImageAlgo.image( holdout["out"] )
+		self.assertNotEqual( thresholded, reference )
+		for a, b in zip( thresholded["A"], reference["A"] ) :
+			self.assertLessEqual( a, b + 1e-6 )
+
+		holdout["opacityThreshold"].setValue( 1 )
+		self.assertEqual( GafferImage.ImageAlgo.image( holdout["out"] ), reference )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -1027,6 +1027,132 @@ class DeepStateTest( GafferImageTest.ImageTestCase ) :
 
 		self.__assertDeepStateProcessing( deleteChannels["out"], referenceFlatten["out"], [ 0, 0, 0, 10 ], [ 0, 0, 0, 10 ], 100, 0.45 )
 
+	def testSortManySamples( self ) :
+
+		# Enough samples per pixel to use the radix sort, with
+		# many identical depths to check that the sort is stable.
+
+		nodes = self.__getMessy( randomValueCount = 200 )
+
+		deepState = GafferImage.DeepState()
+		deepState["in"].setInput( nodes["merge"]["out"] )
+		deepState["deepState"].setValue( GafferImage.DeepState.TargetState.Sorted )
+
+		sortedSamples = self.__getSortedSamples( nodes["values"] )
+
+		sampleOffsets = deepState["out"].sampleOffsets( imath.V2i( 0 ) )
+		self.assertEqual( sampleOffsets[0], 200 )
+
+		for channelName in [ "R", "Z", "ZBack" ] :
+			channelData = deepState["out"].channelData( channelName, imath.V2i( 0 ) )
+			self.assertSimilarList( channelData[:200], [ v[channelName] for v in sortedSamples ], 1e-6, msg = channelName )
+
+	def __manySamplesImage( self, numCopies ) :
+
+		representativeImage = GafferImage.ImageReader()
+		representativeImage["fileName"].setValue( self.representativeImagePath )
+
+		deepMerge = GafferImage.DeepMerge()
+		nodes = [ representativeImage, deepMerge ]
+		for i in range( numCopies ) :
+
+			offset = GafferImage.Offset()
+			offset["in"].setInput( representativeImage["out"] )
+			offset["offset"].setValue( imath.V2i( ( i * 7 ) % 31, ( i * 13 ) % 29 ) )
+
+			depthGrade = self.__createDepthGrade()
+			depthGrade["in"].setInput( offset["out"] )
+			depthGrade["depthOffset"].setValue( ( i * 0.37 ) % 2.0 - 1.0 )
+
+			deepMerge["in"][-1].setInput( depthGrade["out"] )
+			nodes.extend( [ offset, depthGrade ] )
+
+		return deepMerge, nodes
+
+	def testFlattenOpacityThreshold( self ) :
+
+		messy = self.__getMessy( [
+			{ "R":0.25, "G":0.5, "B":1.0, "A":0.5, "Z":10, "ZBack":10 },
+			{ "R":2.0, "G":3.0, "B":4.0, "A":0.5, "Z":20, "ZBack":20 },
+			{ "R":1.0, "G":0.5, "B":0.1, "A":0.5, "Z":30, "ZBack":30 },
+		], 0 )
+
+		deepState = GafferImage.DeepState()
+		deepState["in"].setInput( messy["merge"]["out"] )
+		deepState["deepState"].setValue( GafferImage.DeepState.TargetState.Flat )
+
+		def assertPixel( r, a ) :
+			self.assertAlmostEqual( deepState["out"].channelData( "R", imath.V2i( 0 ) )[0], r, places = 6 )
+			self.assertAlmostEqual( deepState["out"].channelData( "A", imath.V2i( 0 ) )[0], a, places = 6 )
+
+		assertPixel( 0.25 + 2.0 * 0.5 + 1.0 * 0.25, 0.875 )
+
+		# Pruning occluded samples only applies when tidying, and must
+		# not affect flattening.
+
+		deepState["pruneOccluded"].setValue( True )
+		deepState["occludedThreshold"].setValue( 0.5 )
+		assertPixel( 0.25 + 2.0 * 0.5 + 1.0 * 0.25, 0.875 )
+
+		# Lower opacity thresholds stop compositing as soon as the alpha
+		# reaches the threshold.
+
+		deepState["opacityThreshold"].setValue( 0.7 )
+		assertPixel( 0.25 + 2.0 * 0.5, 0.75 )
+
+		deepState["opacityThreshold"].setValue( 0.5 )
+		assertPixel( 0.25, 0.5 )
+
+		# The same applies when the input needs sorting first.
+
+		unsorted = self.__getMessy( list( reversed( messy["values"] ) ), 0 )
+		deepState["in"].setInput( unsorted["merge"]["out"] )
+
+		deepState["opacityThreshold"].setValue( 1.0 )
+		assertPixel( 0.25 + 2.0 * 0.5 + 1.0 * 0.25, 0.875 )
+
+		deepState["opacityThreshold"].setValue( 0.7 )
+		assertPixel( 0.25 + 2.0 * 0.5, 0.75 )
+
+	def __testFlattenPerformance( self, numCopies, opacityThreshold = None ) :
+
+		deepMerge, nodes = self.__manySamplesImage( numCopies )
+
+		deepState = GafferImage.DeepState()
+		deepState["in"].setInput( deepMerge["out"] )
+		deepState["deepState"].setValue( GafferImage.DeepState.TargetState.Flat )
+		if opacityThreshold is not None :
+			deepState["opacityThreshold"].setValue( opacityThreshold )
+
+		GafferImageTest.processTiles( deepMerge["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( deepState["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testFlattenLowDensityPerformance( self ) :
+
+		self.__testFlattenPerformance( 2 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testFlattenMediumDensityPerformance( self ) :
+
+		self.__testFlattenPerformance( 12 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testFlattenHighDensityPerformance( self ) :
+
+		self.__testFlattenPerformance( 48 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testFlattenHighDensityOpacityThresholdPerformance( self ) :
+
+		self.__testFlattenPerformance( 48, opacityThreshold = 0.99 )
+
 if __name__ == "__main__":
 	unittest.main()
 
@@ -370,5 +370,180 @@ class DisplayTest( GafferImageTest.ImageTestCase ) :
 			else :
 				self.assertEqual( t1[tileOriginTuple], t2[tileOriginTuple] )
 
+	def __streamSyntheticImage( self, driverType, port, dataWindow ) :
+
+		node = GafferImage.Display()
+		driverCreatedConnection = GafferImage.Display.driverCreatedSignal().connect( lambda driver, parameters : node.setDriver( driver ) )
+
+		with GafferTest.ParallelAlgoTest.UIThreadCallHandler() as h :
+			GafferImageTest.streamSyntheticBuckets(
+				driverType, dataWindow, dataWindow, [ "R", "G", "B", "A" ],
+				IECore.CompoundData( {
+					"displayHost" : "localhost",
+					"displayPort" : str( port ),
+					"remoteDisplayType" : "GafferImage::GafferDisplayDriver",
+				} )
+			)
+
+		return node
+
+	def testSharedMemoryTransport( self ) :
+
+		server = IECoreImage.DisplayDriverServer()
+		sharedMemoryServer = GafferImage.SharedMemoryDisplayDriverServer( server.portNumber() )
+		self.assertEqual( sharedMemoryServer.portNumber(), server.portNumber() )
+
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 301, 207 ) )
+		viaSocket = self.__streamSyntheticImage( "ClientDisplayDriver", server.portNumber(), dataWindow )
+		viaSharedMemory = self.__streamSyntheticImage( "GafferImage::SharedMemoryDisplayDriver", server.portNumber(), dataWindow )
+
+		self.assertEqual( viaSharedMemory["out"]["channelNames"].getValue(), IECore.StringVectorData( [ "R", "G", "B", "A" ] ) )
+		self.assertImagesEqual( viaSharedMemory["out"], viaSocket["out"] )
+
+	def testSharedMemoryTransportWithSmallBuffer( self ) :
+
+		# Forces bucket data to be split across several messages,
+		# and the ring buffer to wrap around many times.
+
+		server = IECoreImage.DisplayDriverServer()
+		sharedMemoryServer = GafferImage.SharedMemoryDisplayDriverServer( server.portNumber(), bufferSize = 20000 )
+
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 199, 99 ) )
+		viaSocket = self.__streamSyntheticImage( "ClientDisplayDriver", server.portNumber(), dataWindow )
+		viaSharedMemory = self.__streamSyntheticImage( "GafferImage::SharedMemoryDisplayDriver", server.portNumber(), dataWindow )
+
+		self.assertImagesEqual( viaSharedMemory["out"], viaSocket["out"] )
+
+	def testSharedMemoryFallback( self ) :
+
+		server = IECoreImage.DisplayDriverServer()
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 99 ) )
+		parameters = IECore.CompoundData( {
+			"displayHost" : "localhost",
+			"displayPort" : str( server.portNumber() ),
+			"remoteDisplayType" : "GafferImage::GafferDisplayDriver",
+		} )
+
+		with GafferTest.ParallelAlgoTest.UIThreadCallHandler() as h :
+
+			# No SharedMemoryDisplayDriverServer, so we expect the socket to be used.
+			driver = IECoreImage.DisplayDriver.create( "GafferImage::SharedMemoryDisplayDriver", dataWindow, dataWindow, [ "Y" ], parameters )
+			self.assertIsInstance( driver, GafferImage.SharedMemoryDisplayDriver )
+			self.assertFalse( driver.usingSharedMemory() )
+			h.assertCalled()
+			driver.imageClose()
+			del driver
+
+			sharedMemoryServer = GafferImage.SharedMemoryDisplayDriverServer( server.portNumber() )
+			driver = IECoreImage.DisplayDriver.create( "GafferImage::SharedMemoryDisplayDriver", dataWindow, dataWindow, [ "Y" ], parameters )
+			self.assertTrue( driver.usingSharedMemory() )
+			h.assertCalled()
+			driver.imageClose()
+			del driver
+
+			# Shared memory is only used for GafferDisplayDrivers, so other
+			# remote types must use the socket.
+			parameters["remoteDisplayType"] = IECore.StringData( "ImageDisplayDriver" )
+			driver = IECoreImage.DisplayDriver.create( "GafferImage::SharedMemoryDisplayDriver", dataWindow, dataWindow, [ "Y" ], parameters )
+			self.assertFalse( driver.usingSharedMemory() )
+			driver.imageClose()
+
+	def testCompressDriver( self ) :
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( os.path.expandvars( "${GAFFER_ROOT}/python/GafferImageTest/images/checker.exr" ) )
+
+		node = GafferImage.Display()
+		server = IECoreImage.DisplayDriverServer()
+		driverCreatedConnection = GafferImage.Display.driverCreatedSignal().connect( lambda driver, parameters : node.setDriver( driver ) )
+
+		driver = self.Driver.sendImage( imageReader["out"], port = server.portNumber(), close = False )
+		self.assertImagesEqual( imageReader["out"], node["out"] )
+
+		uncompressedMemoryUsage = node.driverMemoryUsage()
+		node.compressDriver()
+		self.assertLess( node.driverMemoryUsage(), uncompressedMemoryUsage )
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+		self.assertImagesEqual( imageReader["out"], node["out"] )
+
+		# Copies share the compressed data.
+
+		copy = GafferImage.Display()
+		copy.setDriver( node.getDriver(), copy = True )
+		self.assertImagesEqual( imageReader["out"], copy["out"] )
+
+		# The driver continues to accept data after compression.
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		tileWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( tileSize ) )
+		channelNames = imageReader["out"]["channelNames"].getValue()
+		driver.sendBucket( tileWindow, [ IECore.FloatVectorData( [ 0.25 ] * tileSize * tileSize ) ] * len( channelNames ) )
+		for channelName in channelNames :
+			self.assertEqual(
+				node["out"].channelData( channelName, imath.V2i( 0 ) ),
+				IECore.FloatVectorData( [ 0.25 ] * tileSize * tileSize )
+			)
+			self.assertEqual(
+				node["out"].channelData( channelName, imath.V2i( tileSize, 0 ) ),
+				imageReader["out"].channelData( channelName, imath.V2i( tileSize, 0 ) )
+			)
+
+		driver.close()
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testCompressionPerformance( self ) :
+
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 3999, 2999 ) )
+		node = self.__streamSyntheticImage( "GafferImage::GafferDisplayDriver", 0, dataWindow )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			node.compressDriver()
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testDecompressionPerformance( self ) :
+
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 3999, 2999 ) )
+		node = self.__streamSyntheticImage( "GafferImage::GafferDisplayDriver", 0, dataWindow )
+		node.compressDriver()
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( node["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSocketTransportPerformance( self ) :
+
+		self.__testTransportPerformance( "ClientDisplayDriver" )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSharedMemoryTransportPerformance( self ) :
+
+		self.__testTransportPerformance( "GafferImage::SharedMemoryDisplayDriver" )
+
+	def __testTransportPerformance( self, driverType ) :
+
+		server = IECoreImage.DisplayDriverServer()
+		sharedMemoryServer = GafferImage.SharedMemoryDisplayDriverServer( server.portNumber() )
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 3999, 2999 ) )
+
+		with GafferTest.ParallelAlgoTest.UIThreadCallHandler() as h :
+			with GafferTest.TestRunner.PerformanceScope() :
+				GafferImageTest.streamSyntheticBuckets(
+					driverType, dataWindow, dataWindow, [ "R", "G", "B", "A" ],
+					IECore.CompoundData( {
+						"displayHost" : "localhost",
+						"displayPort" : str( server.portNumber() ),
+						"remoteDisplayType" : "GafferImage::GafferDisplayDriver",
+					} ),
+					bucketSize = 16
+				)
+
 if __name__ == "__main__":
 	unittest.main()
@@ -249,6 +249,66 @@ class GradeTest( GafferImageTest.ImageTestCase ) :
 		sampler["channels"].setValue( IECore.StringVectorData( [ "B.R", "B.G", "B.B", "B.A" ] ) )
 		self.assertEqual( sampler["color"].getValue(), imath.Color4f( 1 ) )
 
+	def testConstantInput( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 512, 512, 1.000 ) )
+		constant["color"].setValue( imath.Color4f( 0.1, 0.2, 0.3, 0.5 ) )
+
+		grade = GafferImage.Grade()
+		grade["in"].setInput( constant["out"] )
+		grade["multiply"].setValue( imath.Color4f( 2, 2, 2, 1 ) )
+
+		expected = GafferImage.Constant()
+		expected["format"].setValue( GafferImage.Format( 512, 512, 1.000 ) )
+		expected["color"].setValue( imath.Color4f( 0.2, 0.4, 0.6, 0.5 ) )
+
+		self.assertImagesEqual( grade["out"], expected["out"] )
+
+		# Constant input tiles should be processed into constant output
+		# tiles, which are shared between all tile origins.
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		for processUnpremultiplied in ( False, True ) :
+			grade["processUnpremultiplied"].setValue( processUnpremultiplied )
+			self.assertTrue(
+				grade["out"].channelData( "R", imath.V2i( 0 ), _copy = False ).isSame(
+					grade["out"].channelData( "R", imath.V2i( tileSize ), _copy = False )
+				)
+			)
+
+		# When the alpha isn't constant, we must still get the right result.
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 512, 512, 1.000 ) )
+		checker["size"].setValue( imath.V2f( 13 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( checker["out"] )
+		shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "A", "R" ) )
+
+		copyChannels = GafferImage.CopyChannels()
+		copyChannels["in"][0].setInput( constant["out"] )
+		copyChannels["in"][1].setInput( shuffle["out"] )
+		copyChannels["channels"].setValue( "A" )
+
+		grade["in"].setInput( copyChannels["out"] )
+		grade["processUnpremultiplied"].setValue( True )
+		grade["gamma"].setValue( imath.Color4f( 2, 2, 2, 1 ) )
+
+		unpremultiply = GafferImage.Unpremultiply()
+		unpremultiply["in"].setInput( copyChannels["out"] )
+
+		bareGrade = GafferImage.Grade()
+		bareGrade["in"].setInput( unpremultiply["out"] )
+		bareGrade["multiply"].setValue( imath.Color4f( 2, 2, 2, 1 ) )
+		bareGrade["gamma"].setValue( imath.Color4f( 2, 2, 2, 1 ) )
+
+		premultiply = GafferImage.Premultiply()
+		premultiply["in"].setInput( bareGrade["out"] )
+
+		self.assertImagesEqual( grade["out"], premultiply["out"] )
+
 	def testUnpremultiplied( self ) :
 
 		i = GafferImage.ImageReader()
@@ -37,6 +37,7 @@
 
 import os
 import unittest
+import subprocess32 as subprocess
 import imath
 
 import IECore
@@ -306,5 +307,77 @@ class ImagePlugTest( GafferImageTest.ImageTestCase ) :
 			else:
 				self.assertEqual( tileData[i], value )
 
+	def testTileSizeEnvironmentVariable( self ) :
+
+		def tileSize( environmentValue ) :
+
+			env = os.environ.copy()
+			env["GAFFERIMAGE_TILESIZE"] = environmentValue
+			return int(
+				subprocess.check_output(
+					[ "gaffer", "env", "python", "-c", "import GafferImage; print( GafferImage.ImagePlug.tileSize() )" ],
+					env = env, stderr = subprocess.STDOUT, universal_newlines = True
+				).split()[-1]
+			)
+
+		for size in ( 32, 64, 256, 512, 1024 ) :
+			self.assertEqual( tileSize( str( size ) ), size )
+
+		# Invalid values fall back to the default.
+		for size in ( "100", "2048", "notANumber" ) :
+			self.assertEqual( tileSize( size ), 128 )
+
+	# The following tests are intended for comparing the performance of
+	# typical image processing graphs with different tile sizes, by running
+	# them with different values for `GAFFERIMAGE_TILESIZE`. For example :
+	#
+	# GAFFERIMAGE_TILESIZE=64 gaffer test GafferImageTest.ImagePlugTest -performanceOnly -outputFile 64.json
+	# GAFFERIMAGE_TILESIZE=256 gaffer test GafferImageTest.ImagePlugTest -performanceOnly -previousOutputFile 64.json
+
+	def __compGraph( self, script ) :
+
+		script["checker"] = GafferImage.Checkerboard()
+		script["checker"]["format"].setValue( GafferImage.Format( 4096, 2160, 1.000 ) )
+		script["checker"]["size"].setValue( imath.V2f( 37.1 ) )
+
+		script["grade"] = GafferImage.Grade()
+		script["grade"]["in"].setInput( script["checker"]["out"] )
+		script["grade"]["gamma"].setValue( imath.Color4f( 2.2 ) )
+
+		script["blur"] = GafferImage.Blur()
+		script["blur"]["in"].setInput( script["grade"]["out"] )
+		script["blur"]["radius"].setValue( imath.V2f( 10 ) )
+
+		script["resize"] = GafferImage.Resize()
+		script["resize"]["in"].setInput( script["blur"]["out"] )
+		script["resize"]["format"].setValue( GafferImage.Format( 8192, 4320, 1.000 ) )
+
+		script["merge"] = GafferImage.Merge()
+		script["merge"]["in"][0].setInput( script["resize"]["out"] )
+		script["merge"]["in"][1].setInput( script["checker"]["out"] )
+		script["merge"]["operation"].setValue( GafferImage.Merge.Operation.Over )
+
+		return script["merge"]["out"]
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testCompGraphPerformance( self ) :
+
+		script = Gaffer.ScriptNode()
+		image = self.__compGraph( script )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( image )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testCompGraphHashPerformance( self ) :
+
+		script = Gaffer.ScriptNode()
+		image = self.__compGraph( script )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImage.ImageAlgo.imageHash( image )
+
 if __name__ == "__main__":
 	unittest.main()
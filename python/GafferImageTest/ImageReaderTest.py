@@ -463,5 +463,35 @@ class ImageReaderTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertImagesEqual( reader["out"], constant["out"] )
 
+	def testHalfTileStorage( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( os.path.expandvars( "$GAFFER_ROOT/python/GafferImageTest/images/colorbars_half_max.exr" ) )
+
+		halfTileStorage = GafferImage.OpenImageIOReader.getHalfTileStorage()
+		try :
+
+			GafferImage.OpenImageIOReader.setHalfTileStorage( False )
+			Gaffer.ValuePlug.clearCache()
+			floatImage = GafferImage.ImageAlgo.image( reader["out"] )
+			floatMemoryUsage = Gaffer.ValuePlug.cacheMemoryUsage()
+
+			GafferImage.OpenImageIOReader.setHalfTileStorage( True )
+			Gaffer.ValuePlug.clearCache()
+			halfImage = GafferImage.ImageAlgo.image( reader["out"] )
+			halfMemoryUsage = Gaffer.ValuePlug.cacheMemoryUsage()
+
+		finally :
+
+			GafferImage.OpenImageIOReader.setHalfTileStorage( halfTileStorage )
+			Gaffer.ValuePlug.clearCache()
+
+		# The file is stored as half, so the conversion should be lossless.
+		self.assertEqual( halfImage, floatImage )
+		# Without half storage, float tiles are cached both by the internal
+		# reader and by the ImageReader itself. With it, only the half tiles
+		# should be cached.
+		self.assertLess( halfMemoryUsage, floatMemoryUsage / 2 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -1343,5 +1343,100 @@ class ImageWriterTest( GafferImageTest.ImageTestCase ) :
 		reader["refreshCount"].setValue( reader["refreshCount"].getValue() + 1 )
 		self.assertEqual( reader["out"].metadata()["openexr:dwaCompressionLevel"].value, 110.0 )
 
+	def testTiledWriteWithManyRows( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 1000, 700 ) )
+		checker["size"].setValue( imath.V2f( 13 ) )
+
+		crop = GafferImage.Crop()
+		crop["in"].setInput( checker["out"] )
+		crop["area"].setValue( imath.Box2i( imath.V2i( 35, 61 ), imath.V2i( 907, 650 ) ) )
+		crop["affectDisplayWindow"].setValue( False )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( crop["out"] )
+		writer["fileName"].setValue( os.path.join( self.temporaryDirectory(), "test.exr" ) )
+		writer["openexr"]["mode"].setValue( GafferImage.ImageWriter.Mode.Tile )
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		for compression in [ "none", "zip", "piz" ] :
+			writer["openexr"]["compression"].setValue( compression )
+			writer.execute()
+			reader["refreshCount"].setValue( reader["refreshCount"].getValue() + 1 )
+			self.assertImagesEqual( reader["out"], crop["out"], ignoreMetadata = True )
+
+	def __writePerformanceImage( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 2048, 1556 ) )
+
+		transform = GafferImage.ImageTransform()
+		transform["in"].setInput( checker["out"] )
+		transform["transform"]["rotate"].setValue( 10 )
+
+		# Simulate a render with many AOVs.
+		copyChannels = GafferImage.CopyChannels()
+		copyChannels["channels"].setValue( "*" )
+		copyChannels["in"][0].setInput( transform["out"] )
+		shuffles = []
+		for i in range( 0, 5 ) :
+			shuffle = GafferImage.Shuffle()
+			shuffle["in"].setInput( transform["out"] )
+			for c in "RGBA" :
+				shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "aov{}.{}".format( i, c ), c ) )
+			copyChannels["in"][i+1].setInput( shuffle["out"] )
+			shuffles.append( shuffle )
+
+		# Compute everything up front, so we measure only the writing.
+		GafferImageTest.processTiles( copyChannels["out"] )
+
+		return copyChannels, [ checker, transform ] + shuffles
+
+	def __testWritePerformance( self, mode, compression ) :
+
+		image, nodes = self.__writePerformanceImage()
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( image["out"] )
+		writer["fileName"].setValue( os.path.join( self.temporaryDirectory(), "test.exr" ) )
+		writer["openexr"]["mode"].setValue( mode )
+		writer["openexr"]["compression"].setValue( compression )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			writer["task"].execute()
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTiledZipWritePerformance( self ) :
+
+		self.__testWritePerformance( GafferImage.ImageWriter.Mode.Tile, "zip" )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTiledPIZWritePerformance( self ) :
+
+		self.__testWritePerformance( GafferImage.ImageWriter.Mode.Tile, "piz" )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTiledDWAAWritePerformance( self ) :
+
+		self.__testWritePerformance( GafferImage.ImageWriter.Mode.Tile, "dwaa" )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testScanlineZipWritePerformance( self ) :
+
+		self.__testWritePerformance( GafferImage.ImageWriter.Mode.Scanline, "zip" )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testScanlineDWAAWritePerformance( self ) :
+
+		self.__testWritePerformance( GafferImage.ImageWriter.Mode.Scanline, "dwaa" )
+
 if __name__ == "__main__":
 	unittest.main()
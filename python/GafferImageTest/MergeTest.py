@@ -692,6 +692,61 @@ class MergeTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertEqual( merge["out"].dataWindow(), imath.Box2i( imath.V2i( -1024 ), imath.V2i( -512 ) ) )
 
+	def testConstantInputs( self ) :
+
+		constantB = GafferImage.Constant()
+		constantB["format"].setValue( GafferImage.Format( 512, 512, 1.000 ) )
+		constantB["color"].setValue( imath.Color4f( 0, 0.5, 0, 1 ) )
+
+		constantA = GafferImage.Constant()
+		constantA["format"].setValue( GafferImage.Format( 512, 512, 1.000 ) )
+		constantA["color"].setValue( imath.Color4f( 0.5, 0, 0, 0.5 ) )
+
+		merge = GafferImage.Merge()
+		merge["operation"].setValue( GafferImage.Merge.Operation.Over )
+		merge["in"][0].setInput( constantB["out"] )
+		merge["in"][1].setInput( constantA["out"] )
+
+		expected = GafferImage.Constant()
+		expected["format"].setValue( GafferImage.Format( 512, 512, 1.000 ) )
+		expected["color"].setValue( imath.Color4f( 0.5, 0.25, 0, 1 ) )
+
+		self.assertImagesEqual( merge["out"], expected["out"] )
+
+		# Merging constant inputs should produce constant tiles, shared
+		# between all tile origins.
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		for channelName in [ "R", "G", "B", "A" ] :
+			self.assertTrue(
+				merge["out"].channelData( channelName, imath.V2i( 0 ), _copy = False ).isSame(
+					merge["out"].channelData( channelName, imath.V2i( tileSize ), _copy = False )
+				)
+			)
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testConstantInputsPerformance( self ) :
+
+		constantB = GafferImage.Constant()
+		constantB["format"].setValue( GafferImage.Format( 8192, 8192, 1.000 ) )
+		constantB["color"].setValue( imath.Color4f( 0, 0.5, 0, 1 ) )
+
+		constantA = GafferImage.Constant()
+		constantA["format"].setValue( GafferImage.Format( 8192, 8192, 1.000 ) )
+		constantA["color"].setValue( imath.Color4f( 0.5, 0, 0, 0.5 ) )
+
+		merge = GafferImage.Merge()
+		merge["operation"].setValue( GafferImage.Merge.Operation.Over )
+		merge["in"][0].setInput( constantB["out"] )
+		merge["in"][1].setInput( constantA["out"] )
+
+		grade = GafferImage.Grade()
+		grade["in"].setInput( merge["out"] )
+		grade["multiply"].setValue( imath.Color4f( 0.5, 1, 2, 1 ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( grade["out"] )
+
 	def mergePerf( self, operation, mismatch ):
 		r = GafferImage.Checkerboard( "Checkerboard" )
 		r["format"].setValue( GafferImage.Format( 4096, 3112, 1.000 ) )
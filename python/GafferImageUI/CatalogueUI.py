@@ -300,6 +300,11 @@ Gaffer.Metadata.registerNode(
 	- displayPort : `GafferImage.Catalogue.displayDriverServer().portNumber()`
 	- remoteDisplayType : "GafferImage::GafferDisplayDriver"
 	- catalogue:name : The name of the catalogue to render to (optional)
+
+	For renders on the same host, "GafferImage::SharedMemoryDisplayDriver" may
+	be used as the driverType instead, with the same parameters. This transfers
+	pixel data via shared memory rather than a socket, falling back to the socket
+	automatically if shared memory is unavailable.
 	""",
 
 	plugs = {
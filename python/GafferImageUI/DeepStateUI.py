@@ -49,6 +49,7 @@ Gaffer.Metadata.registerNode(
 	single sample.
 	""",
 	"layout:activator:prune", lambda node : node["deepState"].getValue() == GafferImage.DeepState.TargetState.Tidy,
+	"layout:activator:flat", lambda node : node["deepState"].getValue() == GafferImage.DeepState.TargetState.Flat,
 	"layout:activator:pruneOccluded", lambda node : (
 		node["deepState"].getValue() == GafferImage.DeepState.TargetState.Tidy and node["pruneOccluded"].getValue()
 	),
@@ -120,6 +121,20 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"opacityThreshold" : [
+
+			"description",
+			"""
+			When flattening, compositing of each pixel stops as soon as its accumulated
+			alpha reaches this threshold, skipping all samples behind that point. The
+			default of 1 only skips samples which are completely hidden. Lower values
+			can substantially speed up the flattening of dense volumetric renders, at
+			the expense of discarding the contribution of the skipped samples.
+			""",
+			"layout:activator", "flat",
+
+		],
+
 	}
 
 )
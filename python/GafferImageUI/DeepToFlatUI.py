@@ -76,6 +76,19 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"opacityThreshold" : [
+
+			"description",
+			"""
+			Compositing of each pixel stops as soon as its accumulated alpha reaches
+			this threshold, skipping all samples behind that point. The default of 1
+			only skips samples which are completely hidden, and gives an exact result.
+			Lower values can substantially speed up the processing of dense volumetric
+			renders, at the expense of discarding the contribution of the skipped samples.
+			""",
+
+		],
+
 	}
 
 )
@@ -1011,7 +1011,7 @@ class OSLObjectTest( GafferOSLTest.OSLTestCase ) :
 		def checkAffected( expected ) :
 
 			self.assertEqual(
-				{ i[0].getName() for i in cs if i[0].parent() == o["out"] },
+				{ i[0].getName() for i in cs if i[0].parent() == o["out"] and i[0].getName() != "__childBoundsBlock" },
 				set( expected )
 			)
 			del cs[:]
@@ -41,6 +41,7 @@ import IECore
 import IECoreScene
 
 import Gaffer
+import GafferTest
 import GafferOSL
 import GafferOSLTest
 
@@ -929,5 +930,85 @@ class ShadingEngineTest( GafferOSLTest.OSLTestCase ) :
 				imath.Color3f( 1, 2, 3 )
 			)
 
+	def testOutLayer( self ) :
+
+		e = GafferOSL.ShadingEngine( IECoreScene.ShaderNetwork(
+			shaders = {
+				"outLayer" : IECoreScene.Shader( "ImageProcessing/OutLayer", "osl:shader", { "layerName" : "diffuse", "layerColor" : imath.Color3f( 1, 2, 3 ) } ),
+				"outImage" : IECoreScene.Shader( "ImageProcessing/OutImage", "osl:shader" ),
+			},
+			connections = [
+				( ( "outLayer", "layer" ), ( "outImage", "in0" ) ),
+			],
+			output = "outImage"
+		) )
+
+		r = e.shade( self.rectanglePoints() )
+		self.assertEqual( set( r.keys() ), { "Ci", "diffuse.R", "diffuse.G", "diffuse.B" } )
+		self.assertEqual( r["diffuse.R"], IECore.FloatVectorData( [ 1 ] * 100 ) )
+		self.assertEqual( r["diffuse.G"], IECore.FloatVectorData( [ 2 ] * 100 ) )
+		self.assertEqual( r["diffuse.B"], IECore.FloatVectorData( [ 3 ] * 100 ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManyOutputsPerf( self ) :
+
+		# Lots of outputs written from many threads, to highlight any
+		# contention in the accumulation of results.
+
+		shaders = {
+			"outObject" : IECoreScene.Shader( "ObjectProcessing/OutObject", "osl:shader" ),
+		}
+		connections = []
+		for i in range( 0, 12 ) :
+			shaders["out%d" % i] = IECoreScene.Shader( "ObjectProcessing/OutFloat", "osl:shader", { "name" : "f%d" % i, "value" : float( i ) } )
+			connections.append( ( ( "out%d" % i, "primitiveVariable" ), ( "outObject", "in%d" % i ) ) )
+
+		e = GafferOSL.ShadingEngine( IECoreScene.ShaderNetwork(
+			shaders = shaders, connections = connections, output = "outObject"
+		) )
+
+		numPoints = 1000 * 1000
+		points = IECore.CompoundData( {
+			"P" : IECore.V3fVectorData( [ imath.V3f( 0 ) ] * numPoints ),
+		} )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			r = e.shade( points )
+
+		for i in range( 0, 12 ) :
+			self.assertEqual( r["f%d" % i][-1], i )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testImageProcessingPerf( self ) :
+
+		# A representative OSLImage style network, reading
+		# channels as attributes and writing them via debug closures.
+
+		shaders = {
+			"outImage" : IECoreScene.Shader( "ImageProcessing/OutImage", "osl:shader" ),
+		}
+		connections = []
+		for i, channelName in enumerate( [ "R", "G", "B", "A" ] ) :
+			shaders["in" + channelName] = IECoreScene.Shader( "ImageProcessing/InChannel", "osl:shader", { "channelName" : channelName } )
+			shaders["out" + channelName] = IECoreScene.Shader( "ImageProcessing/OutChannel", "osl:shader", { "channelName" : channelName } )
+			connections.append( ( ( "in" + channelName, "channelValue" ), ( "out" + channelName, "channelValue" ) ) )
+			connections.append( ( ( "out" + channelName, "channel" ), ( "outImage", "in%d" % i ) ) )
+
+		e = GafferOSL.ShadingEngine( IECoreScene.ShaderNetwork(
+			shaders = shaders, connections = connections, output = "outImage"
+		) )
+
+		numPoints = 1000 * 1000
+		points = IECore.CompoundData( {
+			"P" : IECore.V3fVectorData( [ imath.V3f( 0 ) ] * numPoints ),
+		} )
+		for channelName in [ "R", "G", "B", "A" ] :
+			points[channelName] = IECore.FloatVectorData( [ 0.5 ] * numPoints )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			r = e.shade( points )
+
+		self.assertEqual( len( r["R"] ), numPoints )
+
 if __name__ == "__main__":
 	unittest.main()
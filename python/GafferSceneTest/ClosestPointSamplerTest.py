@@ -263,6 +263,66 @@ class ClosestPointSamplerTest( GafferSceneTest.SceneTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			sampler["out"].object( "/plane" )
 
+	def testManyPoints( self ) :
+
+		# Sample a dense plane against an identical copy of itself, with
+		# enough vertices to span several sampling blocks. Every vertex
+		# should sample itself exactly.
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 100, 50 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sampler = GafferScene.ClosestPointSampler()
+		sampler["in"].setInput( plane["out"] )
+		sampler["source"].setInput( plane["out"] )
+		sampler["filter"].setInput( planeFilter["out"] )
+		sampler["sourceLocation"].setValue( "/plane" )
+		sampler["primitiveVariables"].setValue( "P uv" )
+		sampler["prefix"].setValue( "sampled:" )
+		sampler["status"].setValue( "sampledStatus" )
+
+		inMesh = sampler["in"].object( "/plane" )
+		outMesh = sampler["out"].object( "/plane" )
+
+		self.assertGreater( len( inMesh["P"].data ), 5000 )
+		self.assertEqual( outMesh["sampledStatus"].data, IECore.BoolVectorData( [ True ] * len( inMesh["P"].data ) ) )
+
+		for i in range( 0, len( inMesh["P"].data ) ) :
+			self.assertTrue( outMesh["sampled:P"].data[i].equalWithAbsError( inMesh["P"].data[i], 0.00001 ) )
+			self.assertTrue( outMesh["sampled:uv"].data[i].equalWithAbsError( inMesh["uv"].data[i], 0.00001 ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManyPrimitiveVariablesPerformance( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 200, 400 ) )
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 1000, 200 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sampler = GafferScene.ClosestPointSampler()
+		sampler["in"].setInput( plane["out"] )
+		sampler["source"].setInput( sphere["out"] )
+		sampler["filter"].setInput( planeFilter["out"] )
+		sampler["sourceLocation"].setValue( "/sphere" )
+		sampler["primitiveVariables"].setValue( "*" )
+		sampler["prefix"].setValue( "sampled:" )
+		sampler["status"].setValue( "sampledStatus" )
+
+		# Precache the input and source objects so we
+		# only measure the sampling itself.
+		sampler["in"].object( "/plane" )
+		sampler["source"].object( "/sphere" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			sampler["out"].object( "/plane" )
+
 	def testPruneSourceLocation( self ) :
 
 		plane = GafferScene.Plane()
@@ -43,6 +43,7 @@ import six
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -487,5 +488,82 @@ class CollectScenesTest( GafferSceneTest.SceneTestCase ) :
 		collect = GafferScene.CollectScenes()
 		self.assertScenesEqual( collect["out"], GafferScene.ScenePlug() )
 
+	def testManyRoots( self ) :
+
+		# Enough roots to trigger parallel evaluation. Results must
+		# be identical to the serial case, with roots merged in order.
+
+		sphere = GafferScene.Sphere()
+		sphere["sets"].setValue( "${collect:rootName} common" )
+
+		options = GafferScene.CustomOptions()
+		options["in"].setInput( sphere["out"] )
+		options["options"].addChild( Gaffer.NameValuePlug( "user:last", "${collect:rootName}" ) )
+		options["options"].addChild( Gaffer.NameValuePlug( "user:${collect:rootName}", "${collect:rootName}" ) )
+
+		roots = [ "root{}".format( i ) for i in range( 0, 50 ) ]
+
+		collect = GafferScene.CollectScenes()
+		collect["in"].setInput( options["out"] )
+		collect["rootNames"].setValue( IECore.StringVectorData( roots ) )
+		collect["mergeGlobals"].setValue( True )
+
+		self.assertSceneValid( collect["out"] )
+
+		self.assertEqual( list( collect["out"].setNames() ), [ roots[0], "common" ] + roots[1:] )
+		self.assertEqual(
+			collect["out"].set( "common" ).value,
+			IECore.PathMatcher( [ "/{}/sphere".format( r ) for r in roots ] )
+		)
+		for root in roots :
+			self.assertEqual( collect["out"].set( root ).value, IECore.PathMatcher( [ "/{}/sphere".format( root ) ] ) )
+
+		globals = collect["out"].globals()
+		self.assertEqual( globals["option:user:last"], IECore.StringData( roots[-1] ) )
+		for root in roots :
+			self.assertEqual( globals["option:user:{}".format( root )], IECore.StringData( root ) )
+
+	def __testSetPerformance( self, numRoots ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["sets"].setValue( "${collect:rootName} common" )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 100 )
+
+		options = GafferScene.CustomOptions()
+		options["in"].setInput( duplicate["out"] )
+		options["options"].addChild( Gaffer.NameValuePlug( "user:${collect:rootName}", "${collect:rootName}" ) )
+
+		collect = GafferScene.CollectScenes()
+		collect["in"].setInput( options["out"] )
+		collect["rootNames"].setValue( IECore.StringVectorData( [ "root{}".format( i ) for i in range( 0, numRoots ) ] ) )
+		collect["mergeGlobals"].setValue( True )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			collect["out"].globals()
+			collect["out"].setNames()
+			collect["out"].set( "common" )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSetPerformance10( self ) :
+
+		self.__testSetPerformance( 10 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSetPerformance100( self ) :
+
+		self.__testSetPerformance( 100 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSetPerformance1000( self ) :
+
+		self.__testSetPerformance( 1000 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -41,6 +41,7 @@ import imath
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -479,5 +480,108 @@ class MergeScenesTest( GafferSceneTest.SceneTestCase ) :
 			[ "set{}".format( i ) for i in range( 0, merge["in"].maxSize() ) ]
 		)
 
+	def testManyInputs( self ) :
+
+		# Enough inputs to trigger parallel evaluation of the inputs.
+		# Results must be identical to the serial case, with inputs
+		# merged in order.
+
+		merge = GafferScene.MergeScenes()
+		merge["attributesMode"].setValue( merge.Mode.Merge )
+		merge["globalsMode"].setValue( merge.Mode.Merge )
+
+		nodes = []
+		for i in range( 0, 20 ) :
+
+			sphere = GafferScene.Sphere()
+			sphere["name"].setValue( "sphere{}".format( i ) )
+			sphere["sets"].setValue( "set{} common".format( i ) )
+
+			group = GafferScene.Group()
+			group["in"][0].setInput( sphere["out"] )
+
+			attributes = GafferScene.CustomAttributes()
+			attributes["in"].setInput( group["out"] )
+			attributes["attributes"].addChild( Gaffer.NameValuePlug( "user:a", i ) )
+			attributes["attributes"].addChild( Gaffer.NameValuePlug( "user:b{}".format( i ), i ) )
+
+			options = GafferScene.CustomOptions()
+			options["in"].setInput( attributes["out"] )
+			options["options"].addChild( Gaffer.NameValuePlug( "user:a", i ) )
+
+			merge["in"][i].setInput( options["out"] )
+			nodes.extend( [ sphere, group, attributes, options ] )
+
+		self.assertSceneValid( merge["out"] )
+
+		self.assertEqual(
+			list( merge["out"].childNames( "/group" ) ),
+			[ "sphere{}".format( i ) for i in range( 0, 20 ) ]
+		)
+
+		attributes = merge["out"].attributes( "/group" )
+		self.assertEqual( attributes["user:a"], IECore.IntData( 19 ) )
+		for i in range( 0, 20 ) :
+			self.assertEqual( attributes["user:b{}".format( i )], IECore.IntData( i ) )
+
+		self.assertEqual( merge["out"].globals()["option:user:a"], IECore.IntData( 19 ) )
+
+		self.assertEqual(
+			list( merge["out"].setNames() ),
+			[ "set0", "common" ] + [ "set{}".format( i ) for i in range( 1, 20 ) ]
+		)
+		self.assertEqual(
+			merge["out"].set( "common" ).value,
+			IECore.PathMatcher( [ "/group/sphere{}".format( i ) for i in range( 0, 20 ) ] )
+		)
+
+		self.assertEqual(
+			merge["out"].bound( "/" ),
+			merge["in"][0].bound( "/" )
+		)
+
+	def __testMergePerformance( self, numInputs ) :
+
+		merge = GafferScene.MergeScenes()
+		merge["attributesMode"].setValue( merge.Mode.Merge )
+
+		nodes = []
+		for i in range( 0, numInputs ) :
+
+			sphere = GafferScene.Sphere()
+			sphere["sets"].setValue( "set{} common".format( i ) )
+
+			duplicate = GafferScene.Duplicate()
+			duplicate["in"].setInput( sphere["out"] )
+			duplicate["target"].setValue( "/sphere" )
+			duplicate["copies"].setValue( 1000 )
+			duplicate["name"].setValue( "sphere{}_".format( i ) )
+
+			group = GafferScene.Group()
+			group["in"][0].setInput( duplicate["out"] )
+
+			attributes = GafferScene.CustomAttributes()
+			attributes["in"].setInput( group["out"] )
+			attributes["attributes"].addChild( Gaffer.NameValuePlug( "user:a", i ) )
+
+			merge["in"][i].setInput( attributes["out"] )
+			nodes.extend( [ sphere, duplicate, group, attributes ] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseScene( merge["out"] )
+			merge["out"].set( "common" )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testMergePerformance10( self ) :
+
+		self.__testMergePerformance( 10 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testMergePerformanceMaxInputs( self ) :
+
+		self.__testMergePerformance( GafferScene.MergeScenes()["in"].maxSize() )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -271,6 +271,94 @@ class RenderControllerTest( GafferSceneTest.SceneTestCase ) :
 
 		del capturedSphere, capturedLightA, capturedLightB
 
+	def testIncrementalLightLinks( self ) :
+
+		sphereA = GafferScene.Sphere()
+		sphereA["name"].setValue( "sphereA" )
+		sphereB = GafferScene.Sphere()
+		sphereB["name"].setValue( "sphereB" )
+
+		lightA = GafferSceneTest.TestLight()
+		lightA["name"].setValue( "lightA" )
+		lightA["sets"].setValue( "A" )
+
+		lightB = GafferSceneTest.TestLight()
+		lightB["name"].setValue( "lightB" )
+		lightB["sets"].setValue( "B" )
+
+		group = GafferScene.Group()
+		for i, node in enumerate( [ sphereA, sphereB, lightA, lightB ] ) :
+			group["in"][i].setInput( node["out"] )
+
+		sphereAFilter = GafferScene.PathFilter()
+		sphereAFilter["paths"].setValue( IECore.StringVectorData( [ "/group/sphereA" ] ) )
+
+		attributesA = GafferScene.StandardAttributes()
+		attributesA["in"].setInput( group["out"] )
+		attributesA["filter"].setInput( sphereAFilter["out"] )
+		attributesA["attributes"]["linkedLights"]["enabled"].setValue( True )
+		attributesA["attributes"]["linkedLights"]["value"].setValue( "A" )
+
+		sphereBFilter = GafferScene.PathFilter()
+		sphereBFilter["paths"].setValue( IECore.StringVectorData( [ "/group/sphereB" ] ) )
+
+		attributesB = GafferScene.StandardAttributes()
+		attributesB["in"].setInput( attributesA["out"] )
+		attributesB["filter"].setInput( sphereBFilter["out"] )
+		attributesB["attributes"]["linkedLights"]["enabled"].setValue( True )
+		attributesB["attributes"]["linkedLights"]["value"].setValue( "B" )
+
+		unrelatedSet = GafferScene.Set()
+		unrelatedSet["in"].setInput( attributesB["out"] )
+		unrelatedSet["name"].setValue( "C" )
+
+		setB = GafferScene.Set()
+		setB["in"].setInput( unrelatedSet["out"] )
+		setB["name"].setValue( "B" )
+		setB["mode"].setValue( GafferScene.Set.Mode.Add )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( setB["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 10 )
+		controller.update()
+
+		capturedSphereA = renderer.capturedObject( "/group/sphereA" )
+		capturedSphereB = renderer.capturedObject( "/group/sphereB" )
+		capturedLightA = renderer.capturedObject( "/group/lightA" )
+		capturedLightB = renderer.capturedObject( "/group/lightB" )
+
+		self.assertEqual( capturedSphereA.capturedLinks( "lights" ), { capturedLightA } )
+		self.assertEqual( capturedSphereB.capturedLinks( "lights" ), { capturedLightB } )
+		self.assertEqual( capturedSphereA.numLinkEdits( "lights" ), 1 )
+		self.assertEqual( capturedSphereB.numLinkEdits( "lights" ), 1 )
+
+		# Editing a set which isn't referenced by the linking
+		# expressions shouldn't relink anything.
+
+		unrelatedSet["paths"].setValue( IECore.StringVectorData( [ "/group/sphereA" ] ) )
+		controller.update()
+		self.assertEqual( capturedSphereA.numLinkEdits( "lights" ), 1 )
+		self.assertEqual( capturedSphereB.numLinkEdits( "lights" ), 1 )
+
+		# Editing set "B" should only relink the sphere linked to it.
+
+		setB["paths"].setValue( IECore.StringVectorData( [ "/group/lightA" ] ) )
+		controller.update()
+		self.assertEqual( capturedSphereA.capturedLinks( "lights" ), { capturedLightA } )
+		self.assertEqual( capturedSphereB.capturedLinks( "lights" ), None )
+		self.assertEqual( capturedSphereA.numLinkEdits( "lights" ), 1 )
+		self.assertEqual( capturedSphereB.numLinkEdits( "lights" ), 2 )
+
+		# Changing the members of set "B" without changing the
+		# lights it contains shouldn't relink anything.
+
+		setB["paths"].setValue( IECore.StringVectorData( [ "/group/lightA", "/group/sphereA" ] ) )
+		controller.update()
+		self.assertEqual( capturedSphereA.numLinkEdits( "lights" ), 1 )
+		self.assertEqual( capturedSphereB.numLinkEdits( "lights" ), 2 )
+
+		del capturedSphereA, capturedSphereB, capturedLightA, capturedLightB
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testLightLinkPerformance( self ) :
 
@@ -527,5 +615,119 @@ class RenderControllerTest( GafferSceneTest.SceneTestCase ) :
 		controller.setMinimumExpansionDepth( 10 )
 		controller.update()
 
+	def testProcessorEditsUpdateOnlyFilteredLocations( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 9 ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["parent"].setValue( "/plane" )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/10" ] ) )
+
+		attributes = GafferScene.StandardAttributes()
+		attributes["in"].setInput( instancer["out"] )
+		attributes["filter"].setInput( pathFilter["out"] )
+		attributes["attributes"]["doubleSided"]["enabled"].setValue( True )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( attributes["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 10 )
+		controller.update()
+
+		capturedSphere10 = renderer.capturedObject( "/plane/instances/sphere/10" )
+		capturedSphere11 = renderer.capturedObject( "/plane/instances/sphere/11" )
+		self.assertEqual( capturedSphere10.numAttributeEdits(), 1 )
+		self.assertEqual( capturedSphere11.numAttributeEdits(), 1 )
+
+		# Editing the Attributes node should only require the
+		# filtered location to be updated.
+
+		attributes["attributes"]["doubleSided"]["value"].setValue( False )
+		self.assertTrue( controller.updateRequired() )
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			controller.update()
+
+		self.assertFalse( controller.updateRequired() )
+		self.assertLessEqual( monitor.plugStatistics( attributes["out"]["attributes"] ).hashCount, 10 )
+		self.assertEqual( capturedSphere10.numAttributeEdits(), 2 )
+		self.assertEqual( capturedSphere10.capturedAttributes().attributes()["doubleSided"], IECore.BoolData( False ) )
+		self.assertEqual( capturedSphere11.numAttributeEdits(), 1 )
+		self.assertNotIn( "doubleSided", capturedSphere11.capturedAttributes().attributes() )
+
+		# Editing the filter changes the locations being modified,
+		# so must still update everything necessary.
+
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/11" ] ) )
+		controller.update()
+
+		self.assertEqual( capturedSphere10.numAttributeEdits(), 3 )
+		self.assertNotIn( "doubleSided", capturedSphere10.capturedAttributes().attributes() )
+		self.assertEqual( capturedSphere11.numAttributeEdits(), 2 )
+		self.assertEqual( capturedSphere11.capturedAttributes().attributes()["doubleSided"], IECore.BoolData( False ) )
+
+		# As should edits upstream of the Attributes node.
+
+		sphere["radius"].setValue( 2 )
+		controller.update()
+
+		capturedSphere10 = renderer.capturedObject( "/plane/instances/sphere/10" )
+		self.assertEqual( capturedSphere10.capturedSamples()[0].bound(), imath.Box3f( imath.V3f( -2 ), imath.V3f( 2 ) ) )
+
+		# And edits to nodes inserted downstream.
+
+		transform = GafferScene.Transform()
+		transform["in"].setInput( attributes["out"] )
+		transform["filter"].setInput( pathFilter["out"] )
+		controller.setScene( transform["out"] )
+		controller.update()
+
+		attributes["attributes"]["doubleSided"]["value"].setValue( True )
+		transform["transform"]["translate"]["x"].setValue( 10 )
+		controller.update()
+
+		capturedSphere11 = renderer.capturedObject( "/plane/instances/sphere/11" )
+		self.assertEqual( capturedSphere11.capturedAttributes().attributes()["doubleSided"], IECore.BoolData( True ) )
+
+		del capturedSphere10, capturedSphere11
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testProcessorEditPerformance( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 1, 50000 ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["parent"].setValue( "/plane" )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/10" ] ) )
+
+		attributes = GafferScene.StandardAttributes()
+		attributes["in"].setInput( instancer["out"] )
+		attributes["filter"].setInput( pathFilter["out"] )
+		attributes["attributes"]["doubleSided"]["enabled"].setValue( True )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( attributes["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 10 )
+		controller.update()
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 10 ) :
+				attributes["attributes"]["doubleSided"]["value"].setValue( i % 2 )
+				controller.update()
+
 if __name__ == "__main__":
 	unittest.main()
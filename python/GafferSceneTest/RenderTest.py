@@ -0,0 +1,171 @@
+##########################################################################
+#
+#  Copyright (c) 2021, Image Engine Design Inc. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import unittest
+
+import imath
+
+import IECore
+
+import Gaffer
+import GafferTest
+import GafferScene
+import GafferSceneTest
+
+class RenderTest( GafferSceneTest.SceneTestCase ) :
+
+	def __animatedScene( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["sphere"] = GafferScene.Sphere()
+
+		script["plane"] = GafferScene.Plane()
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["plane"]["transform"]["translate"]["x"] = context.getFrame()' )
+
+		script["group"] = GafferScene.Group()
+		script["group"]["in"][0].setInput( script["sphere"]["out"] )
+		script["group"]["in"][1].setInput( script["plane"]["out"] )
+
+		script["render"] = GafferScene.Render()
+		script["render"]["in"].setInput( script["group"]["out"] )
+		script["render"]["renderer"].setValue( "Capturing" )
+
+		return script
+
+	def testExecuteSequenceReusesTranslation( self ) :
+
+		script = self.__animatedScene()
+		frames = [ 1, 2, 3 ]
+
+		# Executing each frame separately translates the
+		# whole scene from scratch every time.
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			with Gaffer.Context() as context :
+				for frame in frames :
+					context.setFrame( frame )
+					script["render"]["task"].execute()
+
+		self.assertEqual( monitor.plugStatistics( script["sphere"]["out"]["object"] ).computeCount, len( frames ) )
+
+		# Executing as a sequence only updates the locations
+		# which change between frames.
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as monitor :
+			script["render"]["task"].executeSequence( frames )
+
+		self.assertEqual( monitor.plugStatistics( script["sphere"]["out"]["object"] ).computeCount, 1 )
+		self.assertEqual( monitor.plugStatistics( script["plane"]["out"]["transform"] ).computeCount, len( frames ) )
+
+	def testExecuteSequenceSceneDescriptionMode( self ) :
+
+		# Scene descriptions are written per frame, so should
+		# fall back to executing each frame separately.
+
+		script = self.__animatedScene()
+		script["render"]["mode"].setValue( GafferScene.Render.Mode.SceneDescriptionMode )
+		script["render"]["fileName"].setValue( self.temporaryDirectory() + "/test.####.cap" )
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			script["render"]["task"].executeSequence( [ 1, 2 ] )
+
+		self.assertEqual( monitor.plugStatistics( script["sphere"]["out"]["object"] ).computeCount, 2 )
+
+	def testExecuteSequenceWithVaryingMode( self ) :
+
+		# A renderer can only be shared if the mode is the same
+		# for every frame, so we must fall back to executing each
+		# frame separately.
+
+		script = self.__animatedScene()
+		script["render"]["fileName"].setValue( self.temporaryDirectory() + "/test.####.cap" )
+		script["modeExpression"] = Gaffer.Expression()
+		script["modeExpression"].setExpression(
+			'parent["render"]["mode"] = {} if context.getFrame() < 2 else {}'.format(
+				int( GafferScene.Render.Mode.RenderMode ), int( GafferScene.Render.Mode.SceneDescriptionMode )
+			)
+		)
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			script["render"]["task"].executeSequence( [ 1, 2 ] )
+
+		self.assertEqual( monitor.plugStatistics( script["sphere"]["out"]["object"] ).computeCount, 2 )
+
+	def testSupportsWaitForRender( self ) :
+
+		self.assertTrue( GafferScene.Private.IECoreScenePreview.Renderer.supportsWaitForRender( "Capturing" ) )
+		self.assertFalse( GafferScene.Private.IECoreScenePreview.Renderer.supportsWaitForRender( "OpenGL" ) )
+		self.assertFalse( GafferScene.Private.IECoreScenePreview.Renderer.supportsWaitForRender( "NonExistent" ) )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testExecuteSequencePerformance( self ) :
+
+		# Mostly static scene, with a single animated location.
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 4 ) )
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 99 ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["parent"].setValue( "/plane" )
+
+		script = Gaffer.ScriptNode()
+		script["cube"] = GafferScene.Cube()
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["cube"]["transform"]["translate"]["x"] = context.getFrame()' )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( instancer["out"] )
+		group["in"][1].setInput( script["cube"]["out"] )
+
+		render = GafferScene.Render()
+		render["in"].setInput( group["out"] )
+		render["renderer"].setValue( "Capturing" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			render["task"].executeSequence( list( range( 1, 21 ) ) )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -110,6 +110,112 @@ class RendererAlgoTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( [ s.radius() for s in samples ], [ 0.75, 1.25 ] )
 		self.assertEqual( sampleTimes, [ 0.75, 1.25 ] )
 
+	def testTransformSamples( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["sphere"] = GafferScene.Sphere()
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["sphere"]["transform"]["translate"]["x"] = context.getFrame()' )
+
+		with Gaffer.Context() as c :
+			c["scene:path"] = IECore.InternedStringVectorData( [ "sphere" ] )
+			samples, sampleTimes = GafferScene.RendererAlgo.transformSamples( script["sphere"]["out"], 1, imath.V2f( 0.75, 1.25 ) )
+
+		self.assertEqual( [ s.translation().x for s in samples ], [ 0.75, 1.25 ] )
+		self.assertEqual( sampleTimes, [ 0.75, 1.25 ] )
+
+		# The hash varies with the frame, because the expression reads
+		# it, but the value doesn't. We expect a single static sample.
+
+		script["expression"].setExpression( 'parent["sphere"]["transform"]["translate"]["x"] = 0 * context.getFrame()' )
+
+		with Gaffer.Context() as c :
+			c.setFrame( 0.75 )
+			h1 = script["sphere"]["out"].transformHash( "/sphere" )
+			c.setFrame( 1.25 )
+			self.assertNotEqual( script["sphere"]["out"].transformHash( "/sphere" ), h1 )
+
+		with Gaffer.Context() as c :
+			c["scene:path"] = IECore.InternedStringVectorData( [ "sphere" ] )
+			samples, sampleTimes = GafferScene.RendererAlgo.transformSamples( script["sphere"]["out"], 1, imath.V2f( 0.75, 1.25 ) )
+
+		self.assertEqual( samples, [ imath.M44f() ] )
+		self.assertEqual( sampleTimes, [] )
+
+	def testObjectSamplesWithRepeatedHashes( self ) :
+
+		# Switch from an animated sphere to a static one at frame 1. The
+		# Switch passes through the hash of its active input, so the samples
+		# from the static sphere have identical hashes, even though the
+		# index is computed from the frame.
+
+		script = Gaffer.ScriptNode()
+
+		script["frame"] = GafferTest.FrameNode()
+
+		script["animatedSphere"] = GafferScene.Sphere()
+		script["animatedSphere"]["type"].setValue( GafferScene.Sphere.Type.Primitive )
+		script["animatedSphere"]["radius"].setInput( script["frame"]["output"] )
+
+		script["staticSphere"] = GafferScene.Sphere()
+		script["staticSphere"]["type"].setValue( GafferScene.Sphere.Type.Primitive )
+		script["staticSphere"]["radius"].setValue( 2 )
+
+		script["switch"] = Gaffer.Switch()
+		script["switch"].setup( GafferScene.ScenePlug() )
+		script["switch"]["in"][0].setInput( script["animatedSphere"]["out"] )
+		script["switch"]["in"][1].setInput( script["staticSphere"]["out"] )
+
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["switch"]["index"] = 1 if context.getFrame() >= 1 else 0' )
+
+		Gaffer.ValuePlug.clearCache()
+
+		with Gaffer.Context() as c :
+			c["scene:path"] = IECore.InternedStringVectorData( [ "sphere" ] )
+			with Gaffer.PerformanceMonitor() as m :
+				samples, sampleTimes = GafferScene.RendererAlgo.objectSamples( script["switch"]["out"], 4, imath.V2f( 0.5, 1.5 ), _copy = False )
+
+		self.assertEqual( sampleTimes, [ 0.5, 0.75, 1.0, 1.25, 1.5 ] )
+		self.assertEqual( [ s.radius() for s in samples ], [ 0.5, 0.75, 2.0, 2.0, 2.0 ] )
+
+		# Samples with identical hashes should share the same
+		# object, and only be computed once.
+
+		self.assertTrue( samples[2].isSame( samples[3] ) )
+		self.assertTrue( samples[2].isSame( samples[4] ) )
+		self.assertEqual( m.plugStatistics( script["switch"]["out"]["object"] ).computeCount, 3 )
+		self.assertEqual( m.plugStatistics( script["animatedSphere"]["out"]["object"] ).computeCount, 2 )
+		self.assertEqual( m.plugStatistics( script["staticSphere"]["out"]["object"] ).computeCount, 1 )
+
+		# Static objects should only be computed once.
+
+		script["staticSphere"]["radius"].setValue( 3 )
+		with Gaffer.Context() as c :
+			c["scene:path"] = IECore.InternedStringVectorData( [ "sphere" ] )
+			with Gaffer.PerformanceMonitor() as m :
+				samples, sampleTimes = GafferScene.RendererAlgo.objectSamples( script["staticSphere"]["out"], 4, imath.V2f( 0.5, 1.5 ) )
+
+		self.assertEqual( [ s.radius() for s in samples ], [ 3.0 ] )
+		self.assertEqual( sampleTimes, [] )
+		self.assertEqual( m.plugStatistics( script["staticSphere"]["out"]["object"] ).computeCount, 1 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testDeformationBlurPerformance( self ) :
+
+		frame = GafferTest.FrameNode()
+
+		sphere = GafferScene.Sphere()
+		sphere["type"].setValue( sphere.Type.Primitive )
+		sphere["divisions"].setValue( imath.V2i( 1000 ) )
+		sphere["radius"].setInput( frame["output"] )
+
+		with Gaffer.Context() as c :
+			c["scene:path"] = IECore.InternedStringVectorData( [ "sphere" ] )
+			with GafferTest.TestRunner.PerformanceScope() :
+				GafferScene.RendererAlgo.objectSamples( sphere["out"], 8, imath.V2f( 0.75, 1.25 ), _copy = False )
+
 	def testNonInterpolableObjectSamples( self ) :
 
 		frame = GafferTest.FrameNode()
@@ -189,6 +295,124 @@ class RendererAlgoTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( capturedCamera.capturedSamples(), [ expectedCamera( 0.75 ), expectedCamera( 1.25 ) ] )
 		self.assertEqual( capturedCamera.capturedSampleTimes(), [ 0.75, 1.25 ] )
 
+	def testOutputScene( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		attributes = GafferScene.StandardAttributes()
+		attributes["in"].setInput( sphere["out"] )
+		attributes["attributes"]["linkedLights"]["enabled"].setValue( True )
+		attributes["attributes"]["linkedLights"]["value"].setValue( "A" )
+
+		lightA = GafferSceneTest.TestLight()
+		lightA["name"].setValue( "lightA" )
+		lightA["sets"].setValue( "A" )
+
+		lightB = GafferSceneTest.TestLight()
+		lightB["name"].setValue( "lightB" )
+
+		camera = GafferScene.Camera()
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( attributes["out"] )
+		group["in"][1].setInput( lightA["out"] )
+		group["in"][2].setInput( lightB["out"] )
+		group["in"][3].setInput( camera["out"] )
+
+		options = GafferScene.StandardOptions()
+		options["in"].setInput( group["out"] )
+		options["options"]["renderCamera"]["enabled"].setValue( True )
+		options["options"]["renderCamera"]["value"].setValue( "/group/camera" )
+
+		renderSets = GafferScene.RendererAlgo.RenderSets( options["out"] )
+		sceneGlobals = options["out"].globals()
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+		)
+		GafferScene.RendererAlgo.outputScene( options["out"], sceneGlobals, renderSets, renderer )
+
+		capturedCamera = renderer.capturedObject( "/group/camera" )
+		self.assertIsNotNone( capturedCamera )
+		self.assertIsNone( renderer.capturedObject( "gaffer:defaultCamera" ) )
+
+		capturedLightA = renderer.capturedObject( "/group/lightA" )
+		capturedLightB = renderer.capturedObject( "/group/lightB" )
+		self.assertIsNotNone( capturedLightA )
+		self.assertIsNotNone( capturedLightB )
+
+		# Light links are output after the traversal, so should
+		# be correct even though the sphere may have been output
+		# before the lights.
+
+		capturedSphere = renderer.capturedObject( "/group/sphere" )
+		self.assertEqual( capturedSphere.capturedLinks( "lights" ), { capturedLightA } )
+		self.assertEqual( capturedSphere.numLinkEdits( "lights" ), 1 )
+
+		# Cameras and lights should not be output as objects too.
+
+		self.assertEqual( capturedCamera.capturedLinks( "lights" ), None )
+		self.assertEqual( capturedLightA.capturedLinks( "lights" ), None )
+
+		# Default camera should be output if no camera is specified.
+
+		options["options"]["renderCamera"]["enabled"].setValue( False )
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+		)
+		GafferScene.RendererAlgo.outputScene( options["out"], options["out"].globals(), renderSets, renderer )
+		self.assertIsNotNone( renderer.capturedObject( "gaffer:defaultCamera" ) )
+
+		# And invalid cameras should be an error.
+
+		options["options"]["renderCamera"]["enabled"].setValue( True )
+		options["options"]["renderCamera"]["value"].setValue( "/i/dont/exist" )
+		with self.assertRaisesRegex( Exception, "does not exist" ) :
+			GafferScene.RendererAlgo.outputScene( options["out"], options["out"].globals(), renderSets, renderer )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSceneTranslationPerformance( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 4 ) )
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 199 ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["parent"].setValue( "/plane" )
+
+		lightPlane = GafferScene.Plane()
+		lightPlane["name"].setValue( "lightPlane" )
+		lightPlane["divisions"].setValue( imath.V2i( 9 ) )
+
+		light = GafferSceneTest.TestLight()
+
+		lightInstancer = GafferScene.Instancer()
+		lightInstancer["in"].setInput( lightPlane["out"] )
+		lightInstancer["prototypes"].setInput( light["out"] )
+		lightInstancer["parent"].setValue( "/lightPlane" )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( instancer["out"] )
+		group["in"][1].setInput( lightInstancer["out"] )
+
+		render = GafferScene.Render()
+		render["in"].setInput( group["out"] )
+		render["renderer"].setValue( "Capturing" )
+
+		# Compute the scene up front, so we're measuring the cost of
+		# translation rather than the cost of computing the scene.
+		GafferSceneTest.traverseScene( render["in"] )
+
+		with Gaffer.Context() as c :
+			c["scene:render:sceneTranslationOnly"] = IECore.BoolData( True )
+			with GafferTest.TestRunner.PerformanceScope() :
+				render["task"].execute()
+
 	def tearDown( self ) :
 
 		GafferSceneTest.SceneTestCase.tearDown( self )
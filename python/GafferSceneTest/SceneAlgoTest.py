@@ -40,8 +40,10 @@ import unittest
 import six
 
 import IECore
+import IECoreScene
 
 import Gaffer
+import GafferTest
 import GafferImage
 import GafferScene
 import GafferSceneTest
@@ -1378,5 +1380,280 @@ class SceneAlgoTest( GafferSceneTest.SceneTestCase ) :
 			IECore.PathMatcher( [  "/group/defaultLight", "/group/nonDefaultLight" ] )
 		)
 
+	def __wideScene( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 1000, 500 ) )
+
+		sphere = GafferScene.Sphere()
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		return instancer, [ plane, sphere, planeFilter ]
+
+	def __deepScene( self ) :
+
+		# A binary tree, with each level grouping two
+		# copies of the level below.
+
+		sphere = GafferScene.Sphere()
+
+		loop = Gaffer.Loop()
+		loop.setup( GafferScene.ScenePlug() )
+		loop["in"].setInput( sphere["out"] )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( loop["previous"] )
+		group["in"][1].setInput( loop["previous"] )
+		loop["next"].setInput( group["out"] )
+		loop["iterations"].setValue( 17 )
+
+		return loop, [ sphere, group ]
+
+	def testTraverseDeepHierarchy( self ) :
+
+		loop, nodes = self.__deepScene()
+		loop["iterations"].setValue( 6 )
+
+		paths = IECore.PathMatcher()
+		GafferScene.SceneAlgo.matchingPaths( IECore.PathMatcher( [ "/..." ] ), loop["out"], paths )
+		leafPaths = [ p for p in paths.paths() if "sphere" in p ]
+		self.assertEqual( len( leafPaths ), 64 )
+		self.assertIn( "/group/group1/group/group1/group/group1/sphere1", leafPaths )
+		self.assertIn( "/group/group/group/group/group/group/sphere", leafPaths )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTraverseWideHierarchyPerformance( self ) :
+
+		scene, nodes = self.__wideScene()
+		GafferSceneTest.traverseScene( scene["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseScene( scene["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testTraverseDeepHierarchyPerformance( self ) :
+
+		scene, nodes = self.__deepScene()
+		GafferSceneTest.traverseScene( scene["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseScene( scene["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testMatchingPathsWideHierarchyPerformance( self ) :
+
+		scene, nodes = self.__wideScene()
+		GafferSceneTest.traverseScene( scene["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferScene.SceneAlgo.matchingPaths( IECore.PathMatcher( [ "/..." ] ), scene["out"], IECore.PathMatcher() )
+
+	def testSpatialIndex( self ) :
+
+		cube1 = GafferScene.Cube()
+		cube1["name"].setValue( "cube1" )
+
+		cube2 = GafferScene.Cube()
+		cube2["name"].setValue( "cube2" )
+		cube2["transform"]["translate"]["x"].setValue( 5 )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( cube1["out"] )
+		group["in"][1].setInput( cube2["out"] )
+		group["transform"]["translate"]["y"].setValue( 1 )
+
+		paths = IECore.PathMatcher( [ "/group/cube1", "/group/cube2", "/group/doesNotExist" ] )
+		index = GafferScene.SceneAlgo.spatialIndex( group["out"], paths )
+
+		self.assertEqual( index.bound(), imath.Box3f( imath.V3f( -0.5, 0.5, -0.5 ), imath.V3f( 5.5, 1.5, 0.5 ) ) )
+
+		# Ray casts
+
+		path, point = index.rayCast( imath.V3f( -10, 1, 0 ), imath.V3f( 1, 0, 0 ) )
+		self.assertEqual( path, "/group/cube1" )
+		self.assertTrue( point.equalWithAbsError( imath.V3f( -0.5, 1, 0 ), 0.00001 ) )
+
+		path, point = index.rayCast( imath.V3f( 10, 1, 0 ), imath.V3f( -1, 0, 0 ) )
+		self.assertEqual( path, "/group/cube2" )
+		self.assertTrue( point.equalWithAbsError( imath.V3f( 5.5, 1, 0 ), 0.00001 ) )
+
+		self.assertIsNone( index.rayCast( imath.V3f( 2.5, 1, -10 ), imath.V3f( 0, 0, 1 ) ) )
+		self.assertIsNone( index.rayCast( imath.V3f( -10, 1, 0 ), imath.V3f( 1, 0, 0 ), maxDistance = 5 ) )
+
+		# Closest points
+
+		path, point = index.closestPoint( imath.V3f( 3, 1, 0 ) )
+		self.assertEqual( path, "/group/cube2" )
+		self.assertTrue( point.equalWithAbsError( imath.V3f( 4.5, 1, 0 ), 0.00001 ) )
+
+		path, point = index.closestPoint( imath.V3f( 2, 1, 0 ) )
+		self.assertEqual( path, "/group/cube1" )
+		self.assertTrue( point.equalWithAbsError( imath.V3f( 0.5, 1, 0 ), 0.00001 ) )
+
+		self.assertIsNone( index.closestPoint( imath.V3f( 2.5, 1, 0 ), maxDistance = 1 ) )
+
+		# Frustum queries
+
+		self.assertEqual(
+			index.frustumQuery( [ imath.Plane3f( imath.V3f( 1, 0, 0 ), 2 ) ] ),
+			IECore.PathMatcher( [ "/group/cube2" ] )
+		)
+		self.assertEqual(
+			index.frustumQuery( [ imath.Plane3f( imath.V3f( 0, 1, 0 ), 0 ) ] ),
+			IECore.PathMatcher( [ "/group/cube1", "/group/cube2" ] )
+		)
+		self.assertEqual(
+			index.frustumQuery( [ imath.Plane3f( imath.V3f( 0, -1, 0 ), 0 ) ] ),
+			IECore.PathMatcher()
+		)
+
+		# Caching
+
+		self.assertTrue( GafferScene.SceneAlgo.spatialIndex( group["out"], paths ).isSame( index ) )
+
+		cube2["transform"]["translate"]["x"].setValue( 10 )
+		index2 = GafferScene.SceneAlgo.spatialIndex( group["out"], paths )
+		self.assertFalse( index2.isSame( index ) )
+
+		path, point = index2.closestPoint( imath.V3f( 3, 1, 0 ) )
+		self.assertEqual( path, "/group/cube1" )
+
+		# Filters
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/group/cube2" ] ) )
+		index3 = GafferScene.SceneAlgo.spatialIndex( pathFilter["out"], group["out"] )
+		path, point = index3.closestPoint( imath.V3f( 3, 1, 0 ) )
+		self.assertEqual( path, "/group/cube2" )
+
+	def testPrimitiveEvaluator( self ) :
+
+		cube = GafferScene.Cube()
+		group = GafferScene.Group()
+		group["in"][0].setInput( cube["out"] )
+
+		evaluator = GafferScene.SceneAlgo.primitiveEvaluator( group["out"], "/group/cube" )
+		self.assertIsInstance( evaluator, IECoreScene.MeshPrimitiveEvaluator )
+		self.assertTrue( GafferScene.SceneAlgo.primitiveEvaluator( group["out"], "/group/cube" ).isSame( evaluator ) )
+		self.assertIsNone( GafferScene.SceneAlgo.primitiveEvaluator( group["out"], "/group" ) )
+
+	def testSpatialQueryCachesAreCleared( self ) :
+
+		cube = GafferScene.Cube()
+		group = GafferScene.Group()
+		group["in"][0].setInput( cube["out"] )
+
+		paths = IECore.PathMatcher( [ "/group/cube" ] )
+		evaluator = GafferScene.SceneAlgo.primitiveEvaluator( group["out"], "/group/cube" )
+		index = GafferScene.SceneAlgo.spatialIndex( group["out"], paths )
+		self.assertTrue( GafferScene.SceneAlgo.primitiveEvaluator( group["out"], "/group/cube" ).isSame( evaluator ) )
+		self.assertTrue( GafferScene.SceneAlgo.spatialIndex( group["out"], paths ).isSame( index ) )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertFalse( GafferScene.SceneAlgo.primitiveEvaluator( group["out"], "/group/cube" ).isSame( evaluator ) )
+		self.assertFalse( GafferScene.SceneAlgo.spatialIndex( group["out"], paths ).isSame( index ) )
+
+	def testSpatialIndexMemoryUsage( self ) :
+
+		cube = GafferScene.Cube()
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 100 ) )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( cube["out"] )
+		group["in"][1].setInput( plane["out"] )
+
+		# The index must account for the evaluators it references,
+		# and hence their acceleration structures too.
+
+		cubeIndex = GafferScene.SceneAlgo.spatialIndex( group["out"], IECore.PathMatcher( [ "/group/cube" ] ) )
+		planeIndex = GafferScene.SceneAlgo.spatialIndex( group["out"], IECore.PathMatcher( [ "/group/plane" ] ) )
+		bothIndex = GafferScene.SceneAlgo.spatialIndex( group["out"], IECore.PathMatcher( [ "/group/cube", "/group/plane" ] ) )
+
+		self.assertGreater( planeIndex.memoryUsage(), plane["out"].object( "/plane" ).memoryUsage() )
+		self.assertGreater( planeIndex.memoryUsage(), cubeIndex.memoryUsage() )
+		self.assertGreater( bothIndex.memoryUsage(), planeIndex.memoryUsage() )
+
+		# Instances sharing an evaluator should only count it once.
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( cube["out"] )
+		instancer["parent"].setValue( "/plane" )
+
+		oneInstanceIndex = GafferScene.SceneAlgo.spatialIndex( instancer["out"], IECore.PathMatcher( [ "/plane/instances/cube/0" ] ) )
+		allInstancesIndex = GafferScene.SceneAlgo.spatialIndex( instancer["out"], IECore.PathMatcher( [ "/plane/instances/cube/*" ] ) )
+		evaluatorMemoryUsage = oneInstanceIndex.memoryUsage()
+		self.assertLess( allInstancesIndex.memoryUsage(), evaluatorMemoryUsage * 101 * 101 )
+
+	def __rayCastPerformanceScene( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["type"].setValue( GafferScene.Sphere.Type.Mesh )
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 99 ) )
+		plane["dimensions"].setValue( imath.V2f( 200 ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["parent"].setValue( "/plane" )
+
+		origins = IECore.V3fVectorData( [
+			imath.V3f( x, y, 10 )
+			for x in range( -100, 100, 4 )
+			for y in range( -100, 100, 4 )
+		] )
+
+		return instancer, IECore.PathMatcher( [ "/plane/instances/sphere/*" ] ), origins
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSpatialIndexRayCastPerformance( self ) :
+
+		instancer, paths, origins = self.__rayCastPerformanceScene()
+		index = GafferScene.SceneAlgo.spatialIndex( instancer["out"], paths )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for origin in origins :
+				index.rayCast( origin, imath.V3f( 0, 0, -1 ) )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testBruteForceRayCastPerformance( self ) :
+
+		# Baseline for `testSpatialIndexRayCastPerformance()`, testing
+		# every object for every ray.
+
+		instancer, paths, origins = self.__rayCastPerformanceScene()
+		# Build evaluators outside of the timed section, as
+		# `testSpatialIndexRayCastPerformance()` does.
+		GafferSceneTest.bruteForceRayCasts( instancer["out"], paths, IECore.V3fVectorData(), imath.V3f( 0, 0, -1 ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.bruteForceRayCasts( instancer["out"], paths, origins, imath.V3f( 0, 0, -1 ) )
+
+	def testBruteForceRayCastsMatchSpatialIndex( self ) :
+
+		instancer, paths, origins = self.__rayCastPerformanceScene()
+		origins = IECore.V3fVectorData( [ origins[i] for i in range( 0, len( origins ), 50 ) ] )
+		index = GafferScene.SceneAlgo.spatialIndex( instancer["out"], paths )
+
+		self.assertEqual(
+			GafferSceneTest.bruteForceRayCasts( instancer["out"], paths, origins, imath.V3f( 0, 0, -1 ) ),
+			len( [ o for o in origins if index.rayCast( o, imath.V3f( 0, 0, -1 ) ) is not None ] )
+		)
+
 if __name__ == "__main__":
 	unittest.main()
@@ -374,6 +374,99 @@ class SceneNodeTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( plane["out"].childBounds( "/plane" ), imath.Box3f() )
 		self.assertEqual( sphere["out"].childBounds( "/sphere" ), imath.Box3f() )
 
+	def testChildBoundsBlocks( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 1, 999 ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["parent"].setValue( "/plane" )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/500" ] ) )
+
+		transform = GafferScene.Transform()
+		transform["in"].setInput( instancer["out"] )
+		transform["filter"].setInput( pathFilter["out"] )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( transform["out"] )
+
+		def assertChildBoundsEqual() :
+
+			for blockSize in ( 1, 64, 1000, 2000 ) :
+				GafferScene.SceneNode.setChildBoundsBlockSize( 0 )
+				expected = group["out"].childBounds( "/group/plane/instances/sphere" )
+				GafferScene.SceneNode.setChildBoundsBlockSize( blockSize )
+				self.assertEqual( group["out"].childBounds( "/group/plane/instances/sphere" ), expected )
+
+			return expected
+
+		b = assertChildBoundsEqual()
+
+		transform["transform"]["translate"]["y"].setValue( 1000 )
+		b2 = assertChildBoundsEqual()
+		self.assertEqual( b2.max().y, b.max().y + 1000 )
+
+		transform["transform"]["translate"]["y"].setValue( 0 )
+		self.assertEqual( assertChildBoundsEqual(), b )
+
+	def testChildBoundsBlockPassThrough( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		attributes = GafferScene.CustomAttributes()
+		attributes["in"].setInput( sphere["out"] )
+		self.assertTrue( attributes["out"]["__childBoundsBlock"].getInput().isSame( sphere["out"]["__childBoundsBlock"] ) )
+
+		transform = GafferScene.Transform()
+		transform["in"].setInput( sphere["out"] )
+		self.assertIsNone( transform["out"]["__childBoundsBlock"].getInput() )
+
+	def __childBoundsPerformance( self, blockSize ) :
+
+		sphere = GafferScene.Sphere()
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 1, 999999 ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["parent"].setValue( "/plane" )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/plane/instances/sphere/500" ] ) )
+
+		transform = GafferScene.Transform()
+		transform["in"].setInput( instancer["out"] )
+		transform["filter"].setInput( pathFilter["out"] )
+
+		GafferScene.SceneNode.setChildBoundsBlockSize( blockSize )
+		transform["out"].childBounds( "/plane/instances/sphere" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 10 ) :
+				transform["transform"]["translate"]["y"].setValue( i )
+				transform["out"].childBounds( "/plane/instances/sphere" )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testChildBoundsBlocksPerformance( self ) :
+
+		self.__childBoundsPerformance( blockSize = 1024 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testChildBoundsPerformance( self ) :
+
+		# Baseline for `testChildBoundsBlocksPerformance()`.
+		self.__childBoundsPerformance( blockSize = 0 )
+
 	def testEnabledEvaluationUsesGlobalContext( self ) :
 
 		script = Gaffer.ScriptNode()
@@ -398,12 +491,14 @@ class SceneNodeTest( GafferSceneTest.SceneTestCase ) :
 		GafferSceneTest.SceneTestCase.setUp( self )
 
 		self.__previousCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.__previousChildBoundsBlockSize = GafferScene.SceneNode.getChildBoundsBlockSize()
 
 	def tearDown( self ) :
 
 		GafferSceneTest.SceneTestCase.tearDown( self )
 
 		Gaffer.ValuePlug.setCacheMemoryLimit( self.__previousCacheMemoryLimit )
+		GafferScene.SceneNode.setChildBoundsBlockSize( self.__previousChildBoundsBlockSize )
 
 if __name__ == "__main__":
 	unittest.main()
@@ -41,6 +41,7 @@ import imath
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -212,6 +213,16 @@ class ScenePlugTest( GafferSceneTest.SceneTestCase ) :
 
 		GafferSceneTest.testManyStringToPathCalls()
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPathScopeConstructionPerformance( self ) :
+
+		GafferSceneTest.testPathScopeConstructionPerformance( 10 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPathScopeHashPerformance( self ) :
+
+		GafferSceneTest.testPathScopeHashPerformance( 10 )
+
 	def testSetPlugs( self ) :
 
 		p = GafferScene.ScenePlug()
@@ -237,5 +248,37 @@ class ScenePlugTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( p.globalsHash(), p["globals"].hash() )
 		self.assertEqual( p.setNamesHash(), p["setNames"].hash() )
 
+	def testCacheMemoryUsageWithSharedData( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["plane"] = GafferScene.Plane()
+		s["plane"]["divisions"].setValue( imath.V2i( 500 ) )
+
+		meshSize = s["plane"]["out"].object( "/plane" ).memoryUsage()
+
+		# Each node in the chain outputs a new mesh, but one that shares
+		# its topology and existing primitive variables with the input.
+
+		out = s["plane"]["out"]
+		for i in range( 0, 5 ) :
+			node = GafferScene.PrimitiveVariables()
+			node["in"].setInput( out )
+			node["primitiveVariables"].addChild( Gaffer.NameValuePlug( "v{}".format( i ), IECore.IntData( i ), flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic ) )
+			s.addChild( node )
+			out = node["out"]
+
+		Gaffer.ValuePlug.clearCache()
+		out.object( "/plane" )
+
+		# The logical usage counts every mesh in full, but the shared
+		# buffers should only be charged to the cache once.
+
+		self.assertGreater( Gaffer.ValuePlug.cacheLogicalMemoryUsage(), meshSize * 5 )
+		self.assertLess( Gaffer.ValuePlug.cacheMemoryUsage(), meshSize * 2 )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( Gaffer.ValuePlug.cacheMemoryUsage(), 0 )
+		self.assertEqual( Gaffer.ValuePlug.cacheLogicalMemoryUsage(), 0 )
+
 if __name__ == "__main__":
 	unittest.main()
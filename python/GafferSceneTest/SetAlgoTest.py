@@ -41,6 +41,7 @@ import six
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -312,6 +313,62 @@ class SetAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertFalse( GafferScene.SetAlgo.affectsSetExpression( Gaffer.IntPlug() ) )
 
+	def testSubExpressionResultsUpdate( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		setA = GafferScene.Set()
+		setA["in"].setInput( sphere["out"] )
+		setA["name"].setValue( "A" )
+		setA["paths"].setValue( IECore.StringVectorData( [ "/a", "/b" ] ) )
+
+		setB = GafferScene.Set()
+		setB["in"].setInput( setA["out"] )
+		setB["name"].setValue( "B" )
+		setB["paths"].setValue( IECore.StringVectorData( [ "/b", "/c" ] ) )
+
+		self.assertCorrectEvaluation( setB["out"], "(A | B) - /c", [ "/a", "/b" ] )
+		self.assertCorrectEvaluation( setB["out"], "(A & B) | /d", [ "/b", "/d" ] )
+		self.assertCorrectEvaluation( setB["out"], "(B & A) | /d", [ "/b", "/d" ] )
+
+		setB["paths"].setValue( IECore.StringVectorData( [ "/c" ] ) )
+
+		self.assertCorrectEvaluation( setB["out"], "(A | B) - /c", [ "/a", "/b" ] )
+		self.assertCorrectEvaluation( setB["out"], "(A & B) | /d", [ "/d" ] )
+		self.assertCorrectEvaluation( setB["out"], "(B & A) | /d", [ "/d" ] )
+
+		# Same structure, different operand order.
+		self.assertCorrectEvaluation( setB["out"], "A - B", [ "/a", "/b" ] )
+		self.assertCorrectEvaluation( setB["out"], "B - A", [ "/c" ] )
+
+		# Wildcards, including ones which match nothing.
+		self.assertCorrectEvaluation( setB["out"], "X* - A", [] )
+		self.assertCorrectEvaluation( setB["out"], "A - X*", [ "/a", "/b" ] )
+		self.assertCorrectEvaluation( setB["out"], "(A | B*) - /a", [ "/b", "/c" ] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManySetsPerformance( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		scene = sphere["out"]
+		sets = []
+		for i in range( 0, 100 ) :
+			s = GafferScene.Set()
+			s["in"].setInput( scene )
+			s["name"].setValue( "set{}".format( i ) )
+			s["paths"].setValue( IECore.StringVectorData( [ "/path{}/child{}".format( i, j ) for j in range( 0, 1000 ) ] ) )
+			sets.append( s )
+			scene = s["out"]
+
+		expression = " | ".join( "(set{} - set{})".format( i, i + 1 ) for i in range( 0, 99 ) )
+		GafferScene.SetAlgo.evaluateSetExpression( expression, scene )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 100 ) :
+				sets[-1]["paths"].setValue( IECore.StringVectorData( [ "/path{}".format( i ) ] ) )
+				GafferScene.SetAlgo.evaluateSetExpression( expression, scene )
+
 	def assertCorrectEvaluation( self, scenePlug, expression, expectedContents ) :
 
 		result = set( GafferScene.SetAlgo.evaluateSetExpression( expression, scenePlug ).paths() )
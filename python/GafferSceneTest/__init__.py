@@ -113,6 +113,7 @@ from .ShaderBallTest import ShaderBallTest
 from .ShaderTweaksTest import ShaderTweaksTest
 from .FilterResultsTest import FilterResultsTest
 from .RendererAlgoTest import RendererAlgoTest
+from .RenderTest import RenderTest
 from .SetAlgoTest import SetAlgoTest
 from .MeshTangentsTest import MeshTangentsTest
 from .ResamplePrimitiveVariablesTest import ResamplePrimitiveVariablesTest
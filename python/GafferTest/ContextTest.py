@@ -583,6 +583,43 @@ class ContextTest( GafferTest.TestCase ) :
 		c["test2"] = "test2" # no change
 		self.assertEqual( c.hash(), hashes[-1] )
 
+	def testInternedStringVectorDataHash( self ) :
+
+		values = [
+			IECore.InternedStringVectorData(),
+			IECore.InternedStringVectorData( [ "a" ] ),
+			IECore.InternedStringVectorData( [ "a", "b" ] ),
+			IECore.InternedStringVectorData( [ "b", "a" ] ),
+			IECore.InternedStringVectorData( [ "a", "b", "c" ] ),
+			IECore.InternedStringVectorData( [ "ab" ] ),
+			IECore.StringVectorData( [ "a", "b" ] ),
+		]
+
+		hashes = []
+		for v in values :
+			c = Gaffer.Context()
+			c["test"] = v
+			hashes.append( c.hash() )
+
+		self.assertEqual( len( set( str( h ) for h in hashes ) ), len( hashes ) )
+
+		# Equal values must hash equally, regardless of
+		# how they were constructed.
+
+		c = Gaffer.Context()
+		c["test"] = IECore.InternedStringVectorData( [ "a", "b" ] )
+		self.assertEqual( c.hash(), hashes[2] )
+		self.assertEqual( Gaffer.Context( c ).hash(), hashes[2] )
+
+		c["test"] = IECore.InternedStringVectorData( [ "a", "b", "c" ] )
+		self.assertEqual( c.hash(), hashes[4] )
+
+		# And the name must still be taken into account.
+
+		c = Gaffer.Context()
+		c["test2"] = IECore.InternedStringVectorData( [ "a", "b" ] )
+		self.assertNotEqual( c.hash(), hashes[2] )
+
 	def testChanged( self ) :
 
 		c = Gaffer.Context()
@@ -1475,6 +1475,74 @@ class ExpressionTest( GafferTest.TestCase ) :
 			s["n"]["user"]["p"].getValue
 		)
 
+	def testNativeEvaluation( self ) :
+
+		# Simple expressions are evaluated natively, without
+		# Python. Check that the results match Python's.
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		s["n"]["user"]["i"] = Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["f"] = Gaffer.FloatPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["s"] = Gaffer.StringPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["b"] = Gaffer.BoolPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( inspect.cleandoc(
+			"""
+			x = context.getFrame() * 2
+			parent["n"]["user"]["i"] = int( x ) + 2 ** 3
+			parent["n"]["user"]["f"] = context.get( "missing", 1.5 ) + -7 // 2
+			parent["n"]["user"]["s"] = "a" + str( 7 % -3 ) if "y" not in context else "b"
+			parent["n"]["user"]["b"] = "x" in context and context["x"] > 1
+			"""
+		) )
+
+		with Gaffer.Context() as c :
+			c.setFrame( 3 )
+			c["x"] = 2
+			self.assertEqual( s["n"]["user"]["i"].getValue(), 14 )
+			self.assertEqual( s["n"]["user"]["f"].getValue(), -2.5 )
+			self.assertEqual( s["n"]["user"]["s"].getValue(), "a-2" )
+			self.assertEqual( s["n"]["user"]["b"].getValue(), True )
+			c["x"] = 0
+			c["y"] = "y"
+			self.assertEqual( s["n"]["user"]["s"].getValue(), "b" )
+			self.assertEqual( s["n"]["user"]["b"].getValue(), False )
+
+		# Errors are still reported by Python.
+
+		s["e"].setExpression( 'parent["n"]["user"]["f"] = context["missing"] + 1' )
+		six.assertRaisesRegex( self, Gaffer.ProcessException, ".*missing", s["n"]["user"]["f"].getValue )
+
+		s["e"].setExpression( 'parent["n"]["user"]["f"] = 1 / context.getFrame()' )
+		with Gaffer.Context() as c :
+			c.setFrame( 0 )
+			six.assertRaisesRegex( self, Gaffer.ProcessException, ".*ZeroDivisionError", s["n"]["user"]["f"].getValue )
+
+	def __parallelExpressionPerformance( self, expression ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		s["n"]["user"]["p"] = Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( expression )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferTest.parallelGetValue( s["n"]["user"]["p"], 100000, "iteration" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testParallelNativePerformance( self ) :
+
+		self.__parallelExpressionPerformance( 'parent["n"]["user"]["p"] = context["iteration"] * 2 + int( context.getFrame() )' )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testParallelPythonPerformance( self ) :
+
+		# As above, but the import prevents native evaluation.
+		self.__parallelExpressionPerformance( 'import math\nparent["n"]["user"]["p"] = context["iteration"] * 2 + int( context.getFrame() )' )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testParallelPerformance( self ):
 		s = Gaffer.ScriptNode()
@@ -207,5 +207,17 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheGetIfCached( "taskParallel" )
 
+	def testSharedCostSerial( self ) :
+
+		GafferTest.testLRUCacheSharedCost( "serial" )
+
+	def testSharedCostParallel( self ) :
+
+		GafferTest.testLRUCacheSharedCost( "parallel" )
+
+	def testSharedCostTaskParallel( self ) :
+
+		GafferTest.testLRUCacheSharedCost( "taskParallel" )
+
 if __name__ == "__main__":
 	unittest.main()
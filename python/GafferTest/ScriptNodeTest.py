@@ -1618,5 +1618,131 @@ class ScriptNodeTest( GafferTest.TestCase ) :
 			with self.assertRaises( IECore.Cancelled ) :
 				s.serialise()
 
+	def testBinarySaveAndLoad( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["n1"] = GafferTest.AddNode()
+		s["n1"]["op1"].setValue( 10 )
+		s["n2"] = GafferTest.AddNode()
+		s["n2"]["op1"].setInput( s["n1"]["sum"] )
+		s["n2"]["op2"].setValue( 2 )
+
+		s["n3"] = Gaffer.Node()
+		s["n3"]["user"]["v"] = Gaffer.V3fPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n3"]["user"]["v"].setValue( imath.V3f( 1, 2, 3 ) )
+		s["n3"]["user"]["s"] = Gaffer.StringPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n3"]["user"]["s"].setValue( "${frame}" )
+		s["n3"]["user"]["f"] = Gaffer.FloatPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n3"]["user"]["f"].setInput( s["n2"]["sum"] )
+
+		s["frameRange"]["start"].setValue( -10 )
+		s["variables"].addChild( Gaffer.NameValuePlug( "test", "test", flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic ) )
+
+		s["fileName"].setValue( self.temporaryDirectory() + "/test.gfrb" )
+		s.save()
+
+		s2 = Gaffer.ScriptNode()
+		s2["fileName"].setValue( s["fileName"].getValue() )
+		s2.load()
+
+		self.assertEqual( s2["n1"]["op1"].getValue(), 10 )
+		self.assertTrue( s2["n2"]["op1"].getInput().isSame( s2["n1"]["sum"] ) )
+		self.assertEqual( s2["n2"]["op2"].getValue(), 2 )
+		self.assertEqual( s2["n2"]["sum"].getValue(), 12 )
+		self.assertEqual( s2["n3"]["user"]["v"].getValue(), imath.V3f( 1, 2, 3 ) )
+		self.assertEqual( s2["n3"]["user"]["s"].getValue(), "${frame}" )
+		self.assertTrue( s2["n3"]["user"]["f"].getInput().isSame( s2["n2"]["sum"] ) )
+		self.assertEqual( s2["frameRange"]["start"].getValue(), -10 )
+		self.assertEqual( s2["variables"]["test"]["value"].getValue(), "test" )
+		self.assertFalse( s2["unsavedChanges"].getValue() )
+
+		# The binary and text serialisations should be interchangeable.
+
+		s2["fileName"].setValue( self.temporaryDirectory() + "/test.gfr" )
+		s2.save()
+
+		s3 = Gaffer.ScriptNode()
+		s3["fileName"].setValue( s2["fileName"].getValue() )
+		s3.load()
+
+		self.assertEqual( s3.serialise(), s.serialise() )
+
+	def testBinaryExecuteFileWithNameClashes( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n1"] = GafferTest.AddNode()
+		s["n1"]["op1"].setValue( 1 )
+		s["n2"] = GafferTest.AddNode()
+		s["n2"]["op1"].setInput( s["n1"]["sum"] )
+
+		fileName = self.temporaryDirectory() + "/test.gfrb"
+		s.serialiseToFile( fileName )
+
+		# Node names clash, so the new nodes will be renamed.
+		# Values and connections must still be applied to them.
+		s.executeFile( fileName )
+
+		self.assertEqual( s["n3"]["op1"].getValue(), 1 )
+		self.assertTrue( s["n4"]["op1"].getInput().isSame( s["n3"]["sum"] ) )
+		self.assertTrue( s["n2"]["op1"].getInput().isSame( s["n1"]["sum"] ) )
+
+	def testBinarySaveAndLoadIndexedChildren( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		# Spreadsheet rows are reordered, so their names no longer
+		# match their indices.
+
+		s["sheet"] = Gaffer.Spreadsheet()
+		s["sheet"]["rows"].addColumn( Gaffer.IntPlug( "i" ) )
+		s["sheet"]["rows"].addRow()["cells"]["i"]["value"].setValue( 1 )
+		s["sheet"]["rows"].addRow()["cells"]["i"]["value"].setValue( 2 )
+		s["sheet"]["rows"].reorderChildren( [ s["sheet"]["rows"][0], s["sheet"]["rows"][2], s["sheet"]["rows"][1] ] )
+
+		# The second element of the ArrayPlug is only created when
+		# the first is connected.
+
+		s["add"] = GafferTest.AddNode()
+		s["array"] = GafferTest.ArrayPlugNode()
+		s["array"]["in"][0].setInput( s["add"]["sum"] )
+		s["array"]["in"][1].setValue( 5 )
+		self.assertEqual( len( s["array"]["in"] ), 2 )
+
+		s["fileName"].setValue( self.temporaryDirectory() + "/test.gfrb" )
+		s.save()
+
+		s2 = Gaffer.ScriptNode()
+		s2["fileName"].setValue( s["fileName"].getValue() )
+		s2.load()
+
+		self.assertEqual( s2["sheet"]["rows"][1]["cells"]["i"]["value"].getValue(), 2 )
+		self.assertEqual( s2["sheet"]["rows"][2]["cells"]["i"]["value"].getValue(), 1 )
+
+		self.assertEqual( len( s2["array"]["in"] ), 2 )
+		self.assertTrue( s2["array"]["in"][0].getInput().isSame( s2["add"]["sum"] ) )
+		self.assertEqual( s2["array"]["in"][1].getValue(), 5 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testBinaryLoadPerformance( self ) :
+
+		s = Gaffer.ScriptNode()
+		previous = None
+		for i in range( 0, 10000 ) :
+			n = GafferTest.AddNode()
+			n["op2"].setValue( i )
+			if previous is not None :
+				n["op1"].setInput( previous["sum"] )
+			s.addChild( n )
+			previous = n
+
+		s["fileName"].setValue( self.temporaryDirectory() + "/test.gfrb" )
+		s.save()
+
+		s2 = Gaffer.ScriptNode()
+		s2["fileName"].setValue( s["fileName"].getValue() )
+		with GafferTest.TestRunner.PerformanceScope() :
+			s2.load()
+
 if __name__ == "__main__":
 	unittest.main()
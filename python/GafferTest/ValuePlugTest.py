@@ -92,6 +92,23 @@ class ValuePlugTest( GafferTest.TestCase ) :
 		v4 = n["out"].getValue( _copy=False )
 		self.assertTrue( v4.isSame( v3 ) )
 
+	def testCacheLogicalMemoryUsage( self ) :
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( Gaffer.ValuePlug.cacheMemoryUsage(), 0 )
+		self.assertEqual( Gaffer.ValuePlug.cacheLogicalMemoryUsage(), 0 )
+
+		n = GafferTest.CachingTestNode()
+		n["in"].setValue( "d" )
+		n["out"].getValue()
+
+		self.assertGreater( Gaffer.ValuePlug.cacheMemoryUsage(), 0 )
+		self.assertGreaterEqual( Gaffer.ValuePlug.cacheLogicalMemoryUsage(), Gaffer.ValuePlug.cacheMemoryUsage() )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( Gaffer.ValuePlug.cacheMemoryUsage(), 0 )
+		self.assertEqual( Gaffer.ValuePlug.cacheLogicalMemoryUsage(), 0 )
+
 	def testSettable( self ) :
 
 		p1 = Gaffer.IntPlug( direction = Gaffer.Plug.Direction.In )
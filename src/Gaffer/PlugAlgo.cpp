@@ -232,6 +232,29 @@ ValuePlugPtr typedObjectValuePlug( const std::string &name, Plug::Direction dire
 	return result;
 }
 
+template<typename PlugType>
+bool setTypedPlugValue( ValuePlug *plug, const IECore::Data *value )
+{
+	typedef IECore::TypedData<typename PlugType::ValueType> DataType;
+	if( auto data = runTimeCast<const DataType>( value ) )
+	{
+		static_cast<PlugType *>( plug )->setValue( data->readable() );
+		return true;
+	}
+	return false;
+}
+
+template<typename PlugType>
+bool setTypedObjectPlugValue( ValuePlug *plug, const IECore::Data *value )
+{
+	if( auto data = runTimeCast<const typename PlugType::ValueType>( value ) )
+	{
+		static_cast<PlugType *>( plug )->setValue( data );
+		return true;
+	}
+	return false;
+}
+
 }
 
 namespace Gaffer
@@ -475,6 +498,67 @@ IECore::DataPtr extractDataFromPlug( const ValuePlug *plug )
 
 }
 
+bool setValueFromData( ValuePlug *plug, const IECore::Data *value )
+{
+	switch( static_cast<Gaffer::TypeId>(plug->typeId()) )
+	{
+		case FloatPlugTypeId :
+			return setTypedPlugValue<FloatPlug>( plug, value );
+		case IntPlugTypeId :
+			return setTypedPlugValue<IntPlug>( plug, value );
+		case StringPlugTypeId :
+			return setTypedPlugValue<StringPlug>( plug, value );
+		case BoolPlugTypeId :
+			return setTypedPlugValue<BoolPlug>( plug, value );
+		case V2iPlugTypeId :
+			return setTypedPlugValue<V2iPlug>( plug, value );
+		case V3iPlugTypeId :
+			return setTypedPlugValue<V3iPlug>( plug, value );
+		case V2fPlugTypeId :
+			return setTypedPlugValue<V2fPlug>( plug, value );
+		case V3fPlugTypeId :
+			return setTypedPlugValue<V3fPlug>( plug, value );
+		case Color3fPlugTypeId :
+			return setTypedPlugValue<Color3fPlug>( plug, value );
+		case Color4fPlugTypeId :
+			return setTypedPlugValue<Color4fPlug>( plug, value );
+		case Box2fPlugTypeId :
+			return setTypedPlugValue<Box2fPlug>( plug, value );
+		case Box2iPlugTypeId :
+			return setTypedPlugValue<Box2iPlug>( plug, value );
+		case Box3fPlugTypeId :
+			return setTypedPlugValue<Box3fPlug>( plug, value );
+		case Box3iPlugTypeId :
+			return setTypedPlugValue<Box3iPlug>( plug, value );
+		case M44fPlugTypeId :
+			return setTypedPlugValue<M44fPlug>( plug, value );
+		case M33fPlugTypeId :
+			return setTypedPlugValue<M33fPlug>( plug, value );
+		case FloatVectorDataPlugTypeId :
+			return setTypedObjectPlugValue<FloatVectorDataPlug>( plug, value );
+		case IntVectorDataPlugTypeId :
+			return setTypedObjectPlugValue<IntVectorDataPlug>( plug, value );
+		case StringVectorDataPlugTypeId :
+			return setTypedObjectPlugValue<StringVectorDataPlug>( plug, value );
+		case InternedStringVectorDataPlugTypeId :
+			return setTypedObjectPlugValue<InternedStringVectorDataPlug>( plug, value );
+		case BoolVectorDataPlugTypeId :
+			return setTypedObjectPlugValue<BoolVectorDataPlug>( plug, value );
+		case V2iVectorDataPlugTypeId :
+			return setTypedObjectPlugValue<V2iVectorDataPlug>( plug, value );
+		case V3fVectorDataPlugTypeId :
+			return setTypedObjectPlugValue<V3fVectorDataPlug>( plug, value );
+		case Color3fVectorDataPlugTypeId :
+			return setTypedObjectPlugValue<Color3fVectorDataPlug>( plug, value );
+		case M44fVectorDataPlugTypeId :
+			return setTypedObjectPlugValue<M44fVectorDataPlug>( plug, value );
+		case M33fVectorDataPlugTypeId :
+			return setTypedObjectPlugValue<M33fVectorDataPlug>( plug, value );
+		default :
+			return false;
+	}
+}
+
 } // namespace PlugAlgo
 
 } // namespace Gaffer
@@ -49,9 +49,11 @@
 #include "Gaffer/TypedPlug.h"
 
 #include "IECore/Exception.h"
+#include "IECore/FileIndexedIO.h"
 #include "IECore/MessageHandler.h"
 #include "IECore/SimpleTypedData.h"
 
+#include "boost/algorithm/string/predicate.hpp"
 #include "boost/bind.hpp"
 #include "boost/bind/placeholders.hpp"
 #include "boost/filesystem/convenience.hpp"
@@ -231,6 +233,37 @@ std::string readFile( const std::string &fileName )
 	return s;
 }
 
+const IECore::InternedString g_serialisationEntry( "serialisation" );
+const IECore::InternedString g_binaryDataEntry( "binaryData" );
+
+bool isBinaryFileName( const std::string &fileName )
+{
+	return boost::ends_with( fileName, ".gfrb" );
+}
+
+// Reads either a text or binary script, returning the
+// binary data if there is any.
+IECore::ConstCompoundObjectPtr readScript( const std::string &fileName, std::string &serialisation )
+{
+	if( !isBinaryFileName( fileName ) )
+	{
+		serialisation = readFile( fileName );
+		return nullptr;
+	}
+
+	IECore::IndexedIOPtr io = new IECore::FileIndexedIO( fileName, IECore::IndexedIO::rootPath, IECore::IndexedIO::Read );
+	IECore::ConstCompoundObjectPtr file = IECore::runTimeCast<const IECore::CompoundObject>( IECore::Object::load( io, "script" ) );
+	const IECore::StringData *serialisationData = file ? file->member<IECore::StringData>( g_serialisationEntry ) : nullptr;
+	const IECore::CompoundObject *binaryData = file ? file->member<IECore::CompoundObject>( g_binaryDataEntry ) : nullptr;
+	if( !serialisationData || !binaryData )
+	{
+		throw IECore::IOException( "File \"" + fileName + "\" is not a valid binary script" );
+	}
+
+	serialisation = serialisationData->readable();
+	return binaryData;
+}
+
 const IECore::InternedString g_scriptName( "script:name" );
 const IECore::InternedString g_frame( "frame" );
 const IECore::InternedString g_frameStart( "frameRange:start" );
@@ -681,6 +714,20 @@ std::string ScriptNode::serialise( const Node *parent, const Set *filter ) const
 
 void ScriptNode::serialiseToFile( const std::string &fileName, const Node *parent, const Set *filter ) const
 {
+	if( isBinaryFileName( fileName ) )
+	{
+		IECore::CompoundObjectPtr binaryData;
+		const std::string s = serialiseInternal( parent, filter, &binaryData );
+
+		IECore::CompoundObjectPtr file = new IECore::CompoundObject;
+		file->members()[g_serialisationEntry] = new IECore::StringData( s );
+		file->members()[g_binaryDataEntry] = binaryData;
+
+		IECore::IndexedIOPtr io = new IECore::FileIndexedIO( fileName, IECore::IndexedIO::rootPath, IECore::IndexedIO::Exclusive | IECore::IndexedIO::Write );
+		file->save( io, "script" );
+		return;
+	}
+
 	std::string s = serialiseInternal( parent, filter );
 
 	std::ofstream f( fileName.c_str() );
@@ -699,13 +746,14 @@ void ScriptNode::serialiseToFile( const std::string &fileName, const Node *paren
 
 bool ScriptNode::execute( const std::string &serialisation, Node *parent, bool continueOnError )
 {
-	return executeInternal( serialisation, parent, continueOnError, "" );
+	return executeInternal( serialisation, nullptr, parent, continueOnError, "" );
 }
 
 bool ScriptNode::executeFile( const std::string &fileName, Node *parent, bool continueOnError )
 {
-	const std::string serialisation = readFile( fileName );
-	return executeInternal( serialisation, parent, continueOnError, fileName );
+	std::string serialisation;
+	IECore::ConstCompoundObjectPtr binaryData = readScript( fileName, serialisation );
+	return executeInternal( serialisation, binaryData.get(), parent, continueOnError, fileName );
 }
 
 bool ScriptNode::load( bool continueOnError)
@@ -713,12 +761,13 @@ bool ScriptNode::load( bool continueOnError)
 	DirtyPropagationScope dirtyScope;
 
 	const std::string fileName = fileNamePlug()->getValue();
-	const std::string s = readFile( fileName );
+	std::string s;
+	IECore::ConstCompoundObjectPtr binaryData = readScript( fileName, s );
 
 	deleteNodes();
 	variablesPlug()->clearChildren();
 
-	const bool result = executeInternal( s, nullptr, continueOnError, fileName );
+	const bool result = executeInternal( s, binaryData.get(), nullptr, continueOnError, fileName );
 
 	UndoScope undoDisabled( this, UndoScope::Disabled );
 	unsavedChangesPlug()->setValue( false );
@@ -754,16 +803,16 @@ bool ScriptNode::importFile( const std::string &fileName, Node *parent, bool con
 	return result;
 }
 
-std::string ScriptNode::serialiseInternal( const Node *parent, const Set *filter ) const
+std::string ScriptNode::serialiseInternal( const Node *parent, const Set *filter, IECore::CompoundObjectPtr *binaryData ) const
 {
 	if( !g_serialiseFunction )
 	{
 		throw IECore::Exception( "Serialisation not available - please link to libGafferBindings." );
 	}
-	return g_serialiseFunction( parent ? parent : this, filter );
+	return g_serialiseFunction( parent ? parent : this, filter, binaryData );
 }
 
-bool ScriptNode::executeInternal( const std::string &serialisation, Node *parent, bool continueOnError, const std::string &context )
+bool ScriptNode::executeInternal( const std::string &serialisation, const IECore::CompoundObject *binaryData, Node *parent, bool continueOnError, const std::string &context )
 {
 	if( !g_executeFunction )
 	{
@@ -776,7 +825,7 @@ bool ScriptNode::executeInternal( const std::string &serialisation, Node *parent
 	m_executing = true;
 	try
 	{
-		result = g_executeFunction( this, serialisation, parent ? parent : this, continueOnError, context );
+		result = g_executeFunction( this, serialisation, binaryData, parent ? parent : this, continueOnError, context );
 	}
 	catch( ... )
 	{
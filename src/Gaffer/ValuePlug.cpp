@@ -43,14 +43,21 @@
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
 #include "Gaffer/Process.h"
 
+#include "IECore/CompoundData.h"
+#include "IECore/CompoundObject.h"
+#include "IECore/DataAlgo.h"
 #include "IECore/MessageHandler.h"
+#include "IECore/VectorTypedData.h"
 
 #include "boost/bind.hpp"
 #include "boost/format.hpp"
 
+#include "tbb/concurrent_hash_map.h"
 #include "tbb/enumerable_thread_specific.h"
 
+#include <algorithm>
 #include <atomic>
+#include <unordered_map>
 
 using namespace Gaffer;
 
@@ -525,6 +532,194 @@ bool spawnsTasks( const ComputeProcessKey &key )
 
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// Shared buffer accounting
+//
+// Many computes pass large buffers through unchanged - a deformer leaves
+// the topology of a mesh untouched, and a node modifying one primitive
+// variable leaves all the others alone. Thanks to IECore's copy-on-write
+// Data, such buffers are shared in memory between all the results that
+// reference them, but `Object::memoryUsage()` charges them in full to each
+// one. We track large buffers separately so that the compute cache charges
+// each only once, for as long as any cached value references it.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Smaller buffers are just charged to each cached value as usual, keeping
+// the bookkeeping overhead in proportion to the savings.
+const size_t g_minimumSharedBufferSize = 64 * 1024;
+
+// Functor for use with `IECore::dispatch()`, returning the address of
+// the copy-on-write storage for vector data, or null for other types.
+struct BufferAddress
+{
+
+	template<typename T>
+	const void *operator()( const IECore::TypedData<std::vector<T>> *data ) const
+	{
+		return &data->readable();
+	}
+
+	const void *operator()( const IECore::Data *data ) const
+	{
+		return nullptr;
+	}
+
+};
+
+using Buffer = std::pair<const void *, size_t>;
+using Buffers = std::vector<Buffer>;
+
+using CacheDataEnumerators = std::unordered_map<IECore::TypeId, ValuePlug::CacheDataEnumerator>;
+
+CacheDataEnumerators &cacheDataEnumerators()
+{
+	static CacheDataEnumerators g_enumerators;
+	return g_enumerators;
+}
+
+std::vector<ValuePlug::CacheClearer> &cacheClearers()
+{
+	static std::vector<ValuePlug::CacheClearer> g_clearers;
+	return g_clearers;
+}
+
+void appendBuffers( const IECore::Object *object, Buffers &buffers )
+{
+	if( !object )
+	{
+		return;
+	}
+
+	if( auto compoundData = IECore::runTimeCast<const IECore::CompoundData>( object ) )
+	{
+		for( const auto &member : compoundData->readable() )
+		{
+			appendBuffers( member.second.get(), buffers );
+		}
+		return;
+	}
+	else if( auto data = IECore::runTimeCast<const IECore::Data>( object ) )
+	{
+		if( const void *address = IECore::dispatch( data, BufferAddress() ) )
+		{
+			const size_t size = data->memoryUsage();
+			if( size >= g_minimumSharedBufferSize )
+			{
+				buffers.push_back( Buffer( address, size ) );
+			}
+		}
+		return;
+	}
+	else if( auto compoundObject = IECore::runTimeCast<const IECore::CompoundObject>( object ) )
+	{
+		for( const auto &member : compoundObject->members() )
+		{
+			appendBuffers( member.second.get(), buffers );
+		}
+		return;
+	}
+
+	const CacheDataEnumerators &enumerators = cacheDataEnumerators();
+	if( enumerators.empty() )
+	{
+		return;
+	}
+
+	const std::function<void ( const IECore::Data * )> dataFunctor = [&buffers] ( const IECore::Data *data ) {
+		appendBuffers( data, buffers );
+	};
+
+	for( IECore::TypeId typeId = object->typeId(); typeId != IECore::InvalidTypeId; typeId = IECore::RunTimeTyped::baseTypeId( typeId ) )
+	{
+		auto it = enumerators.find( typeId );
+		if( it != enumerators.end() )
+		{
+			it->second( object, dataFunctor );
+		}
+	}
+}
+
+// Returns the distinct large buffers referenced by `object`.
+Buffers sharedBuffers( const IECore::Object *object )
+{
+	Buffers result;
+	appendBuffers( object, result );
+	std::sort( result.begin(), result.end() );
+	result.erase( std::unique( result.begin(), result.end() ), result.end() );
+	return result;
+}
+
+// Reference counts buffers held by cached values.
+class SharedBufferRegistry
+{
+
+	public :
+
+		SharedBufferRegistry()
+			:	m_sharedMemoryUsage( 0 )
+		{
+		}
+
+		// Adds a reference to `buffer`, returning its size if this
+		// is the first reference, and 0 otherwise.
+		size_t acquire( const Buffer &buffer )
+		{
+			Map::accessor accessor;
+			if( m_map.insert( accessor, buffer.first ) )
+			{
+				accessor->second = 1;
+				return buffer.second;
+			}
+			accessor->second++;
+			m_sharedMemoryUsage += buffer.second;
+			return 0;
+		}
+
+		// Removes a reference to `buffer`, returning its size if this
+		// was the last reference, and 0 otherwise.
+		size_t release( const Buffer &buffer )
+		{
+			Map::accessor accessor;
+			if( !m_map.find( accessor, buffer.first ) )
+			{
+				assert( false );
+				return 0;
+			}
+			if( --accessor->second == 0 )
+			{
+				m_map.erase( accessor );
+				return buffer.second;
+			}
+			m_sharedMemoryUsage -= buffer.second;
+			return 0;
+		}
+
+		// Returns the memory that would be used if every reference
+		// beyond the first had its own copy of the buffer.
+		size_t sharedMemoryUsage() const
+		{
+			return m_sharedMemoryUsage;
+		}
+
+	private :
+
+		using Map = tbb::concurrent_hash_map<const void *, size_t>;
+		Map m_map;
+		std::atomic<size_t> m_sharedMemoryUsage;
+
+};
+
+SharedBufferRegistry &sharedBufferRegistry()
+{
+	static SharedBufferRegistry g_registry;
+	return g_registry;
+}
+
+} // namespace
+
 class ValuePlug::ComputeProcess : public Process
 {
 
@@ -545,6 +740,11 @@ class ValuePlug::ComputeProcess : public Process
 			return g_cache.currentCost();
 		}
 
+		static size_t cacheLogicalMemoryUsage()
+		{
+			return g_cache.currentCost() + sharedBufferRegistry().sharedMemoryUsage();
+		}
+
 		static void clearCache()
 		{
 			g_cache.clear();
@@ -605,7 +805,7 @@ class ValuePlug::ComputeProcess : public Process
 				/// that.
 				if( !g_cache.getIfCached( processKey ) )
 				{
-					g_cache.set( processKey, process.m_result, process.m_result->memoryUsage() );
+					g_cache.set( processKey, process.m_result, cacheCost( process.m_result.get() ) );
 				}
 				return process.m_result;
 			}
@@ -705,10 +905,52 @@ class ValuePlug::ComputeProcess : public Process
 					break;
 			}
 
-			cost = result->memoryUsage();
+			cost = cacheCost( result.get() );
 			return result;
 		}
 
+		// Returns the cost of a cached value, excluding the shared buffers
+		// which are charged separately by `acquireSharedCost()`.
+		static size_t cacheCost( const IECore::Object *value )
+		{
+			size_t cost = value->memoryUsage();
+			for( const auto &buffer : sharedBuffers( value ) )
+			{
+				cost -= std::min( cost, buffer.second );
+			}
+			return cost;
+		}
+
+		static size_t sharedCost( const IECore::MurmurHash &key, const IECore::ConstObjectPtr &value )
+		{
+			size_t cost = 0;
+			for( const auto &buffer : sharedBuffers( value.get() ) )
+			{
+				cost += buffer.second;
+			}
+			return cost;
+		}
+
+		static size_t acquireSharedCost( const IECore::MurmurHash &key, const IECore::ConstObjectPtr &value )
+		{
+			size_t cost = 0;
+			for( const auto &buffer : sharedBuffers( value.get() ) )
+			{
+				cost += sharedBufferRegistry().acquire( buffer );
+			}
+			return cost;
+		}
+
+		static size_t releaseSharedCost( const IECore::MurmurHash &key, const IECore::ConstObjectPtr &value )
+		{
+			size_t cost = 0;
+			for( const auto &buffer : sharedBuffers( value.get() ) )
+			{
+				cost += sharedBufferRegistry().release( buffer );
+			}
+			return cost;
+		}
+
 		// A cache mapping from ValuePlug::hash() to the result of the previous computation
 		// for that hash. This allows us to cache results for faster repeat evaluation
 		typedef IECorePreview::LRUCache<IECore::MurmurHash, IECore::ConstObjectPtr, IECorePreview::LRUCachePolicy::TaskParallel, ComputeProcessKey> Cache;
@@ -719,7 +961,11 @@ class ValuePlug::ComputeProcess : public Process
 };
 
 const IECore::InternedString ValuePlug::ComputeProcess::staticType( "computeNode:compute" );
-ValuePlug::ComputeProcess::Cache ValuePlug::ComputeProcess::g_cache( cacheGetter, 1024 * 1024 * 1024 * 1, ValuePlug::ComputeProcess::Cache::RemovalCallback(), /* cacheErrors = */ false ); // 1 gig
+ValuePlug::ComputeProcess::Cache ValuePlug::ComputeProcess::g_cache(
+	cacheGetter, 1024 * 1024 * 1024 * 1, // 1 gig
+	ValuePlug::ComputeProcess::Cache::RemovalCallback(), /* cacheErrors = */ false,
+	{ sharedCost, acquireSharedCost, releaseSharedCost }
+);
 
 //////////////////////////////////////////////////////////////////////////
 // SetValueAction implementation
@@ -1173,9 +1419,28 @@ size_t ValuePlug::cacheMemoryUsage()
 	return ComputeProcess::cacheMemoryUsage();
 }
 
+size_t ValuePlug::cacheLogicalMemoryUsage()
+{
+	return ComputeProcess::cacheLogicalMemoryUsage();
+}
+
+void ValuePlug::registerCacheDataEnumerator( IECore::TypeId objectType, CacheDataEnumerator enumerator )
+{
+	cacheDataEnumerators()[objectType] = enumerator;
+}
+
 void ValuePlug::clearCache()
 {
 	ComputeProcess::clearCache();
+	for( const auto &clearer : cacheClearers() )
+	{
+		clearer();
+	}
+}
+
+void ValuePlug::registerCacheClearer( CacheClearer clearer )
+{
+	cacheClearers().push_back( clearer );
 }
 
 size_t ValuePlug::getHashCacheSizeLimit()
@@ -173,7 +173,7 @@ std::string PlugSerialiser::postHierarchy( const Gaffer::GraphComponent *graphCo
 	if( shouldSerialiseInput( plug, serialisation ) )
 	{
 		std::string inputIdentifier = serialisation.identifier( plug->getInput() );
-		if( inputIdentifier.size() )
+		if( inputIdentifier.size() && !serialisation.addInput( plug ) )
 		{
 			result += identifier + ".setInput( " + inputIdentifier + " )\n";
 		}
@@ -45,7 +45,10 @@
 #include "Gaffer/ArrayPlug.h"
 #include "Gaffer/Context.h"
 #include "Gaffer/Plug.h"
+#include "Gaffer/PlugAlgo.h"
 #include "Gaffer/Spreadsheet.h"
+#include "Gaffer/TypeIds.h"
+#include "Gaffer/ValuePlug.h"
 
 #include "IECorePython/ScopedGILLock.h"
 
@@ -89,6 +92,41 @@ bool keyedByIndex( const GraphComponent *parent )
 	;
 }
 
+// Returns the path from `ancestor` to `descendant`, as used by the binary
+// serialisation. This is equivalent to `descendant->relativeName( ancestor )`
+// except that, to match the identifiers used by the text serialisation,
+// children of parents that are `keyedByIndex()` are referred to by index.
+// Since valid names can't start with a digit, the two can't be confused.
+// Returns an empty string if `ancestor` is not an ancestor of `descendant`.
+std::string binaryPath( const GraphComponent *descendant, const GraphComponent *ancestor )
+{
+	std::vector<std::string> components;
+	while( descendant != ancestor )
+	{
+		const GraphComponent *parent = descendant->parent();
+		if( !parent )
+		{
+			return "";
+		}
+		if( keyedByIndex( parent ) )
+		{
+			components.push_back(
+				boost::lexical_cast<std::string>(
+					std::find( parent->children().begin(), parent->children().end(), descendant ) - parent->children().begin()
+				)
+			);
+		}
+		else
+		{
+			components.push_back( descendant->getName().string() );
+		}
+		descendant = parent;
+	}
+
+	std::reverse( components.begin(), components.end() );
+	return boost::algorithm::join( components, "." );
+}
+
 std::string modulePathInternal( const boost::python::object &o )
 {
 	if( !PyObject_HasAttrString( o.ptr(), "__module__" ) )
@@ -141,10 +179,19 @@ std::string modulePathInternal( const boost::python::object &o )
 // Serialisation
 //////////////////////////////////////////////////////////////////////////
 
-Serialisation::Serialisation( const Gaffer::GraphComponent *parent, const std::string &parentName, const Gaffer::Set *filter )
+Serialisation::Serialisation( const Gaffer::GraphComponent *parent, const std::string &parentName, const Gaffer::Set *filter, bool binary )
 	:	m_parent( parent ), m_parentName( parentName ), m_filter( filter ),
 		m_protectParentNamespace( Context::current()->get<bool>( "serialiser:protectParentNamespace", true ) )
 {
+	if( binary )
+	{
+		m_binaryValuePaths = new StringVectorData;
+		m_binaryValues = new ObjectVector;
+		m_binaryInputPaths = new StringVectorData;
+		m_binaryInputSourcePaths = new StringVectorData;
+		m_modules.insert( "Gaffer" );
+	}
+
 	IECorePython::ScopedGILLock gilLock;
 	walk( parent, parentName, acquireSerialiser( parent ), Context::current()->canceller() );
 
@@ -197,6 +244,14 @@ std::string Serialisation::result() const
 
 	result += m_connectionScript;
 
+	// Applied after the connection script, so that any ArrayPlug elements
+	// created by connections made there exist before we try to set values
+	// on them.
+	if( m_binaryValues )
+	{
+		result += "\nGaffer.ScriptNode._applyBinaryData( " + m_parentName + ", " + ( m_protectParentNamespace ? "__children" : "{}" ) + ", __binaryData )\n\n";
+	}
+
 	result += m_postScript;
 
 	if( m_protectParentNamespace )
@@ -207,6 +262,80 @@ std::string Serialisation::result() const
 	return result;
 }
 
+bool Serialisation::addValue( const Gaffer::ValuePlug *plug )
+{
+	if( !m_binaryValues || plug == m_parent )
+	{
+		return false;
+	}
+
+	switch( static_cast<Gaffer::TypeId>( plug->typeId() ) )
+	{
+		case SplineffPlugTypeId :
+		case SplinefColor3fPlugTypeId :
+		case TransformPlugTypeId :
+			// Supported by `extractDataFromPlug()` but not by `setValueFromData()`.
+			return false;
+		default :
+			break;
+	}
+
+	const std::string path = binaryPath( plug, m_parent );
+	if( path.empty() )
+	{
+		return false;
+	}
+
+	DataPtr value;
+	try
+	{
+		value = PlugAlgo::extractDataFromPlug( plug );
+	}
+	catch( const IECore::Exception & )
+	{
+		// Unsupported plug type.
+		return false;
+	}
+
+	m_binaryValuePaths->writable().push_back( path );
+	m_binaryValues->members().push_back( value );
+	return true;
+}
+
+bool Serialisation::addInput( const Gaffer::Plug *plug )
+{
+	if( !m_binaryInputPaths || plug == m_parent || plug->getInput() == m_parent )
+	{
+		return false;
+	}
+
+	const std::string path = binaryPath( plug, m_parent );
+	const std::string sourcePath = binaryPath( plug->getInput(), m_parent );
+	if( path.empty() || sourcePath.empty() )
+	{
+		return false;
+	}
+
+	m_binaryInputPaths->writable().push_back( path );
+	m_binaryInputSourcePaths->writable().push_back( sourcePath );
+	return true;
+}
+
+IECore::CompoundObjectPtr Serialisation::binaryData() const
+{
+	if( !m_binaryValues )
+	{
+		return nullptr;
+	}
+
+	CompoundObjectPtr result = new CompoundObject;
+	result->members()["valuePaths"] = m_binaryValuePaths;
+	result->members()["values"] = m_binaryValues;
+	result->members()["inputPaths"] = m_binaryInputPaths;
+	result->members()["inputSourcePaths"] = m_binaryInputSourcePaths;
+	return result;
+}
+
 std::string Serialisation::modulePath( const IECore::RefCounted *object )
 {
 	boost::python::object o( RefCountedPtr( const_cast<RefCounted *>( object ) ) ); // we can only push non-const objects to python so we need the cast
@@ -65,24 +65,27 @@ namespace
 
 const IECore::InternedString g_omitParentNodePlugValues( "valuePlugSerialiser:omitParentNodePlugValues" );
 
-std::string valueSerialisationWalk( const Gaffer::ValuePlug *plug, const std::string &identifier, Serialisation &serialisation, bool &canCondense )
+// Plugs whose values need serialising, and their identifiers.
+typedef std::vector<std::pair<const ValuePlug *, std::string>> ValueSerialisations;
+
+void valueSerialisationWalk( const Gaffer::ValuePlug *plug, const std::string &identifier, Serialisation &serialisation, bool &canCondense, ValueSerialisations &values )
 {
 	// There's nothing to do if the plug isn't serialisable.
 	if( !plug->getFlags( Plug::Serialisable ) )
 	{
 		canCondense = false;
-		return "";
+		return;
 	}
 
 	// Otherwise we need to get the individual value serialisations
 	// for each child.
 
-	string childSerialisations;
+	ValueSerialisations childValues;
 	bool canCondenseChildren = true;
 	for( ValuePlugIterator childIt( plug ); !childIt.done(); ++childIt )
 	{
 		const std::string childIdentifier = serialisation.childIdentifier( identifier, childIt.base() );
-		childSerialisations += valueSerialisationWalk( childIt->get(), childIdentifier, serialisation, canCondenseChildren );
+		valueSerialisationWalk( childIt->get(), childIdentifier, serialisation, canCondenseChildren, childValues );
 	}
 
 	// The child results alone are sufficient for a complete
@@ -92,7 +95,8 @@ std::string valueSerialisationWalk( const Gaffer::ValuePlug *plug, const std::st
 	if( !canCondenseChildren )
 	{
 		canCondense = false;
-		return childSerialisations;
+		values.insert( values.end(), childValues.begin(), childValues.end() );
+		return;
 	}
 
 	object pythonPlug( ValuePlugPtr( const_cast<ValuePlug *>( plug ) ) );
@@ -103,7 +107,8 @@ std::string valueSerialisationWalk( const Gaffer::ValuePlug *plug, const std::st
 		// because otherwise we hit problems trying to serialise
 		// SplinePlugs.
 		canCondense = false;
-		return childSerialisations;
+		values.insert( values.end(), childValues.begin(), childValues.end() );
+		return;
 	}
 
 	// Alternatively, there may have been no children because we're
@@ -114,19 +119,41 @@ std::string valueSerialisationWalk( const Gaffer::ValuePlug *plug, const std::st
 		if( plug->getInput() || plug->direction() == Plug::Out )
 		{
 			canCondense = false;
-			return "";
+			return;
 		}
 	}
 
-	// Emit the `setValue()` call for this plug.
+	// Serialise the value for this plug.
 
 	if( plug->isSetToDefault() )
 	{
-		return "";
+		return;
 	}
 
-	object pythonValue = pythonPlug.attr( "getValue" )();
-	return identifier + ".setValue( " + ValuePlugSerialiser::valueRepr( pythonValue, &serialisation ) + " )\n";
+	values.push_back( { plug, identifier } );
+}
+
+std::string valueSerialisation( const Gaffer::ValuePlug *plug, const std::string &identifier, Serialisation &serialisation )
+{
+	ValueSerialisations values;
+	bool unused;
+	valueSerialisationWalk( plug, identifier, serialisation, unused, values );
+
+	std::string result;
+	for( const auto &value : values )
+	{
+		// Binary serialisations record values as data where possible.
+		// Otherwise, we emit a `setValue()` call.
+		if( serialisation.addValue( value.first ) )
+		{
+			continue;
+		}
+		object pythonPlug( ValuePlugPtr( const_cast<ValuePlug *>( value.first ) ) );
+		object pythonValue = pythonPlug.attr( "getValue" )();
+		result += value.second + ".setValue( " + ValuePlugSerialiser::valueRepr( pythonValue, &serialisation ) + " )\n";
+	}
+
+	return result;
 }
 
 std::string compoundObjectRepr( const IECore::CompoundObject &o, Serialisation *serialisation )
@@ -234,8 +261,7 @@ std::string ValuePlugSerialiser::postHierarchy( const Gaffer::GraphComponent *gr
 		// appropriate `setValue()` calls for this and all descendants.
 		if( plug->node() != serialisation.parent() || !Context::current()->get<bool>( g_omitParentNodePlugValues, false ) )
 		{
-			bool unused;
-			result = valueSerialisationWalk( plug, identifier, serialisation, unused ) + result;
+			result = valueSerialisation( plug, identifier, serialisation ) + result;
 		}
 	}
 
@@ -44,6 +44,7 @@
 #include "GafferImage/ImageMetadata.h"
 #include "GafferImage/ImageReader.h"
 #include "GafferImage/ImageWriter.h"
+#include "GafferImage/SharedMemoryDisplayDriver.h"
 #include "GafferImage/Text.h"
 
 #include "Gaffer/ArrayPlug.h"
@@ -53,6 +54,8 @@
 #include "Gaffer/ScriptNode.h"
 #include "Gaffer/StringPlug.h"
 
+#include "IECore/MessageHandler.h"
+
 #include "boost/algorithm/string.hpp"
 #include "boost/bind.hpp"
 #include "boost/filesystem/operations.hpp"
@@ -205,7 +208,7 @@ class Catalogue::InternalImage : public ImageNode
 			isRendering( false );
 
 			m_saver = nullptr;
-			if( other->m_saver )
+			if( other->m_saver && other->m_saver->saving() )
 			{
 				m_saver = other->m_saver;
 				m_saver->registerClient( this );
@@ -297,13 +300,24 @@ class Catalogue::InternalImage : public ImageNode
 			}
 
 			// All our drivers have been closed, so the render has completed.
-			// Save the image to disk. We do this in the background because
-			// saving large images with many AOVs takes several seconds.
+			// Compress the image data and save it to disk. We do this in the
+			// background because both can take several seconds for large
+			// images with many AOVs.
 
 			isRendering( false );
 			m_saver = AsynchronousSaver::create( this );
 		}
 
+		size_t memoryUsage() const
+		{
+			size_t result = 0;
+			for( DisplayIterator it( this ); !it.done(); ++it )
+			{
+				result += (*it)->driverMemoryUsage();
+			}
+			return result;
+		}
+
 	protected :
 
 		void hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const override
@@ -420,10 +434,15 @@ class Catalogue::InternalImage : public ImageNode
 			typedef std::shared_ptr<AsynchronousSaver> Ptr;
 			typedef std::weak_ptr<AsynchronousSaver> WeakPtr;
 
+			// Compresses the client's display drivers, and saves the image
+			// if the Catalogue has a directory to save to.
 			static Ptr create( InternalImage *client )
 			{
 				// We use a copy of the image to do the saving, because the original
 				// might be modified on the main thread while we save in the background.
+				// The render is complete, so the copy can share the drivers rather than
+				// copy their data. This also means that compressing the drivers on the
+				// background thread compresses them for the client too.
 
 				InternalImagePtr imageCopy = new InternalImage;
 
@@ -432,20 +451,16 @@ class Catalogue::InternalImage : public ImageNode
 				{
 					Display *display = it->get();
 					DisplayPtr displayCopy = new Display;
-					displayCopy->setDriver( display->getDriver(), /* copy = */ true );
+					displayCopy->setDriver( display->getDriver(), /* copy = */ false );
 					imageCopy->addChild( displayCopy );
 					imageCopy->copyChannels()->inPlugs()->getChild<Plug>( i++ )->setInput( displayCopy->outPlug() );
 				}
 				imageCopy->imageSwitch()->indexPlug()->setValue( 1 );
 
-				// If there's nowhere to save, then a saver is useless, so return null.
+				// If there's nowhere to save, we just compress.
 				const string fileName = client->parent<Catalogue>()->generateFileName( imageCopy->outPlug() );
-				if( fileName.empty() )
-				{
-					return nullptr;
-				}
 
-				// Otherwise, make a saver and schedule its background execution.
+				// Make a saver and schedule its background execution.
 				Ptr saver = Ptr( new AsynchronousSaver( imageCopy, fileName ) );
 				saver->registerClient( client );
 
@@ -474,9 +489,21 @@ class Catalogue::InternalImage : public ImageNode
 				m_thread.join();
 			}
 
+			// Returns true if the image is being saved to a file,
+			// and false if it is only being compressed.
+			bool saving() const
+			{
+				return (bool)m_writer;
+			}
+
 			void registerClient( InternalImage *client )
 			{
-				if( m_imageCopy )
+				if( !saving() )
+				{
+					// Nothing to wrap up.
+					return;
+				}
+				else if( m_imageCopy )
 				{
 					// Still in the process of saving
 					m_clients.insert( client );
@@ -504,6 +531,11 @@ class Catalogue::InternalImage : public ImageNode
 				AsynchronousSaver( InternalImagePtr imageCopy, const std::string &fileName )
 					:	m_imageCopy( imageCopy )
 				{
+					if( fileName.empty() )
+					{
+						return;
+					}
+
 					// Set up an ImageWriter to do the actual saving.
 					// We do all graph construction here in the main thread
 					// so that the background thread only does execution.
@@ -514,6 +546,23 @@ class Catalogue::InternalImage : public ImageNode
 
 				void save( WeakPtr forWrapUp )
 				{
+					// Compress the image data first, so that a catalogue full of
+					// renders doesn't exhaust memory. This also reduces the cost
+					// of the copies made by `copyFrom()`, since they share the
+					// compressed data.
+					for( DisplayIterator it( m_imageCopy.get() ); !it.done(); ++it )
+					{
+						(*it)->compressDriver();
+					}
+
+					if( !saving() )
+					{
+						// We keep `m_imageCopy` until we are destroyed, since
+						// ownership of the graph must be managed on the UI thread.
+						// It shares the client's drivers, so costs little memory.
+						return;
+					}
+
 					ImageAlgo::parallelGatherTiles(
 						m_imageCopy->copyChannels()->outPlug(),
 						m_imageCopy->copyChannels()->outPlug()->channelNamesPlug()->getValue()->readable(),
@@ -682,6 +731,11 @@ void Catalogue::Image::save( const std::string &fileName ) const
 	Catalogue::imageNode( this )->save( fileName );
 }
 
+size_t Catalogue::Image::memoryUsage() const
+{
+	return imageNode( this )->memoryUsage();
+}
+
 Gaffer::PlugPtr Catalogue::Image::createCounterpart( const std::string &name, Direction direction ) const
 {
 	return new Image( name, direction, getFlags() );
@@ -985,9 +1039,32 @@ void Catalogue::imageRemoved( GraphComponent *graphComponent )
 	}
 }
 
+namespace
+{
+
+SharedMemoryDisplayDriverServerPtr createSharedMemoryDisplayDriverServer( int portNumber )
+{
+	try
+	{
+		return new SharedMemoryDisplayDriverServer( portNumber );
+	}
+	catch( const std::exception &e )
+	{
+		// Not fatal, because SharedMemoryDisplayDriver will
+		// fall back to using the DisplayDriverServer instead.
+		IECore::msg( IECore::Msg::Warning, "Catalogue", std::string( "Unable to create shared memory display server : " ) + e.what() );
+		return nullptr;
+	}
+}
+
+} // namespace
+
 IECoreImage::DisplayDriverServer *Catalogue::displayDriverServer()
 {
 	static IECoreImage::DisplayDriverServerPtr g_server = new IECoreImage::DisplayDriverServer();
+	// Paired with `g_server` so that clients using SharedMemoryDisplayDriver
+	// can use the same port number to address us.
+	static SharedMemoryDisplayDriverServerPtr g_sharedMemoryServer = createSharedMemoryDisplayDriverServer( g_server->portNumber() );
 	return g_server.get();
 }
 
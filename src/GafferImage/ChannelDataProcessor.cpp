@@ -168,7 +168,20 @@ void ChannelDataProcessor::hashChannelData( const GafferImage::ImagePlug *output
 
 IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	IECore::FloatVectorDataPtr outData = inPlug()->channelData( channelName, tileOrigin )->copy();
+	IECore::ConstFloatVectorDataPtr inData = inPlug()->channelData( channelName, tileOrigin );
+
+	// Constant tiles are processed as a single value, and
+	// expanded back into a constant tile at the end.
+	IECore::FloatVectorDataPtr outData;
+	float constantValue;
+	if( processesConstantTiles() && ImagePlug::isConstantTile( inData.get(), constantValue ) )
+	{
+		outData = new IECore::FloatVectorData( std::vector<float>( 1, constantValue ) );
+	}
+	else
+	{
+		outData = inData->copy();
+	}
 
 	IECore::ConstStringVectorDataPtr channelNamesData;
 	bool unpremult = false;
@@ -186,6 +199,8 @@ IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const
 
 	IECore::ConstFloatVectorDataPtr alphaData;
 	IECore::ConstFloatVectorDataPtr postAlphaData;
+	float constantAlpha = 0;
+	float constantPostAlpha = 0;
 	if( unpremult && ImageAlgo::channelExists( channelNamesData->readable(), "A" ) )
 	{
 		ImagePlug::ChannelDataScope s( context );
@@ -200,54 +215,96 @@ IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const
 			postAlphaData = alphaData;
 		}
 
-		int size = alphaData->readable().size();
-		const float *A = &alphaData->readable().front();
-		float *O = &outData->writable().front();
-		for( int j = 0; j < size; j++ )
+		if(
+			outData->readable().size() == 1 && !(
+				ImagePlug::isConstantTile( alphaData.get(), constantAlpha ) &&
+				ImagePlug::isConstantTile( postAlphaData.get(), constantPostAlpha )
+			)
+		)
 		{
-			if( *A != 0 )
+			// Alpha varies, so we must process the full tile.
+			outData->writable().resize( ImagePlug::tilePixels(), constantValue );
+		}
+
+		if( outData->readable().size() == 1 )
+		{
+			if( constantAlpha != 0 )
 			{
-				*O /= *A;
+				outData->writable()[0] /= constantAlpha;
 			}
-			A++;
-			O++;
 		}
-
-	}
-	processChannelData( context, parent, channelName, outData );
-	if( unpremult && postAlphaData )
-	{
-		int size = postAlphaData->readable().size();
-		const float *A = &postAlphaData->readable().front();
-		float *O = &outData->writable().front();
-
-		if( repremultByProcessedAlpha )
+		else
 		{
-			const float *preA = &alphaData->readable().front();
+			int size = alphaData->readable().size();
+			const float *A = &alphaData->readable().front();
+			float *O = &outData->writable().front();
 			for( int j = 0; j < size; j++ )
 			{
-				if( ! ( *A == 0 && *preA == 0 ) )
+				if( *A != 0 )
 				{
-					*O *= *A;
+					*O /= *A;
 				}
 				A++;
 				O++;
-				preA++;
+			}
+		}
+
+	}
+	processChannelData( context, parent, channelName, outData );
+	if( unpremult && postAlphaData )
+	{
+		if( outData->readable().size() == 1 )
+		{
+			if( !( constantPostAlpha == 0 && ( !repremultByProcessedAlpha || constantAlpha == 0 ) ) )
+			{
+				outData->writable()[0] *= constantPostAlpha;
 			}
 		}
 		else
 		{
-			for( int j = 0; j < size; j++ )
+			int size = postAlphaData->readable().size();
+			const float *A = &postAlphaData->readable().front();
+			float *O = &outData->writable().front();
+
+			if( repremultByProcessedAlpha )
 			{
-				if( *A != 0 )
+				const float *preA = &alphaData->readable().front();
+				for( int j = 0; j < size; j++ )
 				{
-					*O *= *A;
+					if( ! ( *A == 0 && *preA == 0 ) )
+					{
+						*O *= *A;
+					}
+					A++;
+					O++;
+					preA++;
+				}
+			}
+			else
+			{
+				for( int j = 0; j < size; j++ )
+				{
+					if( *A != 0 )
+					{
+						*O *= *A;
+					}
+					A++;
+					O++;
 				}
-				A++;
-				O++;
 			}
 		}
 
 	}
+
+	if( outData->readable().size() == 1 )
+	{
+		return ImagePlug::constantTile( outData->readable()[0] );
+	}
+
 	return outData;
 }
+
+bool ChannelDataProcessor::processesConstantTiles() const
+{
+	return false;
+}
@@ -45,6 +45,9 @@
 #include "OpenEXR/ImathFun.h"
 #include "OpenEXR/ImathMatrixAlgo.h"
 
+#include <algorithm>
+#include <functional>
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -350,5 +353,13 @@ IECore::ConstFloatVectorDataPtr Checkerboard::computeChannelData( const std::str
 		}
 	}
 
+	// Tiles entirely within a single square are uniform. We return a
+	// shared constant tile for these, so that downstream nodes can
+	// process them cheaply.
+	if( std::adjacent_find( result.begin(), result.end(), std::not_equal_to<float>() ) == result.end() )
+	{
+		return ImagePlug::constantTile( result.front() );
+	}
+
 	return resultData;
 }
@@ -257,3 +257,8 @@ void Clamp::processChannelData( const Gaffer::Context *context, const ImagePlug
 
 	}
 }
+
+bool Clamp::processesConstantTiles() const
+{
+	return true;
+}
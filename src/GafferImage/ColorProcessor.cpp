@@ -161,9 +161,8 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 
 		const string &layerName = context->get<string>( g_layerNameKey );
 
-		FloatVectorDataPtr rgb[3];
+		ConstFloatVectorDataPtr inRGB[3];
 		ConstFloatVectorDataPtr alpha;
-		int samples = -1;
 		{
 			ImagePlug::ChannelDataScope channelDataScope( context );
 
@@ -180,76 +179,109 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 				if( ImageAlgo::channelExists( channelNames, channelName ) )
 				{
 					channelDataScope.setChannelName( channelName );
-					rgb[i] = inPlug()->channelDataPlug()->getValue()->copy();
-
-					samples = rgb[i]->readable().size();
-
-					if( unpremult && alpha )
-					{
-						const float *A = &alpha->readable().front();
-						float *C = &rgb[i]->writable().front();
-						for( int j = 0; j < samples; j++ )
-						{
-							if( *A != 0 )
-							{
-								*C /= *A;
-							}
-							A++;
-							C++;
-						}
-					}
-				}
-				else
-				{
-					rgb[i] = nullptr;
+					inRGB[i] = inPlug()->channelDataPlug()->getValue();
 				}
 				i++;
 			}
+		}
 
-			if( samples == -1 )
+		if( !inRGB[0] && !inRGB[1] && !inRGB[2] )
+		{
+			throw IECore::Exception( "Cannot evaluate color data plug with no source channels" );
+		}
+
+		// If all our inputs are constant tiles, and the derived class
+		// supports it, then we only need to process a single sample, and
+		// can output constant tiles too.
+
+		bool constant = processesConstantTiles();
+		float constantValues[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		for( int i = 0; i < 3 && constant; i++ )
+		{
+			constant = !inRGB[i] || ImagePlug::isConstantTile( inRGB[i].get(), constantValues[i] );
+		}
+		constant = constant && ( !alpha || ImagePlug::isConstantTile( alpha.get(), constantValues[3] ) );
+
+		int samples = -1;
+		FloatVectorDataPtr rgb[3];
+		for( int i = 0; i < 3; i++ )
+		{
+			if( constant )
+			{
+				rgb[i] = new FloatVectorData( vector<float>( 1, constantValues[i] ) );
+			}
+			else if( inRGB[i] )
 			{
-				throw IECore::Exception( "Cannot evaluate color data plug with no source channels" );
+				rgb[i] = inRGB[i]->copy();
 			}
+			if( rgb[i] )
+			{
+				samples = rgb[i]->readable().size();
+			}
+		}
+
+		const float *alphaPtr = nullptr;
+		if( alpha )
+		{
+			alphaPtr = constant ? constantValues + 3 : &alpha->readable().front();
+		}
 
-			for( int k = 0; k < 3; k++ )
+		for( int i = 0; i < 3; i++ )
+		{
+			if( !rgb[i] )
+			{
+				rgb[i] = new FloatVectorData();
+				rgb[i]->writable().resize( samples, 0.0f );
+			}
+			else if( alphaPtr && inRGB[i] )
 			{
-				if( !rgb[k] )
+				const float *A = alphaPtr;
+				float *C = &rgb[i]->writable().front();
+				for( int j = 0; j < samples; j++ )
 				{
-					rgb[k] = new FloatVectorData();
-					rgb[k]->writable().resize( samples, 0.0f );
+					if( *A != 0 )
+					{
+						*C /= *A;
+					}
+					A++;
+					C++;
 				}
 			}
-
 		}
 
 		processColorData( context, rgb[0].get(), rgb[1].get(), rgb[2].get() );
 
-		if( unpremult && alpha )
+		if( alphaPtr )
 		{
 			for( int i = 0; i < 3; i++ )
 			{
-				if( unpremult && alpha )
+				const float *A = alphaPtr;
+				float *C = &rgb[i]->writable().front();
+				for( int j = 0; j < samples; j++ )
 				{
-					const float *A = &alpha->readable().front();
-					float *C = &rgb[i]->writable().front();
-					for( int j = 0; j < samples; j++ )
+					// Pixels with no alpha aren't touched by either the unpremult or repremult
+					if( *A != 0 )
 					{
-						// Pixels with no alpha aren't touched by either the unpremult or repremult
-						if( *A != 0 )
-						{
-							*C *= *A;
-						}
-						A++;
-						C++;
+						*C *= *A;
 					}
+					A++;
+					C++;
 				}
 			}
 		}
 
 		ObjectVectorPtr result = new ObjectVector();
-		result->members().push_back( rgb[0] );
-		result->members().push_back( rgb[1] );
-		result->members().push_back( rgb[2] );
+		for( int i = 0; i < 3; i++ )
+		{
+			if( constant )
+			{
+				result->members().push_back( boost::const_pointer_cast<FloatVectorData>( ImagePlug::constantTile( rgb[i]->readable()[0] ) ) );
+			}
+			else
+			{
+				result->members().push_back( rgb[i] );
+			}
+		}
 
 		static_cast<ObjectPlug *>( output )->setValue( result );
 		return;
@@ -258,6 +290,11 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 	ImageProcessor::compute( output, context );
 }
 
+bool ColorProcessor::processesConstantTiles() const
+{
+	return false;
+}
+
 Gaffer::ValuePlug::CachePolicy ColorProcessor::computeCachePolicy( const Gaffer::ValuePlug *output ) const
 {
 	if( output == outPlug()->channelDataPlug() )
@@ -60,6 +60,7 @@ DeepHoldout::DeepHoldout( const std::string &name )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
 	addChild( new GafferImage::ImagePlug( "holdout" ) );
+	addChild( new FloatPlug( "opacityThreshold", Plug::In, 1.0f, 0.0f, 1.0f ) );
 	addChild( new GafferImage::ImagePlug( "__intermediateIn", Plug::Out ) );
 	addChild( new GafferImage::ImagePlug( "__flattened" ) );
 
@@ -78,6 +79,7 @@ DeepHoldout::DeepHoldout( const std::string &name )
 	addChild( flatten );
 	flatten->inPlug()->setInput( mergeHoldout->outPlug() );
 	flatten->deepStatePlug()->setValue( int( DeepState::TargetState::Flat ) );
+	flatten->opacityThresholdPlug()->setInput( opacityThresholdPlug() );
 
 	flattenedPlug()->setInput( flatten->outPlug() );
 
@@ -108,24 +110,34 @@ const GafferImage::ImagePlug *DeepHoldout::holdoutPlug() const
 	return getChild<ImagePlug>( g_firstPlugIndex );
 }
 
+Gaffer::FloatPlug *DeepHoldout::opacityThresholdPlug()
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 1 );
+}
+
+const Gaffer::FloatPlug *DeepHoldout::opacityThresholdPlug() const
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 1 );
+}
+
 GafferImage::ImagePlug *DeepHoldout::intermediateInPlug()
 {
-	return getChild<ImagePlug>( g_firstPlugIndex + 1 );
+	return getChild<ImagePlug>( g_firstPlugIndex + 2 );
 }
 
 const GafferImage::ImagePlug *DeepHoldout::intermediateInPlug() const
 {
-	return getChild<ImagePlug>( g_firstPlugIndex + 1 );
+	return getChild<ImagePlug>( g_firstPlugIndex + 2 );
 }
 
 GafferImage::ImagePlug *DeepHoldout::flattenedPlug()
 {
-	return getChild<ImagePlug>( g_firstPlugIndex + 2 );
+	return getChild<ImagePlug>( g_firstPlugIndex + 3 );
 }
 
 const GafferImage::ImagePlug *DeepHoldout::flattenedPlug() const
 {
-	return getChild<ImagePlug>( g_firstPlugIndex + 2 );
+	return getChild<ImagePlug>( g_firstPlugIndex + 3 );
 }
 
 void DeepHoldout::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
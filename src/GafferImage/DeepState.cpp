@@ -40,6 +40,8 @@
 #include "GafferImage/ImageAlgo.h"
 #include "GafferImage/DeepState.h"
 
+#include <cstring>
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -58,6 +60,7 @@ const static IECore::InternedString g_sampleOffsetsName = "sampleOffsets";
 const static IECore::InternedString g_contributionIdsName = "contributionIds";
 const static IECore::InternedString g_contributionWeightsName = "contributionWeights";
 const static IECore::InternedString g_contributionOffsetsName = "contributionOffsets";
+const static IECore::InternedString g_flattenEndsName = "flattenEnds";
 
 // This class stores all information about how samples are merged together.
 // It is initialized just based on the sorted Z and ZBack channels ( and the sampleOffsets that
@@ -265,14 +268,17 @@ class SampleMerge
 // with a simple linear weight that can be used to sum together the channel contributions.
 // If flatten is passed, the contributions are set up per pixel, otherwise they are set up
 // per sample.  The return value is the final alpha, per sample, or per pixel ( depending on
-// flatten ).
+// flatten ).  When flattening, once the accumulated alpha of a pixel reaches flattenThreshold,
+// the remaining samples in the pixel are given a weight of zero without evaluating them.  With
+// the default threshold of 1, this only skips samples which are completely occluded.
 FloatVectorDataPtr alphaToLinearWeights(
 		std::vector<float> &contributionWeightsBuffer,  // Modified in place
 		const std::vector<int> &contributionIds,
 		const std::vector<int> &contributionOffsets,
 		const std::vector<float> &alpha,
 		const std::vector<int> &sampleOffsets,
-		bool flatten
+		bool flatten,
+		float flattenThreshold = 1.0f
 )
 {
 	static const float MAX = numeric_limits<float>::max();
@@ -311,7 +317,12 @@ FloatVectorDataPtr alphaToLinearWeights(
 
 		float sampleAccumAlpha = 0.0;
 
-		if( contributionEnd == contributionStart + 1 )
+		if( flatten && pixelAlpha >= flattenThreshold )
+		{
+			// The pixel is already opaque enough that nothing further back can contribute
+			std::fill( contributionWeightsBuffer.begin() + contributionStart, contributionWeightsBuffer.begin() + contributionEnd, 0.0f );
+		}
+		else if( contributionEnd == contributionStart + 1 )
 		{
 			// Exactly one contribution to the sample.  Don't need to worry about merging
 			const float contributionAlpha = alpha[contributionIds[contributionStart]];
@@ -580,15 +591,21 @@ void pruneSamples(
 // In the general case, we come up with the linear sample weights by performing a SampleMerge,
 // and then feeding the contribution amounts through alphaToLinearWeights.  When we are
 // starting with tidy data, however, we can get to the same end point with a simple accumulate.
+// As for alphaToLinearWeights, samples after the accumulated alpha reaches flattenThreshold are
+// skipped, and left with the zero weight that outputWeights must be initialised with.  The end
+// of the samples actually used by each pixel is stored in outputEnds, for use with sumByWeights.
 FloatVectorDataPtr tidyAlphaToFlatLinearWeights(
 		std::vector<float> &outputWeights,
+		std::vector<int> &outputEnds,
 		const std::vector<float> &alpha,
-		const std::vector<int> &sampleOffsets
+		const std::vector<int> &sampleOffsets,
+		float flattenThreshold
 )
 {
 	FloatVectorDataPtr mergedAlphaData = new FloatVectorData;
 	vector<float> &mergedAlpha = mergedAlphaData->writable();
 	mergedAlpha.resize( ImagePlug::tilePixels(), 0.0f );
+	outputEnds.resize( sampleOffsets.size() );
 
 	int prevOffset = 0;
 	for( unsigned int pixel = 0; pixel < sampleOffsets.size(); pixel++ )
@@ -596,19 +613,44 @@ FloatVectorDataPtr tidyAlphaToFlatLinearWeights(
 		int offset = sampleOffsets[pixel];
 
 		float pixelAlpha = 0.0f;
-		for( int sample = prevOffset; sample < offset; sample++ )
+		int sample = prevOffset;
+		for( ; sample < offset && pixelAlpha < flattenThreshold; sample++ )
 		{
 			float sampleAlpha = alpha[sample];
 			outputWeights[sample] = 1.0 - pixelAlpha;
 			pixelAlpha = pixelAlpha + sampleAlpha - pixelAlpha * sampleAlpha;
 		}
 		mergedAlpha[pixel] = pixelAlpha;
+		outputEnds[pixel] = sample;
 
 		prevOffset = offset;
 	}
 	return mergedAlphaData;
 }
 
+// Returns the end of the samples with non-zero weights in each pixel. Samples beyond this
+// can be skipped entirely by sumByWeights.
+IntVectorDataPtr flattenEnds( const std::vector<float> &weights, const std::vector<int> &sampleOffsets )
+{
+	IntVectorDataPtr resultData = new IntVectorData;
+	vector<int> &result = resultData->writable();
+	result.resize( sampleOffsets.size() );
+
+	int prevOffset = 0;
+	for( unsigned int pixel = 0; pixel < sampleOffsets.size(); pixel++ )
+	{
+		int end = sampleOffsets[pixel];
+		while( end > prevOffset && weights[end - 1] == 0.0f )
+		{
+			end--;
+		}
+		result[pixel] = end;
+		prevOffset = sampleOffsets[pixel];
+	}
+
+	return resultData;
+}
+
 // Return a float vector data which for each element of indices, contains the element of input with that index.
 IECore::ConstFloatVectorDataPtr sortByIndices( const std::vector<float> &input, const vector<int> &indices )
 {
@@ -657,7 +699,8 @@ IECore::ConstFloatVectorDataPtr sumByIndicesAndWeights( const std::vector<float>
 // corresponding weight, and sum.  Returns a FloatVectorData with the sum for each range.
 IECore::ConstFloatVectorDataPtr sumByWeights( const std::vector<float> &input,
 	const vector<float> &weights,
-	const vector<int> &offsets
+	const vector<int> &offsets,
+	const vector<int> *ends = nullptr // If specified, samples from `ends[i]` to `offsets[i]` are skipped
 )
 {
 	FloatVectorDataPtr resultData = new FloatVectorData;
@@ -668,9 +711,10 @@ IECore::ConstFloatVectorDataPtr sumByWeights( const std::vector<float> &input,
 	for( unsigned int i = 0; i < offsets.size(); i++ )
 	{
 		int offset = offsets[i];
+		const int end = ends ? (*ends)[i] : offset;
 
 		float accumValue = 0;
-		for( int j = prevOffset; j < offset; j++ )
+		for( int j = prevOffset; j < end; j++ )
 		{
 			accumValue += input[ j ] * weights[j];
 		}
@@ -682,12 +726,88 @@ IECore::ConstFloatVectorDataPtr sumByWeights( const std::vector<float> &input,
 	return resultData;
 }
 
+// Maps a float to an unsigned integer with the same ordering, so that depths can
+// be radix sorted. Negative zero is given the same key as positive zero, so that
+// they compare equal, as they would using `operator <`.
+inline uint32_t sortableDepthBits( float f )
+{
+	if( f == 0.0f )
+	{
+		f = 0.0f;
+	}
+	uint32_t u;
+	memcpy( &u, &f, sizeof( u ) );
+	return ( u & 0x80000000 ) ? ~u : ( u | 0x80000000 );
+}
+
+// Stable LSD radix sort of `indices` by `keys`, one byte at a time. The
+// buffers must be the same size as the inputs, and are used as scratch space.
+// Passes where all keys share the same byte are skipped, which is common for
+// the high bytes of depths within a single pixel.
+void radixSort( uint64_t *keys, int *indices, uint64_t *keysBuffer, int *indicesBuffer, size_t size )
+{
+	size_t counts[8][256];
+	memset( counts, 0, sizeof( counts ) );
+	for( size_t i = 0; i < size; ++i )
+	{
+		const uint64_t key = keys[i];
+		for( int b = 0; b < 8; ++b )
+		{
+			counts[b][ ( key >> ( b * 8 ) ) & 0xff ]++;
+		}
+	}
+
+	uint64_t *keysIn = keys;
+	int *indicesIn = indices;
+	uint64_t *keysOut = keysBuffer;
+	int *indicesOut = indicesBuffer;
+
+	for( int b = 0; b < 8; ++b )
+	{
+		size_t *bucketCounts = counts[b];
+		if( bucketCounts[ ( keysIn[0] >> ( b * 8 ) ) & 0xff ] == size )
+		{
+			continue;
+		}
+
+		size_t offset = 0;
+		for( int i = 0; i < 256; ++i )
+		{
+			const size_t c = bucketCounts[i];
+			bucketCounts[i] = offset;
+			offset += c;
+		}
+
+		for( size_t i = 0; i < size; ++i )
+		{
+			const size_t o = bucketCounts[ ( keysIn[i] >> ( b * 8 ) ) & 0xff ]++;
+			keysOut[o] = keysIn[i];
+			indicesOut[o] = indicesIn[i];
+		}
+
+		std::swap( keysIn, keysOut );
+		std::swap( indicesIn, indicesOut );
+	}
+
+	if( indicesIn != indices )
+	{
+		std::copy( indicesIn, indicesIn + size, indices );
+	}
+}
+
 // Given the Z and ZBack channels, and corresponding sampleOffsets, return an IntVectorData
 // a list of sample indices that would produce sorted samples.
 IECore::IntVectorDataPtr computeSampleSorting(
 	const vector<int> &sampleOffsets, const vector<float> &z, const vector<float> &zBack
 )
 {
+	// Pixels with few samples are sorted with an insertion sort, which has less overhead
+	// than `std::sort()` and is stable, and pixels with many samples use a radix sort on
+	// a key combining Z and ZBack. Both preserve the initial order of samples with equal
+	// depths. Anything in between uses `std::sort()` with a comparator.
+	const int insertionSortThreshold = 16;
+	const int radixSortThreshold = 128;
+
 	// We compare based on the Z channel - if it is equal, compare based on ZBack
 	struct CompareDepth
 	{
@@ -726,14 +846,60 @@ IECore::IntVectorDataPtr computeSampleSorting(
 
 	CompareDepth compare( z, zBack );
 
+	// Scratch space for radix sorting, allocated once for the whole tile
+	// and sized for the largest pixel.
+	std::vector<uint64_t> keys;
+	std::vector<uint64_t> keysBuffer;
+	std::vector<int> indicesBuffer;
+
 	int prevOffset = 0;
 	for( int offset : sampleOffsets )
 	{
-		if( offset > prevOffset )
+		const int numSamples = offset - prevOffset;
+		if( numSamples <= 1 )
 		{
-			std::sort( &result[prevOffset], &result[offset], compare );
 			prevOffset = offset;
+			continue;
+		}
+
+		int *pixelIndices = &result[prevOffset];
+		if( numSamples <= insertionSortThreshold )
+		{
+			for( int i = 1; i < numSamples; ++i )
+			{
+				const int index = pixelIndices[i];
+				int j = i;
+				while( j > 0 && compare( index, pixelIndices[j-1] ) )
+				{
+					pixelIndices[j] = pixelIndices[j-1];
+					--j;
+				}
+				pixelIndices[j] = index;
+			}
+		}
+		else if( numSamples < radixSortThreshold )
+		{
+			std::sort( pixelIndices, pixelIndices + numSamples, compare );
+		}
+		else
+		{
+			if( keys.size() < (size_t)numSamples )
+			{
+				keys.resize( numSamples );
+				keysBuffer.resize( numSamples );
+				indicesBuffer.resize( numSamples );
+			}
+
+			for( int i = 0; i < numSamples; ++i )
+			{
+				const int index = pixelIndices[i];
+				keys[i] = ( (uint64_t)sortableDepthBits( z[index] ) << 32 ) | sortableDepthBits( zBack[index] );
+			}
+
+			radixSort( keys.data(), pixelIndices, keysBuffer.data(), indicesBuffer.data(), numSamples );
 		}
+
+		prevOffset = offset;
 	}
 
 	return resultData;
@@ -814,6 +980,7 @@ DeepState::DeepState( const std::string &name )
 	addChild( new BoolPlug( "pruneTransparent", Gaffer::Plug::In, false ) );
 	addChild( new BoolPlug( "pruneOccluded", Gaffer::Plug::In, false ) );
 	addChild( new FloatPlug( "occludedThreshold", Gaffer::Plug::In, 1.0 ) );
+	addChild( new FloatPlug( "opacityThreshold", Gaffer::Plug::In, 1.0f, 0.0f, 1.0f ) );
 
 	addChild( new CompoundObjectPlug( "__sampleMapping", Gaffer::Plug::Out, new IECore::CompoundObject ) );
 
@@ -868,14 +1035,24 @@ const Gaffer::FloatPlug *DeepState::occludedThresholdPlug() const
 	return getChild<FloatPlug>( g_firstPlugIndex + 3 );
 }
 
+Gaffer::FloatPlug *DeepState::opacityThresholdPlug()
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 4 );
+}
+
+const Gaffer::FloatPlug *DeepState::opacityThresholdPlug() const
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 4 );
+}
+
 Gaffer::CompoundObjectPlug *DeepState::sampleMappingPlug()
 {
-	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 4 );
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 5 );
 }
 
 const Gaffer::CompoundObjectPlug *DeepState::sampleMappingPlug() const
 {
-	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 4 );
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 5 );
 }
 
 void DeepState::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
@@ -906,6 +1083,10 @@ void DeepState::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outp
 	{
 		outputs.push_back( sampleMappingPlug() );
 	}
+	else if( input == opacityThresholdPlug() )
+	{
+		outputs.push_back( sampleMappingPlug() );
+	}
 	else if( input == inPlug()->deepPlug() )
 	{
 		outputs.push_back( sampleMappingPlug() );
@@ -939,6 +1120,7 @@ void DeepState::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *co
 		pruneTransparentPlug()->hash( h );
 		pruneOccludedPlug()->hash( h );
 		occludedThresholdPlug()->hash( h );
+		opacityThresholdPlug()->hash( h );
 		deepStatePlug()->hash( h );
 		channelNamesData = inPlug()->channelNamesPlug()->getValue();
 	}
@@ -991,7 +1173,7 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 
 	TargetState requestedDeepState;
 	bool pruneTransparent, pruneOccluded;
-	float occludedThreshold;
+	float occludedThreshold, opacityThreshold;
 
 	{
 		ImagePlug::GlobalScope s( context );
@@ -999,12 +1181,18 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 		pruneTransparent = pruneTransparentPlug()->getValue();
 		pruneOccluded = pruneOccludedPlug()->getValue();
 		occludedThreshold = occludedThresholdPlug()->getValue();
+		opacityThreshold = opacityThresholdPlug()->getValue();
 
 		channelNamesData = inPlug()->channelNamesPlug()->getValue();
 	}
 
 	const std::vector<std::string> &channelNames = channelNamesData->readable();
 
+	// When flattening, compositing of each pixel terminates once its alpha reaches
+	// the threshold. We don't allow a threshold of 0, since that would discard
+	// every sample.
+	const float flattenThreshold = std::max( 0.00000001f, std::min( 1.0f, opacityThreshold ) );
+
 	CompoundObjectPtr result = new CompoundObject;
 
 	ImagePlug::ChannelDataScope channelScope( Context::current() );
@@ -1058,15 +1246,19 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 				channelScope.setChannelName( "A" );
 				ConstFloatVectorDataPtr alphaData = inPlug()->channelDataPlug()->getValue();
 
-				sampleWeights.resize( sampleOffsetsData->readable().back() );
+				sampleWeights.resize( sampleOffsetsData->readable().back(), 0.0f );
+				IntVectorDataPtr flattenEndsData = new IntVectorData;
 				FloatVectorDataPtr mergedAlphaData = tidyAlphaToFlatLinearWeights(
 					sampleWeights,
+					flattenEndsData->writable(),
 					alphaData->readable(),
-					sampleOffsetsData->readable()
+					sampleOffsetsData->readable(),
+					flattenThreshold
 				);
 
 				result->members()[ g_AName ] = mergedAlphaData;
 				result->members()[ g_contributionWeightsName ] = sampleWeightsData;
+				result->members()[ g_flattenEndsName ] = flattenEndsData;
 			}
 			else
 			{
@@ -1156,7 +1348,8 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 			sampleMerge.contributionOffsetsData->readable(),
 			alphaData->readable(),
 			sampleMerge.sampleOffsetsData->readable(),
-			requestedDeepState == TargetState::Flat
+			requestedDeepState == TargetState::Flat,
+			flattenThreshold
 		);
 
 		if( requestedDeepState == TargetState::Tidy )
@@ -1222,6 +1415,7 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 
 			result->members()[ g_AName ] = mergedAlphaData;
 			result->members()[ g_contributionWeightsName ] = sampleWeightsData;
+			result->members()[ g_flattenEndsName ] = flattenEnds( sampleWeights, sampleOffsetsData->readable() );
 		}
 	}
 
@@ -1398,12 +1592,16 @@ IECore::ConstFloatVectorDataPtr DeepState::computeChannelData( const std::string
 		{
 			// When flattening, we get a weight corresponding to each sample, and we just need to multiply
 			// the input samples by these weights and sum them.
+			// Samples beyond the flatten ends are known to have zero weight, so we skip
+			// them entirely.
 			ConstFloatVectorDataPtr mergedSampleContributionAmountsData = sampleMappingData->member<FloatVectorData>( g_contributionWeightsName, true );
+			ConstIntVectorDataPtr flattenEndsData = sampleMappingData->member<IntVectorData>( g_flattenEndsName, false );
 			ConstIntVectorDataPtr sampleOffsetsData = inPlug()->sampleOffsetsPlug()->getValue();
 			assert( (int)inData->readable().size() == sampleOffsetsData->readable().back() );
 			result = sumByWeights( inData->readable(),
 				mergedSampleContributionAmountsData->readable(),
-				sampleOffsetsData->readable()
+				sampleOffsetsData->readable(),
+				flattenEndsData ? &flattenEndsData->readable() : nullptr
 			);
 		}
 		else
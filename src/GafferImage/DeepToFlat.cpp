@@ -59,6 +59,7 @@ DeepToFlat::DeepToFlat( const std::string &name )
 	storeIndexOfNextChild( g_firstPlugIndex );
 
 	addChild( new IntPlug( "depthMode", Gaffer::Plug::In, int( DepthMode::Filtered ) ) );
+	addChild( new FloatPlug( "opacityThreshold", Gaffer::Plug::In, 1.0f, 0.0f, 1.0f ) );
 
 	addChild( new FloatVectorDataPlug( "__intermediateChannelData", Gaffer::Plug::Out, ImagePlug::blackTile(), Plug::Default & ~Plug::Serialisable ) );
 	addChild( new FloatVectorDataPlug( "__flattenedChannelData", Gaffer::Plug::Out, ImagePlug::blackTile(), Plug::Default & ~Plug::Serialisable ) );
@@ -68,6 +69,7 @@ DeepToFlat::DeepToFlat( const std::string &name )
 	deepState()->deepStatePlug()->setValue( int( DeepState::TargetState::Flat ) );
 	deepState()->inPlug()->setInput( inPlug() );
 	deepState()->inPlug()->channelDataPlug()->setInput( intermediateChannelDataPlug() );
+	deepState()->opacityThresholdPlug()->setInput( opacityThresholdPlug() );
 
 	flattenedChannelDataPlug()->setInput( deepState()->outPlug()->channelDataPlug() );
 
@@ -91,34 +93,44 @@ const Gaffer::IntPlug *DeepToFlat::depthModePlug() const
 	return getChild<IntPlug>( g_firstPlugIndex );
 }
 
+Gaffer::FloatPlug *DeepToFlat::opacityThresholdPlug()
+{
+	return getChild<FloatPlug>( g_firstPlugIndex+1 );
+}
+
+const Gaffer::FloatPlug *DeepToFlat::opacityThresholdPlug() const
+{
+	return getChild<FloatPlug>( g_firstPlugIndex+1 );
+}
+
 Gaffer::FloatVectorDataPlug *DeepToFlat::intermediateChannelDataPlug()
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex+1 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex+2 );
 }
 
 const Gaffer::FloatVectorDataPlug *DeepToFlat::intermediateChannelDataPlug() const
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex+1 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex+2 );
 }
 
 Gaffer::FloatVectorDataPlug *DeepToFlat::flattenedChannelDataPlug()
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex+2 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex+3 );
 }
 
 const Gaffer::FloatVectorDataPlug *DeepToFlat::flattenedChannelDataPlug() const
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex+2 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex+3 );
 }
 
 GafferImage::DeepState *DeepToFlat::deepState()
 {
-	return getChild<DeepState>( g_firstPlugIndex+3 );
+	return getChild<DeepState>( g_firstPlugIndex+4 );
 }
 
 const GafferImage::DeepState *DeepToFlat::deepState() const
 {
-	return getChild<DeepState>( g_firstPlugIndex+3 );
+	return getChild<DeepState>( g_firstPlugIndex+4 );
 }
 
 void DeepToFlat::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
@@ -54,10 +54,18 @@
 #include "boost/lexical_cast.hpp"
 #include "boost/multi_array.hpp"
 
+#include "OpenEXR/half.h"
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
 #include "tbb/spin_mutex.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
+#include <zlib.h>
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -68,6 +76,170 @@ using namespace GafferImage;
 // Implementation of a DisplayDriver to support the node itself
 //////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+
+// Losslessly compressed storage for a single tile of channel data. We
+// XOR each value with its predecessor, so that the high bytes of smoothly
+// varying values become zero, and then group the bytes into planes before
+// deflating, so that those zeroes form long runs. Values which can be
+// represented exactly as halves are stored as such, and uniform tiles are
+// stored as a single value.
+class CompressedTile
+{
+
+	public :
+
+		typedef std::shared_ptr<const CompressedTile> ConstPtr;
+
+		static ConstPtr compress( const ConstFloatVectorDataPtr &data )
+		{
+			const vector<float> &values = data->readable();
+
+			std::shared_ptr<CompressedTile> result( new CompressedTile );
+			result->m_size = values.size();
+			result->m_hash = data->Object::hash();
+
+			// Compare bit patterns rather than values, so that we
+			// preserve the distinction between -0 and 0.
+			const auto differentBits = [] ( float a, float b ) { return memcmp( &a, &b, sizeof( float ) ) != 0; };
+			if( std::adjacent_find( values.begin(), values.end(), differentBits ) == values.end() )
+			{
+				result->m_constantValue = values.empty() ? 0.0f : values.front();
+				return result;
+			}
+
+			bool isHalf = true;
+			for( float v : values )
+			{
+				const float h = half( v );
+				if( memcmp( &h, &v, sizeof( float ) ) )
+				{
+					isHalf = false;
+					break;
+				}
+			}
+
+			vector<unsigned char> shuffled;
+			if( isHalf )
+			{
+				result->m_bytesPerValue = 2;
+				shuffle<uint16_t>( values, shuffled, []( float v ) { return half( v ).bits(); } );
+			}
+			else
+			{
+				result->m_bytesPerValue = 4;
+				shuffle<uint32_t>( values, shuffled, []( float v ) { uint32_t u; memcpy( &u, &v, sizeof( float ) ); return u; } );
+			}
+
+			uLongf compressedSize = compressBound( shuffled.size() );
+			result->m_compressed.resize( compressedSize );
+			if( compress2( result->m_compressed.data(), &compressedSize, shuffled.data(), shuffled.size(), Z_BEST_SPEED ) != Z_OK )
+			{
+				throw IECore::Exception( "Failed to compress tile" );
+			}
+			result->m_compressed.resize( compressedSize );
+			result->m_compressed.shrink_to_fit();
+
+			return result;
+		}
+
+		ConstFloatVectorDataPtr decompress() const
+		{
+			if( !m_bytesPerValue )
+			{
+				if( m_size == ImagePlug::tilePixels() )
+				{
+					return ImagePlug::constantTile( m_constantValue );
+				}
+				return new FloatVectorData( vector<float>( m_size, m_constantValue ) );
+			}
+
+			vector<unsigned char> shuffled( m_size * m_bytesPerValue );
+			uLongf shuffledSize = shuffled.size();
+			if( uncompress( shuffled.data(), &shuffledSize, m_compressed.data(), m_compressed.size() ) != Z_OK || shuffledSize != shuffled.size() )
+			{
+				throw IECore::Exception( "Failed to decompress tile" );
+			}
+
+			FloatVectorDataPtr result = new FloatVectorData;
+			vector<float> &values = result->writable();
+			values.resize( m_size );
+			if( m_bytesPerValue == 2 )
+			{
+				unshuffle<uint16_t>( shuffled, values, []( uint16_t u ) { half h; h.setBits( u ); return (float)h; } );
+			}
+			else
+			{
+				unshuffle<uint32_t>( shuffled, values, []( uint32_t u ) { float v; memcpy( &v, &u, sizeof( float ) ); return v; } );
+			}
+
+			return result;
+		}
+
+		const IECore::MurmurHash &hash() const
+		{
+			return m_hash;
+		}
+
+		size_t memoryUsage() const
+		{
+			return sizeof( CompressedTile ) + m_compressed.capacity();
+		}
+
+	private :
+
+		CompressedTile()
+			:	m_size( 0 ), m_bytesPerValue( 0 ), m_constantValue( 0.0f )
+		{
+		}
+
+		template<typename T, typename F>
+		static void shuffle( const vector<float> &values, vector<unsigned char> &shuffled, F &&toBits )
+		{
+			const size_t n = values.size();
+			shuffled.resize( n * sizeof( T ) );
+			T previous = 0;
+			for( size_t i = 0; i < n; ++i )
+			{
+				const T bits = toBits( values[i] );
+				const T delta = bits ^ previous;
+				previous = bits;
+				for( size_t b = 0; b < sizeof( T ); ++b )
+				{
+					shuffled[b * n + i] = ( delta >> ( b * 8 ) ) & 0xff;
+				}
+			}
+		}
+
+		template<typename T, typename F>
+		static void unshuffle( const vector<unsigned char> &shuffled, vector<float> &values, F &&fromBits )
+		{
+			const size_t n = values.size();
+			T previous = 0;
+			for( size_t i = 0; i < n; ++i )
+			{
+				T delta = 0;
+				for( size_t b = 0; b < sizeof( T ); ++b )
+				{
+					delta |= T( shuffled[b * n + i] ) << ( b * 8 );
+				}
+				previous ^= delta;
+				values[i] = fromBits( previous );
+			}
+		}
+
+		size_t m_size;
+		// 0 for constant tiles.
+		size_t m_bytesPerValue;
+		float m_constantValue;
+		vector<unsigned char> m_compressed;
+		IECore::MurmurHash m_hash;
+
+};
+
+} // namespace
+
 namespace GafferImage
 {
 
@@ -178,6 +350,12 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 							continue;
 						}
 
+						if( tile->compressed )
+						{
+							// We're receiving more data after `compress()`.
+							tile->uncompress();
+						}
+
 						vector<float> &buffer = tile->backBuffer;
 						const Box2i tileBound( tileOrigin, tileOrigin + Imath::V2i( GafferImage::ImagePlug::tileSize() ) );
 						const Box2i transferBound = IECore::boxIntersection( tileBound, gafferBox );
@@ -234,6 +412,13 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 			}
 
 			tbb::spin_rw_mutex::scoped_lock tileLock( tile->mutex, /* write = */ false );
+			if( tile->compressedTile )
+			{
+				// Compressed tiles don't change until they are uncompressed
+				// by `imageData()`, so the usual dataCount checks are unnecessary.
+				return tile->compressedTile->decompress();
+			}
+
 			if( tile->cachedForDataCount == dataCount )
 			{
 				// In order to ensure hashes and computes are consistent, once we have
@@ -282,6 +467,50 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 			return tile->cachedTile;
 		}
 
+		IECore::MurmurHash channelDataHash( const Imath::V2i &tileOrigin, const std::string &channelName, int dataCount )
+		{
+			vector<string>::const_iterator cIt = find( channelNames().begin(), channelNames().end(), channelName );
+			if( cIt != channelNames().end() )
+			{
+				if( Tile *tile = getTile( tileOrigin, cIt - channelNames().begin() ) )
+				{
+					// Avoid decompressing just to compute the hash.
+					tbb::spin_rw_mutex::scoped_lock tileLock( tile->mutex, /* write = */ false );
+					if( tile->compressedTile )
+					{
+						return tile->compressedTile->hash();
+					}
+				}
+			}
+
+			return channelData( tileOrigin, channelName, dataCount )->Object::hash();
+		}
+
+		// Compresses all tiles, to reduce memory usage once
+		// the image is complete.
+		void compress()
+		{
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, m_tiles.size() ),
+				[this]( const tbb::blocked_range<size_t> &range ) {
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						m_tiles[i].compress();
+					}
+				}
+			);
+		}
+
+		size_t memoryUsage() const
+		{
+			size_t result = 0;
+			for( const auto &tile : m_tiles )
+			{
+				result += tile.memoryUsage();
+			}
+			return result;
+		}
+
 		typedef boost::signal<void ( GafferDisplayDriver *, const Imath::Box2i & )> DataReceivedSignal;
 		DataReceivedSignal &dataReceivedSignal()
 		{
@@ -305,7 +534,7 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 
 		struct Tile
 		{
-			Tile(): backBuffer( ImagePlug::blackTile()->readable() ), dirty( false ), cachedTile( ImagePlug::blackTile() ), cachedForDataCount( 0 )
+			Tile(): backBuffer( ImagePlug::blackTile()->readable() ), dirty( false ), compressed( false ), cachedTile( ImagePlug::blackTile() ), cachedForDataCount( 0 )
 			{
 			}
 
@@ -320,7 +549,10 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 				// tile is currently being written
 				tbb::spin_rw_mutex::scoped_lock tileLock( other.mutex, /* write = */ false );
 
-				memcpy( &backBuffer[0], &other.backBuffer[0], backBuffer.size() * sizeof( float ) );
+				// Compressed data is immutable, so can be shared between copies.
+				backBuffer = other.backBuffer;
+				compressedTile = other.compressedTile;
+				compressed = (bool)other.compressed;
 				dirty = (bool)other.dirty;
 				cachedTile = other.cachedTile;
 
@@ -332,11 +564,65 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 				return *this;
 			}
 
+			void compress()
+			{
+				tbb::spin_rw_mutex::scoped_lock tileLock( mutex, /* write = */ true );
+				if( compressedTile )
+				{
+					return;
+				}
+
+				ConstFloatVectorDataPtr data = dirty ? new FloatVectorData( backBuffer ) : cachedTile;
+				compressedTile = CompressedTile::compress( data );
+				compressed = true;
+
+				std::vector<float>().swap( backBuffer );
+				cachedTile = nullptr;
+				// Never matches a real data count, so `channelData()` won't
+				// return the null `cachedTile` if we are later uncompressed.
+				cachedForDataCount = -1;
+				dirty = false;
+			}
+
+			void uncompress()
+			{
+				tbb::spin_rw_mutex::scoped_lock tileLock( mutex, /* write = */ true );
+				if( !compressedTile )
+				{
+					return;
+				}
+
+				cachedTile = compressedTile->decompress();
+				backBuffer = cachedTile->readable();
+				compressedTile.reset();
+				compressed = false;
+			}
+
+			size_t memoryUsage() const
+			{
+				tbb::spin_rw_mutex::scoped_lock tileLock( mutex, /* write = */ false );
+				size_t result = backBuffer.capacity() * sizeof( float );
+				if( compressedTile )
+				{
+					result += compressedTile->memoryUsage();
+				}
+				float constantValue;
+				if( cachedTile && !ImagePlug::isConstantTile( cachedTile.get(), constantValue ) )
+				{
+					result += cachedTile->readable().capacity() * sizeof( float );
+				}
+				return result;
+			}
+
 			std::vector<float> backBuffer;
 			std::atomic<bool> dirty;
+			// Mirrors `compressedTile != nullptr`, for checking without
+			// taking the lock in `imageData()`.
+			std::atomic<bool> compressed;
 			mutable tbb::spin_rw_mutex mutex;
 
-			// Use mutex to access these 2
+			// Use mutex to access these 3
+			CompressedTile::ConstPtr compressedTile;
 			ConstFloatVectorDataPtr cachedTile;
 			int cachedForDataCount;
 		};
@@ -494,6 +780,19 @@ const IECoreImage::DisplayDriver *Display::getDriver() const
 	return m_driver.get();
 }
 
+void Display::compressDriver()
+{
+	if( m_driver )
+	{
+		m_driver->compress();
+	}
+}
+
+size_t Display::driverMemoryUsage() const
+{
+	return m_driver ? m_driver->memoryUsage() : 0;
+}
+
 void Display::hashFormat( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	ImageNode::hashFormat( output, context, h );
@@ -602,16 +901,18 @@ IECore::ConstIntVectorDataPtr Display::computeSampleOffsets( const Imath::V2i &t
 
 void Display::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	ConstFloatVectorDataPtr channelData = ImagePlug::blackTile();
 	if( m_driver )
 	{
-		channelData = m_driver->channelData(
+		h = m_driver->channelDataHash(
 			context->get<Imath::V2i>( ImagePlug::tileOriginContextName ),
 			context->get<std::string>( ImagePlug::channelNameContextName ),
 			channelDataCountPlug()->getValue()
 		);
 	}
-	h = channelData->Object::hash();
+	else
+	{
+		h = ImagePlug::blackTile()->Object::hash();
+	}
 }
 
 IECore::ConstFloatVectorDataPtr Display::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
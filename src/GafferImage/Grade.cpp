@@ -293,3 +293,8 @@ void Grade::parameters( size_t channelIndex, float &a, float &b, float &gamma )
 	a = multiply * ( gain - lift ) / ( whitePoint - blackPoint );
 	b = offset + lift - a * blackPoint;
 }
+
+bool Grade::processesConstantTiles() const
+{
+	return true;
+}
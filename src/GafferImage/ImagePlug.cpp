@@ -45,6 +45,14 @@
 
 #include "Gaffer/Context.h"
 #include "Gaffer/ContextAlgo.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
+#include "IECore/MessageHandler.h"
+
+#include "boost/format.hpp"
+
+#include <cstdlib>
+#include <cstring>
 
 using namespace std;
 using namespace tbb;
@@ -55,6 +63,42 @@ using namespace GafferImage;
 
 GAFFER_PLUG_DEFINE_TYPE( ImagePlug );
 
+//////////////////////////////////////////////////////////////////////////
+// Tile size
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+int tileSizeLog2FromEnvironment()
+{
+	const int defaultTileSizeLog2 = 7;
+	const char *e = getenv( "GAFFERIMAGE_TILESIZE" );
+	if( !e )
+	{
+		return defaultTileSizeLog2;
+	}
+
+	const int tileSize = atoi( e );
+	for( int tileSizeLog2 = 5; tileSizeLog2 <= 10; ++tileSizeLog2 )
+	{
+		if( tileSize == 1 << tileSizeLog2 )
+		{
+			return tileSizeLog2;
+		}
+	}
+
+	IECore::msg(
+		IECore::Msg::Warning, "ImagePlug",
+		boost::format( "Invalid value \"%s\" for GAFFERIMAGE_TILESIZE. Must be a power of two between 32 and 1024." ) % e
+	);
+	return defaultTileSizeLog2;
+}
+
+} // namespace
+
+const int ImagePlug::g_tileSizeLog2 = tileSizeLog2FromEnvironment();
+
 //////////////////////////////////////////////////////////////////////////
 // Implementation of ImagePlug
 //////////////////////////////////////////////////////////////////////////
@@ -186,6 +230,83 @@ const IECore::FloatVectorData *ImagePlug::blackTile()
 	return g_blackTile.get();
 };
 
+namespace
+{
+
+// Constant tiles are keyed by the bit pattern of their value, so that
+// we don't need to worry about NaNs and negative zeroes.
+uint32_t constantTileKey( float value )
+{
+	uint32_t result;
+	std::memcpy( &result, &value, sizeof( float ) );
+	return result;
+}
+
+ConstFloatVectorDataPtr constantTileGetter( uint32_t key, size_t &cost )
+{
+	float value;
+	std::memcpy( &value, &key, sizeof( float ) );
+	cost = 1;
+	return new FloatVectorData( std::vector<float>( ImagePlug::tilePixels(), value ) );
+}
+
+// We only need to keep tiles for the handful of distinct values in use
+// at any one time. If a tile is evicted while still in use downstream,
+// we just lose the ability to recognise it in `isConstantTile()`.
+typedef IECorePreview::LRUCache<uint32_t, ConstFloatVectorDataPtr> ConstantTileCache;
+
+ConstantTileCache &constantTileCache()
+{
+	static ConstantTileCache *c = new ConstantTileCache( constantTileGetter, 256 );
+	return *c;
+}
+
+} // namespace
+
+IECore::ConstFloatVectorDataPtr ImagePlug::constantTile( float value )
+{
+	const uint32_t key = constantTileKey( value );
+	if( key == constantTileKey( 0.0f ) )
+	{
+		return blackTile();
+	}
+	else if( key == constantTileKey( 1.0f ) )
+	{
+		return whiteTile();
+	}
+	return constantTileCache().get( key );
+}
+
+bool ImagePlug::isConstantTile( const IECore::FloatVectorData *tile, float &value )
+{
+	if( tile == blackTile() )
+	{
+		value = 0.0f;
+		return true;
+	}
+	else if( tile == whiteTile() )
+	{
+		value = 1.0f;
+		return true;
+	}
+
+	const std::vector<float> &v = tile->readable();
+	if( (int)v.size() != tilePixels() )
+	{
+		return false;
+	}
+
+	// A tile can only be a constant tile if it is the one we have
+	// cached for its first value.
+	auto cached = constantTileCache().getIfCached( constantTileKey( v[0] ) );
+	if( cached && cached->get() == tile )
+	{
+		value = v[0];
+		return true;
+	}
+	return false;
+}
+
 bool ImagePlug::acceptsChild( const GraphComponent *potentialChild ) const
 {
 	if( !ValuePlug::acceptsChild( potentialChild ) )
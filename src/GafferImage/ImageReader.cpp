@@ -387,6 +387,19 @@ void ImageReader::compute( ValuePlug *output, const Context *context ) const
 	}
 }
 
+Gaffer::ValuePlug::CachePolicy ImageReader::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->channelDataPlug() && OpenImageIOReader::getHalfTileStorage() )
+	{
+		// The internal OpenImageIOReader caches half tiles and promotes them
+		// to float on demand, and the internal ColorSpace doesn't cache the
+		// tiles it passes through unconverted. Caching here would hold a float
+		// copy of every such tile, defeating the point of half storage.
+		return ValuePlug::CachePolicy::Uncached;
+	}
+	return ImageNode::computeCachePolicy( output );
+}
+
 void ImageReader::hashFormat( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	FrameMaskScope scope( context, this, /* clampBlack = */ true );
@@ -124,6 +124,23 @@ void copyBufferArea( const float *inData, const Imath::Box2i &inArea, float *out
 	}
 }
 
+// As above, but filling the area with a single value, for use with constant tiles.
+void fillBufferArea( float value, float *outData, const Imath::Box2i &outArea, const size_t outOffset, const size_t outInc, const bool outYDown, const Imath::Box2i &fillArea )
+{
+	assert( BufferAlgo::contains( outArea, fillArea ) );
+
+	for( int y = fillArea.min.y; y < fillArea.max.y; ++y )
+	{
+		const size_t yOffsetOut = outYDown ? outArea.max.y - y - 1 : y - outArea.min.y;
+		float *outPtr = outData + ( ( ( yOffsetOut * outArea.size().x ) + ( fillArea.min.x - outArea.min.x ) ) * outInc ) + outOffset;
+
+		for( int x = fillArea.min.x; x < fillArea.max.x; x++, outPtr += outInc )
+		{
+			*outPtr = value;
+		}
+	}
+}
+
 void copyDeepArea(
 	const int *offsetData, const float *tileData, const int inOffsetPos, const Imath::V2i &size,
 	DeepData &outData, const int outStartIndex, const int outStride, const int channel
@@ -234,18 +251,20 @@ class FlatTileWriter
 	// corner of the tile we've just written can be considered to be filled,
 	// so set the appropriate m_tilesFilled value.
 	//
-	// After flagging filled tiles, it iterates through tiles, starting at
-	// m_nextTileIndex, and for each tile, if the tile is marked as filled,
-	// write it, and if the tile does not intersect the region covered by the
-	// input tiles, write a black tile. If neither of these is the case, stop,
-	// and set m_nextTileIndex to the tile that it stopped on, which is the
-	// next tile to write.
+	// After flagging filled tiles, it checks whether the row of output tiles
+	// starting at m_nextTileIndex is complete, meaning that every tile in it
+	// is either marked as filled, or does not intersect the region covered by
+	// the input tiles (in which case it is black). If so, the whole row is
+	// written with a single call to `write_tiles()`, and m_nextTileIndex is
+	// advanced to the start of the next row. Writing a row at a time allows
+	// OpenEXR to compress the tiles in parallel using its own thread pool,
+	// whereas calling `write_tile()` for each tile serialises compression.
 	//
 	// Once all Gaffer tiles have been processed, there may still be partially
 	// unfilled tiles, which will be fine, as their unfilled areas will be
-	// black, which is what we want. So iterate over the remaining tiles, and
-	// if memory has been allocated for that tile, write it to the file, and if
-	// nothing has been allocated, write a black tile.
+	// black, which is what we want. So write the remaining rows, using the
+	// data for each tile if memory has been allocated for it, and a black
+	// tile otherwise.
 	public:
 		FlatTileWriter(
 				ImageOutputPtr out,
@@ -275,20 +294,9 @@ class FlatTileWriter
 
 		void finish()
 		{
-			for( size_t tileIndex = m_nextTileIndex; tileIndex < m_tilesData.size(); ++tileIndex )
+			for( ; m_nextTileIndex < m_tilesData.size(); m_nextTileIndex += m_numTiles.x )
 			{
-				Imath::V2i tileOrigin = outTileOrigin( tileIndex );
-				if( !m_tilesData[tileIndex]->readable().empty() )
-				{
-					writeTile( tileOrigin, m_tilesData[tileIndex] );
-				}
-				else
-				{
-					// If the tileData object hasn't been resized, then
-					// we have never even tried to write data to this
-					// tile, so write the static black tile.
-					writeTile( tileOrigin, blackTile() );
-				}
+				writeTileRow( m_nextTileIndex );
 			}
 		}
 
@@ -307,6 +315,9 @@ class FlatTileWriter
 
 			Imath::V2i outTileOrig( tilesWrite.min.x, tilesWrite.max.y - m_spec.tile_height );
 
+			float constantValue;
+			const bool constant = ImagePlug::isConstantTile( data.get(), constantValue );
+
 			for( ; outTileOrig.y >= tilesWrite.min.y; outTileOrig.y -= m_spec.tile_height )
 			{
 				for( outTileOrig.x = tilesWrite.min.x; outTileOrig.x < tilesWrite.max.x; outTileOrig.x += m_spec.tile_width )
@@ -322,7 +333,14 @@ class FlatTileWriter
 
 					Imath::Box2i copyArea( BufferAlgo::intersection( m_processWindow, BufferAlgo::intersection( inTileBounds, outTileBnds ) ) );
 
-					copyBufferArea( &data->readable()[0], inTileBounds, &tile[0], outTileBnds, channelIndex, m_spec.channelnames.size(), true, copyArea );
+					if( constant )
+					{
+						fillBufferArea( constantValue, &tile[0], outTileBnds, channelIndex, m_spec.channelnames.size(), true, copyArea );
+					}
+					else
+					{
+						copyBufferArea( &data->readable()[0], inTileBounds, &tile[0], outTileBnds, channelIndex, m_spec.channelnames.size(), true, copyArea );
+					}
 				}
 			}
 
@@ -398,35 +416,61 @@ class FlatTileWriter
 
 		void writeFilledTiles()
 		{
-			size_t tileIndex;
-			for( tileIndex = m_nextTileIndex; tileIndex < m_tilesData.size(); ++tileIndex )
+			while( m_nextTileIndex < m_tilesData.size() )
 			{
-				Imath::V2i tileOrigin = outTileOrigin( tileIndex );
-
-				if( m_tilesFilled[tileIndex] )
+				const size_t rowEnd = m_nextTileIndex + m_numTiles.x;
+				for( size_t tileIndex = m_nextTileIndex; tileIndex < rowEnd; ++tileIndex )
 				{
-					writeTile( tileOrigin, m_tilesData[tileIndex] );
-					m_tilesData[tileIndex].reset();
+					if( !m_tilesFilled[tileIndex] && BufferAlgo::intersects( m_inputTilesBounds, outTileBounds( tileIndex ) ) )
+					{
+						// Row not complete yet.
+						return;
+					}
 				}
-				else if( !BufferAlgo::intersects( m_inputTilesBounds, outTileBounds( tileIndex ) ) )
+
+				writeTileRow( m_nextTileIndex );
+				m_nextTileIndex = rowEnd;
+			}
+		}
+
+		void writeTileRow( size_t rowBegin )
+		{
+			const size_t numChannels = m_spec.channelnames.size();
+			const size_t tileRowLength = m_spec.tile_width * numChannels;
+			const size_t rowLength = tileRowLength * m_numTiles.x;
+
+			m_rowData.resize( rowLength * m_spec.tile_height );
+			for( int i = 0; i < m_numTiles.x; ++i )
+			{
+				ConstFloatVectorDataPtr tileData = m_tilesData[rowBegin + i];
+				if( tileData->readable().empty() )
 				{
-					writeTile( tileOrigin, blackTile() );
+					// If the tileData object hasn't been resized, then
+					// we have never even tried to write data to this
+					// tile, so write the static black tile.
+					tileData = blackTile();
 				}
-				else
+
+				const float *src = &tileData->readable()[0];
+				float *dst = &m_rowData[i * tileRowLength];
+				for( int y = 0; y < m_spec.tile_height; ++y )
 				{
-					break;
+					memcpy( dst, src, tileRowLength * sizeof( float ) );
+					src += tileRowLength;
+					dst += rowLength;
 				}
-			}
 
-			m_nextTileIndex = tileIndex;
-		}
-
-
-		void writeTile( const Imath::V2i &tileOrigin, ConstFloatVectorDataPtr tileData ) const
-		{
-			Imath::V2i exrTileOrigin = m_format.toEXRSpace( tileOrigin + Imath::V2i( 0, m_spec.tile_height - 1 ) );
+				m_tilesData[rowBegin + i].reset();
+			}
 
-			if( !m_out->write_tile( exrTileOrigin.x, exrTileOrigin.y, 0, TypeDesc::FLOAT, &tileData->readable()[0] ) )
+			const Imath::V2i exrRowOrigin = m_format.toEXRSpace( outTileOrigin( rowBegin ) + Imath::V2i( 0, m_spec.tile_height - 1 ) );
+			if( !m_out->write_tiles(
+				exrRowOrigin.x, std::min( exrRowOrigin.x + m_numTiles.x * m_spec.tile_width, m_spec.x + m_spec.width ),
+				exrRowOrigin.y, std::min( exrRowOrigin.y + m_spec.tile_height, m_spec.y + m_spec.height ),
+				0, 1,
+				TypeDesc::FLOAT, &m_rowData[0],
+				AutoStride, rowLength * sizeof( float )
+			) )
 			{
 				throw IECore::Exception( boost::str( boost::format( "Could not write tile to \"%s\", error = %s" ) % m_fileName % m_out->geterror() ) );
 			}
@@ -443,6 +487,7 @@ class FlatTileWriter
 		size_t m_nextTileIndex;
 		std::vector<FloatVectorDataPtr> m_tilesData;
 		std::vector<bool> m_tilesFilled;
+		std::vector<float> m_rowData;
 		ConstFloatVectorDataPtr m_blackTile;
 };
 
@@ -511,7 +556,15 @@ class FlatScanlineWriter
 
 			Imath::Box2i copyArea( BufferAlgo::intersection( m_processWindow, BufferAlgo::intersection( inTileBounds, scanlinesBounds ) ) );
 
-			copyBufferArea( &data->readable()[0], inTileBounds, &m_scanlinesData[0], scanlinesBounds, channelIndex, m_spec.channelnames.size(), true, copyArea );
+			float constantValue;
+			if( ImagePlug::isConstantTile( data.get(), constantValue ) )
+			{
+				fillBufferArea( constantValue, &m_scanlinesData[0], scanlinesBounds, channelIndex, m_spec.channelnames.size(), true, copyArea );
+			}
+			else
+			{
+				copyBufferArea( &data->readable()[0], inTileBounds, &m_scanlinesData[0], scanlinesBounds, channelIndex, m_spec.channelnames.size(), true, copyArea );
+			}
 
 			if( lastTileOfRow( channelIndex, tileOrigin ) )
 			{
@@ -344,6 +344,23 @@ struct MergeFunctor
 			return;
 		}
 
+		// If both inputs are constant across the whole tile, then so is
+		// the result, and we only need to perform a single operation.
+		const Box2i fullBound( V2i( 0 ), V2i( ImagePlug::tileSize() ) );
+		float constantA, constantB, constanta, constantb;
+		if(
+			boundA == fullBound && boundB == fullBound &&
+			ImagePlug::isConstantTile( channelDataA.get(), constantA ) &&
+			ImagePlug::isConstantTile( alphaDataA.get(), constanta ) &&
+			ImagePlug::isConstantTile( channelDataB.get(), constantB ) &&
+			ImagePlug::isConstantTile( alphaDataB.get(), constantb )
+		)
+		{
+			channelDataB = ImagePlug::constantTile( Op::operate( constantA, constantB, constanta, constantb ) );
+			alphaDataB = ImagePlug::constantTile( Op::operate( constanta, constantb, constanta, constantb ) );
+			return;
+		}
+
 		// The base layer (B) with the current result
 		const float *B = &channelDataB->readable().front();
 		const float *b = &alphaDataB->readable().front();
@@ -265,6 +265,11 @@ void OpenColorIOTransform::processColorData( const Gaffer::Context *context, IEC
 	processor->apply( image );
 }
 
+bool OpenColorIOTransform::processesConstantTiles() const
+{
+	return true;
+}
+
 void OpenColorIOTransform::availableColorSpaces( std::vector<std::string> &colorSpaces )
 {
 	OpenColorIO::ConstConfigRcPtr config = OpenColorIO::GetCurrentConfig();
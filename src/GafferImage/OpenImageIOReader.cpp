@@ -52,6 +52,7 @@
 #include "IECore/FileSequence.h"
 #include "IECore/FileSequenceFunctions.h"
 #include "IECore/MessageHandler.h"
+#include "IECore/VectorTypedData.h"
 
 #include "OpenImageIO/imagecache.h"
 #include "OpenImageIO/deepdata.h"
@@ -62,6 +63,7 @@
 
 #include "tbb/mutex.h"
 
+#include <atomic>
 #include <memory>
 
 OIIO_NAMESPACE_USING
@@ -78,6 +80,8 @@ namespace
 
 const IECore::InternedString g_tileBatchIndexContextName( "__tileBatchIndex" );
 
+std::atomic_bool g_halfTileStorage( false );
+
 struct ChannelMapEntry
 {
 	ChannelMapEntry( int subImage, int channelIndex )
@@ -193,6 +197,15 @@ class File
 
 				const OIIO::string_view subImageName = currentSpec.get_string_attribute( "name", "" );
 
+				if( (int)m_halfChannels.size() <= subImageIndex )
+				{
+					m_halfChannels.resize( subImageIndex + 1 );
+				}
+				for( int c = 0; c < currentSpec.nchannels; ++c )
+				{
+					m_halfChannels[subImageIndex].push_back( currentSpec.channelformat( c ) == TypeDesc::HALF );
+				}
+
 				for( const auto &n : currentSpec.channelnames )
 				{
 					std::string channelName = ImageAlgo::channelName( subImageName, n );
@@ -280,6 +293,11 @@ class File
 
 			std::vector< int > deepTileSizes;
 
+			// Channels stored as half in the file can be stored as half in the
+			// tile batch too, halving the memory they occupy in the cache. They
+			// are converted back to float on demand in `computeChannelData()`.
+			const bool halfTileStorage = g_halfTileStorage && !m_imageSpec.deep;
+
 			if( m_imageSpec.deep )
 			{
 				result = new ObjectVector();
@@ -393,7 +411,32 @@ class File
 							continue;
 						}
 
-						if( !m_imageSpec.deep )
+						if( halfTileStorage && isHalfChannel( tileBatchIndex.z, c ) )
+						{
+							HalfVectorDataPtr tileData = new IECore::HalfVectorData(
+								std::vector<half>( ImagePlug::tilePixels(), half( 0.0f ) )
+							);
+							vector<half> &tile = tileData->writable();
+
+							for( int y = tileRegion.min.y; y < tileRegion.max.y; ++y )
+							{
+								half *tileIndex = &tile[ y * ImagePlug::tileSize() + tileRegion.min.x ];
+								int scanline = fileDataRegion.size().y - 1 - (y - tileRelativeFileRegion.min.y);
+								const float *dataIndex = &fileData[
+									( scanline * fileDataRegion.size().x + tileRegion.min.x - tileRelativeFileRegion.min.x
+									) * nchannels + c
+								];
+								for( int x = tileRegion.min.x; x < tileRegion.max.x; x++ )
+								{
+									// Lossless, since the data was half in the file.
+									*tileIndex = *dataIndex;
+									tileIndex++;
+									dataIndex += nchannels;
+								}
+							}
+							resultChannels->members()[ subIndex ] = tileData;
+						}
+						else if( !m_imageSpec.deep )
 						{
 							FloatVectorDataPtr tileData = new IECore::FloatVectorData(
 								std::vector<float>( ImagePlug::tilePixels() )
@@ -629,8 +672,14 @@ class File
 			return channelIndex * tilePlaneSize + subIndex.y * m_tileBatchSize.x + subIndex.x;
 		}
 
+		bool isHalfChannel( int subImage, int channelIndex ) const
+		{
+			return m_halfChannels[subImage][channelIndex];
+		}
+
 		std::unique_ptr<ImageInput> m_imageInput;
 		ImageSpec m_imageSpec;
+		std::vector<std::vector<bool>> m_halfChannels;
 		ConstStringVectorDataPtr m_channelNamesData;
 		std::map<std::string, ChannelMapEntry> m_channelMap;
 		Imath::V2i m_tileBatchSize;
@@ -839,6 +888,16 @@ size_t OpenImageIOReader::getOpenFilesLimit()
 	return fileCache()->getMaxCost();
 }
 
+void OpenImageIOReader::setHalfTileStorage( bool halfTileStorage )
+{
+	g_halfTileStorage = halfTileStorage;
+}
+
+bool OpenImageIOReader::getHalfTileStorage()
+{
+	return g_halfTileStorage;
+}
+
 size_t OpenImageIOReader::supportedExtensions( std::vector<std::string> &extensions )
 {
 	std::string attr;
@@ -1241,6 +1300,16 @@ IECore::ConstFloatVectorDataPtr OpenImageIOReader::computeChannelData( const std
 	{
 		curTileChannel = IECore::runTimeCast< const ObjectVector >( tileBatch->members()[1] )->members()[ subIndex ];
 	}
+
+	if( auto halfTile = IECore::runTimeCast< const HalfVectorData >( curTileChannel.get() ) )
+	{
+		// Promote to float, since that is what downstream nodes expect.
+		const std::vector<half> &in = halfTile->readable();
+		FloatVectorDataPtr result = new FloatVectorData;
+		result->writable().assign( in.begin(), in.end() );
+		return result;
+	}
+
 	return IECore::runTimeCast< const FloatVectorData >( curTileChannel );
 }
 
@@ -0,0 +1,790 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2021, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferImage/SharedMemoryDisplayDriver.h"
+
+#include "IECoreImage/ClientDisplayDriver.h"
+
+#include "IECore/MemoryIndexedIO.h"
+#include "IECore/MessageHandler.h"
+#include "IECore/SimpleTypedData.h"
+#include "IECore/VectorTypedData.h"
+
+#include "boost/algorithm/string/predicate.hpp"
+#include "boost/date_time/posix_time/posix_time_types.hpp"
+#include "boost/interprocess/mapped_region.hpp"
+#include "boost/interprocess/shared_memory_object.hpp"
+#include "boost/interprocess/sync/interprocess_mutex.hpp"
+#include "boost/interprocess/sync/interprocess_semaphore.hpp"
+#include "boost/interprocess/sync/scoped_lock.hpp"
+#include "boost/lexical_cast.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <unistd.h>
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace IECoreImage;
+using namespace GafferImage;
+
+//////////////////////////////////////////////////////////////////////////
+// Shared memory layout
+//////////////////////////////////////////////////////////////////////////
+//
+// The shared memory segment contains a RingHeader followed by a ring
+// buffer of `capacity` bytes. Clients append messages to the ring at
+// `writePosition` and the server consumes them from `readPosition`.
+// Both positions count bytes monotonically, so the number of bytes in
+// flight is simply `writePosition - readPosition`. The server dispatches
+// each message directly from the ring before advancing `readPosition`,
+// so pixel data is never copied on the receiving side.
+//
+// Messages never wrap around the end of the ring : if there isn't room
+// for a whole message before the end, the writer skips to the start,
+// leaving a `Skip` message behind if there is room for one.
+//
+// A process may die while holding the mutex, leaving it locked forever.
+// We therefore never wait for the mutex indefinitely, and use semaphores
+// rather than interprocess conditions for signalling, because a condition
+// wait can't return until it has reacquired the mutex. If the server can't
+// acquire the mutex, it abandons the segment and creates a fresh one.
+
+namespace
+{
+
+const uint32_t g_magic = 0x47534d44; // "GSMD"
+const uint32_t g_version = 1;
+const size_t g_dataOffset = 256;
+// Clients give up on a server that has not been seen for this many seconds.
+const std::time_t g_serverTimeout = 10;
+// The mutex is only ever held briefly, so if we can't acquire it within
+// this time, we assume that it was abandoned by a process that died.
+const boost::posix_time::time_duration g_lockTimeout = boost::posix_time::seconds( 5 );
+const std::string g_gafferDisplayDriverType = "GafferImage::GafferDisplayDriver";
+
+using Lock = boost::interprocess::scoped_lock<boost::interprocess::interprocess_mutex>;
+
+struct RingHeader
+{
+
+	RingHeader()
+		:	dataWritten( 0 ), dataRead( 0 )
+	{
+	}
+
+	uint32_t magic;
+	uint32_t version;
+
+	boost::interprocess::interprocess_mutex mutex;
+	// Posted by clients when a message has been written
+	// and `serverWaiting` is set.
+	boost::interprocess::interprocess_semaphore dataWritten;
+	// Posted by the server once for each of the `readWaiters`
+	// when a message has been processed.
+	boost::interprocess::interprocess_semaphore dataRead;
+
+	uint64_t capacity;
+	uint64_t writePosition;
+	uint64_t readPosition;
+	uint32_t nextDriverId;
+	uint32_t serverRunning;
+	uint32_t serverWaiting;
+	uint32_t readWaiters;
+	// Updated without holding the mutex, so that it continues
+	// to be updated while the server is busy dispatching.
+	std::atomic<int64_t> heartbeat;
+
+};
+
+static_assert( sizeof( RingHeader ) <= g_dataOffset, "RingHeader too large" );
+static_assert( ATOMIC_LLONG_LOCK_FREE == 2, "Heartbeat must be lock free to be shared between processes" );
+
+enum MessageType : uint32_t
+{
+	Skip,
+	Open,
+	Data,
+	Close,
+	Release
+};
+
+struct MessageHeader
+{
+	uint32_t type;
+	uint32_t driverId;
+	uint64_t payloadSize;
+};
+
+uint64_t messageSize( uint64_t payloadSize )
+{
+	// Pad to keep all messages 8 byte aligned.
+	return sizeof( MessageHeader ) + ( ( payloadSize + 7 ) & ~uint64_t( 7 ) );
+}
+
+std::string segmentName( int portNumber )
+{
+	return "gafferDisplayDriver." + boost::lexical_cast<std::string>( portNumber );
+}
+
+boost::posix_time::ptime timeout()
+{
+	return boost::posix_time::microsec_clock::universal_time() + boost::posix_time::milliseconds( 100 );
+}
+
+bool timedLock( Lock &lock )
+{
+	return lock.timed_lock( boost::posix_time::microsec_clock::universal_time() + g_lockTimeout );
+}
+
+bool isLocalHost( const std::string &host )
+{
+	if( boost::iequals( host, "localhost" ) || host == "127.0.0.1" )
+	{
+		return true;
+	}
+
+	char hostName[256];
+	if( gethostname( hostName, sizeof( hostName ) ) == 0 )
+	{
+		hostName[sizeof(hostName)-1] = '\0';
+		return boost::iequals( host, hostName );
+	}
+
+	return false;
+}
+
+std::string stringParameter( const CompoundData *parameters, const char *name, const std::string &defaultValue )
+{
+	if( parameters )
+	{
+		if( const StringData *d = parameters->member<StringData>( name ) )
+		{
+			return d->readable();
+		}
+	}
+	return defaultValue;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryDisplayDriver::Connection
+//////////////////////////////////////////////////////////////////////////
+
+class SharedMemoryDisplayDriver::Connection
+{
+
+	public :
+
+		// Throws if the server can not be reached.
+		Connection( int portNumber )
+			:	m_segment( boost::interprocess::open_only, segmentName( portNumber ).c_str(), boost::interprocess::read_write ),
+				m_region( m_segment, boost::interprocess::read_write ), m_closed( false )
+		{
+			if( m_region.get_size() <= g_dataOffset )
+			{
+				throw IECore::Exception( "Invalid shared memory segment" );
+			}
+
+			m_header = static_cast<RingHeader *>( m_region.get_address() );
+			m_data = static_cast<char *>( m_region.get_address() ) + g_dataOffset;
+
+			if(
+				m_header->magic != g_magic || m_header->version != g_version ||
+				m_region.get_size() < g_dataOffset + m_header->capacity
+			)
+			{
+				throw IECore::Exception( "Invalid shared memory segment" );
+			}
+
+			Lock lock( m_header->mutex, boost::interprocess::defer_lock );
+			acquire( lock );
+			checkServer();
+			m_driverId = ++m_header->nextDriverId;
+		}
+
+		~Connection()
+		{
+			if( !m_closed )
+			{
+				try
+				{
+					send( Release, nullptr, 0, nullptr, 0 );
+				}
+				catch( ... )
+				{
+					// The server has gone away, so there
+					// is nothing to release.
+				}
+			}
+		}
+
+		uint64_t capacity() const
+		{
+			return m_header->capacity;
+		}
+
+		// Sends a message whose payload is the concatenation of `data1`
+		// and `data2`, returning the position just after the message.
+		uint64_t send( MessageType type, const void *data1, size_t size1, const void *data2, size_t size2 )
+		{
+			const uint64_t size = messageSize( size1 + size2 );
+			const uint64_t capacity = m_header->capacity;
+			if( size > capacity / 2 )
+			{
+				throw IECore::Exception( "SharedMemoryDisplayDriver : Message too large for buffer" );
+			}
+
+			Lock lock( m_header->mutex, boost::interprocess::defer_lock );
+			acquire( lock );
+
+			uint64_t padding;
+			while( true )
+			{
+				checkServer();
+				const uint64_t contiguous = capacity - m_header->writePosition % capacity;
+				padding = contiguous < size ? contiguous : 0;
+				if( capacity - ( m_header->writePosition - m_header->readPosition ) >= padding + size )
+				{
+					break;
+				}
+				waitForRead( lock );
+			}
+
+			if( padding )
+			{
+				if( padding >= sizeof( MessageHeader ) )
+				{
+					MessageHeader *skip = reinterpret_cast<MessageHeader *>( m_data + m_header->writePosition % capacity );
+					skip->type = Skip;
+					skip->driverId = m_driverId;
+					skip->payloadSize = 0;
+				}
+				m_header->writePosition += padding;
+			}
+
+			char *message = m_data + m_header->writePosition % capacity;
+			MessageHeader *messageHeader = reinterpret_cast<MessageHeader *>( message );
+			messageHeader->type = type;
+			messageHeader->driverId = m_driverId;
+			messageHeader->payloadSize = size1 + size2;
+			if( size1 )
+			{
+				memcpy( message + sizeof( MessageHeader ), data1, size1 );
+			}
+			if( size2 )
+			{
+				memcpy( message + sizeof( MessageHeader ) + size1, data2, size2 );
+			}
+
+			m_header->writePosition += size;
+			if( m_header->serverWaiting )
+			{
+				m_header->serverWaiting = 0;
+				m_header->dataWritten.post();
+			}
+
+			return m_header->writePosition;
+		}
+
+		// Waits until the server has processed all messages up to `position`.
+		void waitForServer( uint64_t position )
+		{
+			Lock lock( m_header->mutex, boost::interprocess::defer_lock );
+			acquire( lock );
+			while( m_header->readPosition < position )
+			{
+				checkServer();
+				waitForRead( lock );
+			}
+		}
+
+		void setClosed()
+		{
+			m_closed = true;
+		}
+
+	private :
+
+		static void acquire( Lock &lock )
+		{
+			if( !timedLock( lock ) )
+			{
+				throw IECore::Exception( "SharedMemoryDisplayDriver : Timed out waiting for server" );
+			}
+		}
+
+		// Must be called with the mutex held. Releases the mutex
+		// while waiting for the server to process a message.
+		void waitForRead( Lock &lock )
+		{
+			m_header->readWaiters++;
+			lock.unlock();
+			const bool posted = m_header->dataRead.timed_wait( timeout() );
+			acquire( lock );
+			if( !posted && m_header->readWaiters )
+			{
+				// The server resets `readWaiters` when it posts, so we
+				// only need to remove ourselves if we timed out.
+				m_header->readWaiters--;
+			}
+		}
+
+		// Must be called with the mutex held.
+		void checkServer() const
+		{
+			if( !m_header->serverRunning || std::time( nullptr ) - m_header->heartbeat > g_serverTimeout )
+			{
+				throw IECore::Exception( "SharedMemoryDisplayDriver : Server is not running" );
+			}
+		}
+
+		boost::interprocess::shared_memory_object m_segment;
+		boost::interprocess::mapped_region m_region;
+		RingHeader *m_header;
+		char *m_data;
+		uint32_t m_driverId;
+		bool m_closed;
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryDisplayDriver
+//////////////////////////////////////////////////////////////////////////
+
+const DisplayDriver::DisplayDriverDescription<SharedMemoryDisplayDriver> SharedMemoryDisplayDriver::g_description;
+
+SharedMemoryDisplayDriver::SharedMemoryDisplayDriver( const Imath::Box2i &displayWindow, const Imath::Box2i &dataWindow, const std::vector<std::string> &channelNames, IECore::ConstCompoundDataPtr parameters )
+	:	DisplayDriver( displayWindow, dataWindow, channelNames, parameters )
+{
+	// We only use shared memory when sending to a GafferDisplayDriver on
+	// this host, because we need to know in advance how the remote driver
+	// will respond to `scanLineOrderOnly()` and `acceptsRepeatedData()`.
+	// Anything else is sent over a socket, exactly as ClientDisplayDriver
+	// would do.
+
+	const std::string portNumber = stringParameter( parameters.get(), "displayPort", "" );
+	if(
+		isLocalHost( stringParameter( parameters.get(), "displayHost", "localhost" ) ) &&
+		stringParameter( parameters.get(), "remoteDisplayType", g_gafferDisplayDriverType ) == g_gafferDisplayDriverType &&
+		!portNumber.empty()
+	)
+	{
+		try
+		{
+			m_connection.reset( new Connection( boost::lexical_cast<int>( portNumber ) ) );
+		}
+		catch( ... )
+		{
+			// No server available. Fall through to use a socket instead.
+		}
+	}
+
+	if( !m_connection )
+	{
+		m_fallback = new ClientDisplayDriver( displayWindow, dataWindow, channelNames, parameters );
+		return;
+	}
+
+	CompoundDataPtr openData = new CompoundData;
+	openData->writable()["displayWindow"] = new Box2iData( displayWindow );
+	openData->writable()["dataWindow"] = new Box2iData( dataWindow );
+	openData->writable()["channelNames"] = new StringVectorData( channelNames );
+	openData->writable()["parameters"] = parameters ? parameters->copy() : CompoundDataPtr( new CompoundData );
+
+	MemoryIndexedIOPtr io = new MemoryIndexedIO( ConstCharVectorDataPtr(), IndexedIO::rootPath, IndexedIO::Exclusive | IndexedIO::Write );
+	openData->Object::save( io, "open" );
+	ConstCharVectorDataPtr buffer = io->buffer();
+
+	m_connection->send( Open, buffer->readable().data(), buffer->readable().size(), nullptr, 0 );
+}
+
+SharedMemoryDisplayDriver::~SharedMemoryDisplayDriver()
+{
+}
+
+bool SharedMemoryDisplayDriver::scanLineOrderOnly() const
+{
+	return m_fallback ? m_fallback->scanLineOrderOnly() : false;
+}
+
+bool SharedMemoryDisplayDriver::acceptsRepeatedData() const
+{
+	return m_fallback ? m_fallback->acceptsRepeatedData() : true;
+}
+
+void SharedMemoryDisplayDriver::imageData( const Imath::Box2i &box, const float *data, size_t dataSize )
+{
+	if( m_fallback )
+	{
+		m_fallback->imageData( box, data, dataSize );
+		return;
+	}
+
+	// Split the bucket into chunks of whole rows, small enough
+	// that we never need to wait for the entire ring to drain
+	// before we can write.
+
+	const size_t width = box.max.x - box.min.x + 1;
+	const size_t height = box.max.y - box.min.y + 1;
+	const size_t rowSize = dataSize / height;
+	if( rowSize * height != dataSize || rowSize % width )
+	{
+		throw IECore::Exception( "SharedMemoryDisplayDriver : Invalid data size" );
+	}
+
+	const size_t maxChunkBytes = m_connection->capacity() / 4 - sizeof( MessageHeader ) - sizeof( Box2i );
+	const size_t rowsPerChunk = maxChunkBytes / ( rowSize * sizeof( float ) );
+	if( !rowsPerChunk )
+	{
+		throw IECore::Exception( "SharedMemoryDisplayDriver : Bucket too wide for buffer" );
+	}
+
+	for( size_t y = 0; y < height; y += rowsPerChunk )
+	{
+		const size_t numRows = std::min( rowsPerChunk, height - y );
+		const Box2i chunkBox(
+			V2i( box.min.x, box.min.y + y ),
+			V2i( box.max.x, box.min.y + y + numRows - 1 )
+		);
+		m_connection->send(
+			Data,
+			&chunkBox, sizeof( Box2i ),
+			data + y * rowSize, numRows * rowSize * sizeof( float )
+		);
+	}
+}
+
+void SharedMemoryDisplayDriver::imageClose()
+{
+	if( m_fallback )
+	{
+		m_fallback->imageClose();
+		return;
+	}
+
+	// Like ClientDisplayDriver, we don't return until the server
+	// has closed the image.
+	const uint64_t position = m_connection->send( Close, nullptr, 0, nullptr, 0 );
+	m_connection->setClosed();
+	m_connection->waitForServer( position );
+}
+
+bool SharedMemoryDisplayDriver::usingSharedMemory() const
+{
+	return (bool)m_connection;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryDisplayDriverServer
+//////////////////////////////////////////////////////////////////////////
+
+class SharedMemoryDisplayDriverServer::PrivateData
+{
+
+	public :
+
+		PrivateData( int portNumber, size_t bufferSize )
+			:	m_portNumber( portNumber ), m_name( segmentName( portNumber ) ), m_bufferSize( ( bufferSize + 7 ) & ~size_t( 7 ) ), m_stopping( false )
+		{
+			createSegment();
+			m_thread = std::thread( &PrivateData::run, this );
+			m_heartbeatThread = std::thread( &PrivateData::heartbeat, this );
+		}
+
+		~PrivateData()
+		{
+			{
+				std::lock_guard<std::mutex> lock( m_segmentMutex );
+				m_stopping = true;
+				m_header->dataWritten.post();
+			}
+			m_stoppingChanged.notify_all();
+			m_thread.join();
+			m_heartbeatThread.join();
+			boost::interprocess::shared_memory_object::remove( m_name.c_str() );
+		}
+
+		const int m_portNumber;
+
+	private :
+
+		void createSegment()
+		{
+			// Remove any segment left behind by a process that
+			// crashed without cleaning up.
+			boost::interprocess::shared_memory_object::remove( m_name.c_str() );
+
+			boost::interprocess::shared_memory_object segment( boost::interprocess::create_only, m_name.c_str(), boost::interprocess::read_write );
+			segment.truncate( g_dataOffset + m_bufferSize );
+			boost::interprocess::mapped_region region( segment, boost::interprocess::read_write );
+
+			RingHeader *header = new( region.get_address() ) RingHeader;
+			header->capacity = m_bufferSize;
+			header->writePosition = 0;
+			header->readPosition = 0;
+			header->nextDriverId = 0;
+			header->serverRunning = 1;
+			header->serverWaiting = 0;
+			header->readWaiters = 0;
+			header->heartbeat = std::time( nullptr );
+			header->version = g_version;
+			// Written last, so that clients never see
+			// a partially initialised header.
+			header->magic = g_magic;
+
+			std::lock_guard<std::mutex> lock( m_segmentMutex );
+			m_segment.swap( segment );
+			m_region.swap( region );
+			m_header = header;
+			m_data = static_cast<char *>( m_region.get_address() ) + g_dataOffset;
+		}
+
+		void run()
+		{
+			while( !serve() )
+			{
+				// A client died while holding the mutex. We can't safely
+				// unlock it on its behalf, so we abandon the segment
+				// and start again with a fresh one. Clients still using
+				// the old segment will time out and report an error.
+				IECore::msg( IECore::Msg::Warning, "SharedMemoryDisplayDriverServer", "Mutex abandoned by client. Recreating shared memory segment." );
+				m_header->serverRunning = 0;
+				m_drivers.clear();
+				createSegment();
+			}
+
+			m_drivers.clear();
+		}
+
+		// Returns false if the mutex could not be acquired.
+		bool serve()
+		{
+			const uint64_t capacity = m_header->capacity;
+
+			Lock lock( m_header->mutex, boost::interprocess::defer_lock );
+			if( !timedLock( lock ) )
+			{
+				return false;
+			}
+
+			while( !m_stopping )
+			{
+				if( m_header->readPosition == m_header->writePosition )
+				{
+					m_header->serverWaiting = 1;
+					lock.unlock();
+					m_header->dataWritten.timed_wait( timeout() );
+					if( !timedLock( lock ) )
+					{
+						return false;
+					}
+					continue;
+				}
+
+				const uint64_t offset = m_header->readPosition % capacity;
+				const uint64_t contiguous = capacity - offset;
+				const MessageHeader *message = reinterpret_cast<const MessageHeader *>( m_data + offset );
+				if( contiguous < sizeof( MessageHeader ) || message->type == Skip )
+				{
+					m_header->readPosition += contiguous;
+					notifyRead();
+					continue;
+				}
+
+				// Clients never write into the region between `readPosition`
+				// and `writePosition`, so we can dispatch the message without
+				// holding the lock, allowing clients to continue writing in
+				// the meantime.
+				const uint64_t end = m_header->readPosition + messageSize( message->payloadSize );
+				lock.unlock();
+				dispatch( message, reinterpret_cast<const char *>( message ) + sizeof( MessageHeader ) );
+				if( !timedLock( lock ) )
+				{
+					return false;
+				}
+
+				m_header->readPosition = end;
+				notifyRead();
+			}
+
+			m_header->serverRunning = 0;
+			notifyRead();
+			return true;
+		}
+
+		// Must be called with the mutex held.
+		void notifyRead()
+		{
+			for( uint32_t i = 0; i < m_header->readWaiters; ++i )
+			{
+				m_header->dataRead.post();
+			}
+			m_header->readWaiters = 0;
+		}
+
+		// Runs on a separate thread so that clients don't mistake
+		// a long dispatch for a server that has gone away.
+		void heartbeat()
+		{
+			std::unique_lock<std::mutex> lock( m_segmentMutex );
+			while( !m_stopping )
+			{
+				m_header->heartbeat = std::time( nullptr );
+				m_stoppingChanged.wait_for( lock, std::chrono::seconds( 1 ) );
+			}
+		}
+
+		void dispatch( const MessageHeader *message, const char *payload )
+		{
+			try
+			{
+				switch( message->type )
+				{
+					case Open :
+						open( message->driverId, payload, message->payloadSize );
+						break;
+					case Data : {
+						auto it = m_drivers.find( message->driverId );
+						if( it != m_drivers.end() && it->second )
+						{
+							const Box2i *box = reinterpret_cast<const Box2i *>( payload );
+							it->second->imageData(
+								*box, reinterpret_cast<const float *>( payload + sizeof( Box2i ) ),
+								( message->payloadSize - sizeof( Box2i ) ) / sizeof( float )
+							);
+						}
+						break;
+					}
+					case Close : {
+						auto it = m_drivers.find( message->driverId );
+						if( it != m_drivers.end() )
+						{
+							DisplayDriverPtr driver = it->second;
+							m_drivers.erase( it );
+							if( driver )
+							{
+								driver->imageClose();
+							}
+						}
+						break;
+					}
+					case Release :
+						m_drivers.erase( message->driverId );
+						break;
+					default :
+						break;
+				}
+			}
+			catch( const std::exception &e )
+			{
+				// Don't let a misbehaving driver stop the server, but
+				// do discard it so that we don't report the same error
+				// for every bucket.
+				auto it = m_drivers.find( message->driverId );
+				if( it != m_drivers.end() )
+				{
+					it->second = nullptr;
+				}
+				IECore::msg( IECore::Msg::Error, "SharedMemoryDisplayDriverServer", e.what() );
+			}
+		}
+
+		void open( uint32_t driverId, const char *payload, size_t payloadSize )
+		{
+			m_drivers[driverId] = nullptr;
+
+			CharVectorDataPtr buffer = new CharVectorData( vector<char>( payload, payload + payloadSize ) );
+			MemoryIndexedIOPtr io = new MemoryIndexedIO( buffer, IndexedIO::rootPath, IndexedIO::Exclusive | IndexedIO::Read );
+			ConstCompoundDataPtr openData = runTimeCast<CompoundData>( Object::load( io, "open" ) );
+			if( !openData )
+			{
+				throw IECore::Exception( "Invalid open message" );
+			}
+
+			ConstCompoundDataPtr parameters = openData->member<CompoundData>( "parameters", /* throwExceptions = */ true );
+			m_drivers[driverId] = DisplayDriver::create(
+				stringParameter( parameters.get(), "remoteDisplayType", g_gafferDisplayDriverType ),
+				openData->member<Box2iData>( "displayWindow", /* throwExceptions = */ true )->readable(),
+				openData->member<Box2iData>( "dataWindow", /* throwExceptions = */ true )->readable(),
+				openData->member<StringVectorData>( "channelNames", /* throwExceptions = */ true )->readable(),
+				parameters
+			);
+		}
+
+		const std::string m_name;
+		const size_t m_bufferSize;
+
+		// Protects the members below from being read by the
+		// heartbeat thread while `createSegment()` replaces them.
+		std::mutex m_segmentMutex;
+		boost::interprocess::shared_memory_object m_segment;
+		boost::interprocess::mapped_region m_region;
+		RingHeader *m_header;
+		char *m_data;
+
+		std::atomic_bool m_stopping;
+		std::condition_variable m_stoppingChanged;
+		std::thread m_thread;
+		std::thread m_heartbeatThread;
+
+		// Only accessed from `m_thread`.
+		std::unordered_map<uint32_t, DisplayDriverPtr> m_drivers;
+
+};
+
+SharedMemoryDisplayDriverServer::SharedMemoryDisplayDriverServer( int portNumber, size_t bufferSize )
+	:	m_data( new PrivateData( portNumber, bufferSize ) )
+{
+}
+
+SharedMemoryDisplayDriverServer::~SharedMemoryDisplayDriverServer()
+{
+}
+
+int SharedMemoryDisplayDriverServer::portNumber() const
+{
+	return m_data->m_portNumber;
+}
@@ -125,6 +125,16 @@ void Unpremultiply::processChannelData( const Gaffer::Context *context, const Im
 	const std::vector<float> &a = aData->readable();
 	std::vector<float> &out = outData->writable();
 
+	float constantAlpha;
+	if( out.size() == 1 && !ImagePlug::isConstantTile( aData.get(), constantAlpha ) )
+	{
+		// We've been given a constant tile to process, but the
+		// alpha varies, so we must expand it to a full tile. When
+		// the alpha is also constant, the loop below processes
+		// just the single value.
+		out.resize( a.size(), out[0] );
+	}
+
 	std::vector<float>::const_iterator aIt = a.begin();
 	for ( std::vector<float>::iterator outIt = out.begin(), outItEnd = out.end(); outIt != outItEnd; ++outIt, ++aIt )
 	{
@@ -135,4 +145,9 @@ void Unpremultiply::processChannelData( const Gaffer::Context *context, const Im
 	}
 }
 
+bool Unpremultiply::processesConstantTiles() const
+{
+	return true;
+}
+
 } // namespace GafferImage
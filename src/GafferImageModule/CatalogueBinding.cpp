@@ -38,12 +38,15 @@
 
 #include "GafferImage/Catalogue.h"
 #include "GafferImage/Display.h"
+#include "GafferImage/SharedMemoryDisplayDriver.h"
 
 #include "GafferBindings/DependencyNodeBinding.h"
 #include "GafferBindings/PlugBinding.h"
 #include "GafferBindings/SignalBinding.h"
 
 #include "IECorePython/ExceptionAlgo.h"
+#include "IECorePython/RefCountedBinding.h"
+#include "IECorePython/RunTimeTypedBinding.h"
 #include "IECorePython/ScopedGILRelease.h"
 
 using namespace boost::python;
@@ -107,6 +110,12 @@ void save( Catalogue::Image &image, const std::string &fileName )
 	image.save( fileName );
 }
 
+void compressDriver( Display &display )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	display.compressDriver();
+}
+
 std::string generateFileName1( Catalogue &catalogue, const Catalogue::Image *image )
 {
 	IECorePython::ScopedGILRelease gilRelease;
@@ -128,6 +137,8 @@ void GafferImageModule::bindCatalogue()
 		scope s = GafferBindings::DependencyNodeClass<Display>()
 			.def( "setDriver", &Display::setDriver, ( arg( "driver" ), arg( "copy" ) = false ) )
 			.def( "getDriver", (IECoreImage::DisplayDriver *(Display::*)())&Display::getDriver, return_value_policy<CastToIntrusivePtr>() )
+			.def( "compressDriver", &compressDriver )
+			.def( "driverMemoryUsage", &Display::driverMemoryUsage )
 			.def( "driverCreatedSignal", &Display::driverCreatedSignal, return_value_policy<reference_existing_object>() ).staticmethod( "driverCreatedSignal" )
 			.def( "imageReceivedSignal", &Display::imageReceivedSignal, return_value_policy<reference_existing_object>() ).staticmethod( "imageReceivedSignal" )
 		;
@@ -135,6 +146,15 @@ void GafferImageModule::bindCatalogue()
 		SignalClass<Display::DriverCreatedSignal, DefaultSignalCaller<Display::DriverCreatedSignal>, DriverCreatedSlotCaller>( "DriverCreated" );
 	}
 
+	IECorePython::RunTimeTypedClass<SharedMemoryDisplayDriver>()
+		.def( "usingSharedMemory", &SharedMemoryDisplayDriver::usingSharedMemory )
+	;
+
+	IECorePython::RefCountedClass<SharedMemoryDisplayDriverServer, IECore::RefCounted>( "SharedMemoryDisplayDriverServer" )
+		.def( init<int, size_t>( ( arg( "portNumber" ), arg( "bufferSize" ) = 64 * 1024 * 1024 ) ) )
+		.def( "portNumber", &SharedMemoryDisplayDriverServer::portNumber )
+	;
+
 	{
 		scope s = GafferBindings::DependencyNodeClass<Catalogue>()
 			.def( "generateFileName", &generateFileName1 )
@@ -156,6 +176,7 @@ void GafferImageModule::bindCatalogue()
 			.def( "copyFrom", &copyFrom )
 			.def( "load", Catalogue::Image::load )
 			.def( "save", &save )
+			.def( "memoryUsage", &Catalogue::Image::memoryUsage )
 			.staticmethod( "load" )
 			.attr( "__qualname__" ) = "Catalogue.Image"
 		;
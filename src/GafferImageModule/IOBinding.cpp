@@ -130,6 +130,10 @@ void GafferImageModule::bindIO()
 			.staticmethod( "setOpenFilesLimit" )
 			.def( "getOpenFilesLimit", &OpenImageIOReader::getOpenFilesLimit )
 			.staticmethod( "getOpenFilesLimit" )
+			.def( "setHalfTileStorage", &OpenImageIOReader::setHalfTileStorage )
+			.staticmethod( "setHalfTileStorage" )
+			.def( "getHalfTileStorage", &OpenImageIOReader::getHalfTileStorage )
+			.staticmethod( "getHalfTileStorage" )
 			.def( "supportedExtensions", &supportedExtensions<OpenImageIOReader> )
 			.staticmethod( "supportedExtensions" )
 		;
@@ -43,9 +43,13 @@
 
 #include "Gaffer/Node.h"
 
+#include "IECoreImage/DisplayDriver.h"
+
 #include "IECorePython/RefCountedBinding.h"
 #include "IECorePython/ScopedGILRelease.h"
 
+#include "boost/python/stl_iterator.hpp"
+
 using namespace boost::python;
 using namespace Gaffer;
 using namespace GafferImage;
@@ -99,6 +103,51 @@ boost::signals::connection connectProcessTilesToPlugDirtiedSignal( GafferImage::
 	return const_cast<Node *>( node )->plugDirtiedSignal().connect( boost::bind( &processTilesOnDirty, ::_1, image ) );
 }
 
+// Streams a synthetic image through a DisplayDriver, in the same way a
+// renderer would. Used to test and benchmark the transport between renderers
+// and the Catalogue, independent of the speed of any particular renderer.
+void streamSyntheticBuckets( const std::string &driverType, const Imath::Box2i &displayWindow, const Imath::Box2i &dataWindow, object pythonChannelNames, IECore::CompoundDataPtr parameters, int bucketSize )
+{
+	std::vector<std::string> channelNames(
+		stl_input_iterator<std::string>( pythonChannelNames ),
+		stl_input_iterator<std::string>()
+	);
+
+	IECorePython::ScopedGILRelease gilRelease;
+
+	IECoreImage::DisplayDriverPtr driver = IECoreImage::DisplayDriver::create(
+		driverType, displayWindow, dataWindow, channelNames, parameters
+	);
+
+	std::vector<float> data;
+	for( int y = dataWindow.min.y; y <= dataWindow.max.y; y += bucketSize )
+	{
+		for( int x = dataWindow.min.x; x <= dataWindow.max.x; x += bucketSize )
+		{
+			const Imath::Box2i bucket(
+				Imath::V2i( x, y ),
+				Imath::V2i( std::min( x + bucketSize - 1, dataWindow.max.x ), std::min( y + bucketSize - 1, dataWindow.max.y ) )
+			);
+
+			data.clear();
+			for( int by = bucket.min.y; by <= bucket.max.y; ++by )
+			{
+				for( int bx = bucket.min.x; bx <= bucket.max.x; ++bx )
+				{
+					for( size_t c = 0; c < channelNames.size(); ++c )
+					{
+						data.push_back( (float)( ( bx ^ by ) & 255 ) / 255.0f + c );
+					}
+				}
+			}
+
+			driver->imageData( bucket, data.data(), data.size() );
+		}
+	}
+
+	driver->imageClose();
+}
+
 } // namespace
 
 BOOST_PYTHON_MODULE( _GafferImageTest )
@@ -109,4 +158,5 @@ BOOST_PYTHON_MODULE( _GafferImageTest )
 
 	def( "processTiles", &processTilesWrapper );
 	def( "connectProcessTilesToPlugDirtiedSignal", &connectProcessTilesToPlugDirtiedSignal );
+	def( "streamSyntheticBuckets", &streamSyntheticBuckets, ( arg( "driverType" ), arg( "displayWindow" ), arg( "dataWindow" ), arg( "channelNames" ), arg( "parameters" ), arg( "bucketSize" ) = 64 ) );
 }
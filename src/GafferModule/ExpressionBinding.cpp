@@ -41,14 +41,25 @@
 #include "GafferBindings/DependencyNodeBinding.h"
 #include "GafferBindings/SignalBinding.h"
 
+#include "Gaffer/Context.h"
 #include "Gaffer/Expression.h"
+#include "Gaffer/NumericPlug.h"
 #include "Gaffer/StringPlug.h"
+#include "Gaffer/TypedPlug.h"
 
 #include "IECorePython/ExceptionAlgo.h"
 #include "IECorePython/RefCountedBinding.h"
 #include "IECorePython/ScopedGILLock.h"
 
 #include "IECore/MessageHandler.h"
+#include "IECore/NullObject.h"
+#include "IECore/ObjectVector.h"
+#include "IECore/SimpleTypedData.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_map>
 
 using namespace boost::python;
 using namespace GafferBindings;
@@ -144,6 +155,725 @@ ValuePlug::CachePolicy defaultExecuteCachePolicy()
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+// NativeProgram. This evaluates the simple stack-based programs generated
+// by `_NativeCompiler` in PythonExpressionEngine.py, allowing common
+// expressions to be evaluated without the GIL. Rather than replicate every
+// corner of Python's semantics, we throw `Unsupported` whenever we stray
+// from the well-trodden path, and the caller falls back to Python.
+//////////////////////////////////////////////////////////////////////////
+
+class NativeProgram
+{
+
+	public :
+
+		struct Unsupported
+		{
+		};
+
+		// Returns nullptr if the program uses anything we don't support.
+		static std::unique_ptr<NativeProgram> fromPython( object program )
+		{
+			std::unique_ptr<NativeProgram> result( new NativeProgram );
+
+			const object instructions = program[0];
+			result->m_numLocals = extract<size_t>( program[1] );
+			result->m_numOutputs = extract<size_t>( program[2] );
+
+			for( size_t i = 0, e = len( instructions ); i < e; ++i )
+			{
+				const std::string opcodeName = extract<std::string>( instructions[i][0] );
+				const object argument = instructions[i][1];
+
+				auto it = opcodes().find( opcodeName );
+				if( it == opcodes().end() )
+				{
+					return nullptr;
+				}
+
+				Instruction instruction;
+				instruction.opcode = it->second;
+				switch( instruction.opcode )
+				{
+					case Opcode::Constant :
+						if( !valueFromPython( argument, instruction.constant ) )
+						{
+							return nullptr;
+						}
+						break;
+					case Opcode::Context :
+					case Opcode::ContextGet :
+					case Opcode::Contains :
+						instruction.name = extract<std::string>( argument )();
+						break;
+					case Opcode::Input :
+					case Opcode::Load :
+					case Opcode::Store :
+					case Opcode::Output :
+					case Opcode::Min :
+					case Opcode::Max :
+						instruction.index = extract<size_t>( argument );
+						break;
+					default :
+						break;
+				}
+				result->m_instructions.push_back( instruction );
+			}
+
+			return result;
+		}
+
+		// Returns nullptr if the expression must be evaluated by Python instead.
+		IECore::ConstObjectVectorPtr execute( const Context *context, const std::vector<const ValuePlug *> &proxyInputs ) const
+		{
+			try
+			{
+				return executeInternal( context, proxyInputs );
+			}
+			catch( const Unsupported & )
+			{
+				return nullptr;
+			}
+		}
+
+		// Returns false if the value must be applied by Python instead.
+		bool apply( ValuePlug *proxyOutput, const ValuePlug *topLevelProxyOutput, const IECore::Object *value ) const
+		{
+			if( proxyOutput != topLevelProxyOutput )
+			{
+				return false;
+			}
+
+			if( value->isInstanceOf( IECore::NullObject::staticTypeId() ) )
+			{
+				proxyOutput->setToDefault();
+				return true;
+			}
+
+			switch( (Gaffer::TypeId)proxyOutput->typeId() )
+			{
+				case FloatPlugTypeId : {
+					double d;
+					if( !numericData( value, d ) )
+					{
+						return false;
+					}
+					static_cast<FloatPlug *>( proxyOutput )->setValue( d );
+					return true;
+				}
+				case IntPlugTypeId : {
+					double d;
+					if( !numericData( value, d ) )
+					{
+						return false;
+					}
+					d = std::trunc( d );
+					if( !( d >= std::numeric_limits<int>::min() && d <= std::numeric_limits<int>::max() ) )
+					{
+						return false;
+					}
+					static_cast<IntPlug *>( proxyOutput )->setValue( (int)d );
+					return true;
+				}
+				case BoolPlugTypeId :
+					if( auto b = IECore::runTimeCast<const IECore::BoolData>( value ) )
+					{
+						static_cast<BoolPlug *>( proxyOutput )->setValue( b->readable() );
+						return true;
+					}
+					return false;
+				case StringPlugTypeId :
+					if( auto s = IECore::runTimeCast<const IECore::StringData>( value ) )
+					{
+						static_cast<StringPlug *>( proxyOutput )->setValue( s->readable() );
+						return true;
+					}
+					return false;
+				default :
+					return false;
+			}
+		}
+
+	private :
+
+		NativeProgram()
+			:	m_numLocals( 0 ), m_numOutputs( 0 )
+		{
+		}
+
+		enum class Opcode
+		{
+			Constant, Input, Context, ContextGet, Contains, Frame, Time, FramesPerSecond,
+			Load, Store, Output,
+			Add, Subtract, Multiply, Divide, ClassicDivide, FloorDivide, Modulo, Power,
+			Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual, And, Or,
+			Negate, Positive, Not, Select,
+			Int, Float, Str, Abs, Min, Max
+		};
+
+		static const std::unordered_map<std::string, Opcode> &opcodes()
+		{
+			static const std::unordered_map<std::string, Opcode> g_opcodes = {
+				{ "constant", Opcode::Constant }, { "input", Opcode::Input }, { "context", Opcode::Context },
+				{ "contextGet", Opcode::ContextGet }, { "contains", Opcode::Contains }, { "frame", Opcode::Frame },
+				{ "time", Opcode::Time }, { "framesPerSecond", Opcode::FramesPerSecond },
+				{ "load", Opcode::Load }, { "store", Opcode::Store }, { "output", Opcode::Output },
+				{ "add", Opcode::Add }, { "subtract", Opcode::Subtract }, { "multiply", Opcode::Multiply },
+				{ "divide", Opcode::Divide }, { "classicDivide", Opcode::ClassicDivide }, { "floorDivide", Opcode::FloorDivide },
+				{ "modulo", Opcode::Modulo }, { "power", Opcode::Power },
+				{ "equal", Opcode::Equal }, { "notEqual", Opcode::NotEqual }, { "less", Opcode::Less },
+				{ "lessEqual", Opcode::LessEqual }, { "greater", Opcode::Greater }, { "greaterEqual", Opcode::GreaterEqual },
+				{ "and", Opcode::And }, { "or", Opcode::Or },
+				{ "negate", Opcode::Negate }, { "positive", Opcode::Positive }, { "not", Opcode::Not }, { "select", Opcode::Select },
+				{ "int", Opcode::Int }, { "float", Opcode::Float }, { "str", Opcode::Str }, { "abs", Opcode::Abs },
+				{ "min", Opcode::Min }, { "max", Opcode::Max }
+			};
+			return g_opcodes;
+		}
+
+		// Equivalent to the Python `bool`, `int`, `float` and `str` types.
+		// Bools are stored in `i`, as Python treats them as integers in
+		// arithmetic.
+		struct Value
+		{
+			enum Type { Bool, Int, Float, String };
+
+			Value( Type type = Int, int64_t i = 0, double f = 0.0 )
+				:	type( type ), i( i ), f( f )
+			{
+			}
+
+			Value( const std::string &s )
+				:	type( String ), i( 0 ), f( 0.0 ), s( s )
+			{
+			}
+
+			bool numeric() const
+			{
+				return type != String;
+			}
+
+			double asDouble() const
+			{
+				return type == Float ? f : (double)i;
+			}
+
+			bool truthy() const
+			{
+				switch( type )
+				{
+					case Float :
+						return f != 0.0;
+					case String :
+						return !s.empty();
+					default :
+						return i != 0;
+				}
+			}
+
+			Type type;
+			int64_t i;
+			double f;
+			std::string s;
+		};
+
+		struct Instruction
+		{
+			Instruction()
+				:	opcode( Opcode::Constant ), index( 0 )
+			{
+			}
+
+			Opcode opcode;
+			Value constant;
+			IECore::InternedString name;
+			size_t index;
+		};
+
+		static bool valueFromPython( object o, Value &value )
+		{
+			if( PyBool_Check( o.ptr() ) )
+			{
+				value = Value( Value::Bool, o.ptr() == Py_True );
+				return true;
+			}
+			else if( PyFloat_Check( o.ptr() ) )
+			{
+				value = Value( Value::Float, 0, extract<double>( o ) );
+				return true;
+			}
+
+			extract<int64_t> i( o );
+			if( i.check() )
+			{
+				value = Value( Value::Int, i() );
+				return true;
+			}
+
+			extract<std::string> s( o );
+			if( s.check() )
+			{
+				value = Value( s() );
+				return true;
+			}
+
+			return false;
+		}
+
+		static Value valueFromData( const IECore::Data *data )
+		{
+			switch( data ? (IECore::TypeId)data->typeId() : IECore::InvalidTypeId )
+			{
+				case IECore::BoolDataTypeId :
+					return Value( Value::Bool, static_cast<const IECore::BoolData *>( data )->readable() );
+				case IECore::IntDataTypeId :
+					return Value( Value::Int, static_cast<const IECore::IntData *>( data )->readable() );
+				case IECore::FloatDataTypeId :
+					return Value( Value::Float, 0, static_cast<const IECore::FloatData *>( data )->readable() );
+				case IECore::DoubleDataTypeId :
+					return Value( Value::Float, 0, static_cast<const IECore::DoubleData *>( data )->readable() );
+				case IECore::StringDataTypeId :
+					return Value( static_cast<const IECore::StringData *>( data )->readable() );
+				default :
+					throw Unsupported();
+			}
+		}
+
+		static Value valueFromPlug( const ValuePlug *plug )
+		{
+			switch( (Gaffer::TypeId)plug->typeId() )
+			{
+				case BoolPlugTypeId :
+					return Value( Value::Bool, static_cast<const BoolPlug *>( plug )->getValue() );
+				case IntPlugTypeId :
+					return Value( Value::Int, static_cast<const IntPlug *>( plug )->getValue() );
+				case FloatPlugTypeId :
+					return Value( Value::Float, 0, static_cast<const FloatPlug *>( plug )->getValue() );
+				case StringPlugTypeId :
+					return Value( static_cast<const StringPlug *>( plug )->getValue() );
+				default :
+					throw Unsupported();
+			}
+		}
+
+		static IECore::ObjectPtr valueToData( const Value &value )
+		{
+			switch( value.type )
+			{
+				case Value::Bool :
+					return new IECore::BoolData( value.i );
+				case Value::Int :
+					if( value.i < std::numeric_limits<int>::min() || value.i > std::numeric_limits<int>::max() )
+					{
+						throw Unsupported();
+					}
+					return new IECore::IntData( value.i );
+				case Value::Float :
+					return new IECore::DoubleData( value.f );
+				default :
+					return new IECore::StringData( value.s );
+			}
+		}
+
+		static bool numericData( const IECore::Object *value, double &result )
+		{
+			switch( (IECore::TypeId)value->typeId() )
+			{
+				case IECore::BoolDataTypeId :
+					result = static_cast<const IECore::BoolData *>( value )->readable();
+					return true;
+				case IECore::IntDataTypeId :
+					result = static_cast<const IECore::IntData *>( value )->readable();
+					return true;
+				case IECore::DoubleDataTypeId :
+					result = static_cast<const IECore::DoubleData *>( value )->readable();
+					return true;
+				default :
+					return false;
+			}
+		}
+
+		static int64_t add( int64_t a, int64_t b )
+		{
+			int64_t r;
+			if( __builtin_add_overflow( a, b, &r ) )
+			{
+				throw Unsupported();
+			}
+			return r;
+		}
+
+		static int64_t subtract( int64_t a, int64_t b )
+		{
+			int64_t r;
+			if( __builtin_sub_overflow( a, b, &r ) )
+			{
+				throw Unsupported();
+			}
+			return r;
+		}
+
+		static int64_t multiply( int64_t a, int64_t b )
+		{
+			int64_t r;
+			if( __builtin_mul_overflow( a, b, &r ) )
+			{
+				throw Unsupported();
+			}
+			return r;
+		}
+
+		static Value arithmetic( Opcode opcode, const Value &a, const Value &b )
+		{
+			if( !a.numeric() || !b.numeric() )
+			{
+				if( opcode == Opcode::Add && a.type == Value::String && b.type == Value::String )
+				{
+					return Value( a.s + b.s );
+				}
+				throw Unsupported();
+			}
+
+			const bool integer = a.type != Value::Float && b.type != Value::Float;
+			switch( opcode )
+			{
+				case Opcode::Add :
+					return integer ? Value( Value::Int, add( a.i, b.i ) ) : Value( Value::Float, 0, a.asDouble() + b.asDouble() );
+				case Opcode::Subtract :
+					return integer ? Value( Value::Int, subtract( a.i, b.i ) ) : Value( Value::Float, 0, a.asDouble() - b.asDouble() );
+				case Opcode::Multiply :
+					return integer ? Value( Value::Int, multiply( a.i, b.i ) ) : Value( Value::Float, 0, a.asDouble() * b.asDouble() );
+				case Opcode::ClassicDivide :
+					if( integer )
+					{
+						return arithmetic( Opcode::FloorDivide, a, b );
+					}
+					return arithmetic( Opcode::Divide, a, b );
+				case Opcode::Divide :
+					if( b.asDouble() == 0.0 )
+					{
+						throw Unsupported();
+					}
+					return Value( Value::Float, 0, a.asDouble() / b.asDouble() );
+				case Opcode::FloorDivide :
+				case Opcode::Modulo :
+				{
+					if( b.asDouble() == 0.0 )
+					{
+						throw Unsupported();
+					}
+					if( integer )
+					{
+						if( a.i == std::numeric_limits<int64_t>::min() && b.i == -1 )
+						{
+							throw Unsupported();
+						}
+						// Python rounds towards negative infinity, and the
+						// result of modulo takes the sign of the divisor.
+						int64_t q = a.i / b.i;
+						int64_t m = a.i % b.i;
+						if( m != 0 && ( ( m < 0 ) != ( b.i < 0 ) ) )
+						{
+							q -= 1;
+							m += b.i;
+						}
+						return Value( Value::Int, opcode == Opcode::FloorDivide ? q : m );
+					}
+					const double x = a.asDouble();
+					const double y = b.asDouble();
+					double m = std::fmod( x, y );
+					if( m != 0.0 && ( ( m < 0.0 ) != ( y < 0.0 ) ) )
+					{
+						m += y;
+					}
+					if( opcode == Opcode::Modulo )
+					{
+						return Value( Value::Float, 0, m );
+					}
+					// As for `float_floor_div()` in the Python source.
+					const double d = ( x - m ) / y;
+					double f = std::floor( d );
+					if( d - f > 0.5 )
+					{
+						f += 1.0;
+					}
+					return Value( Value::Float, 0, f );
+				}
+				case Opcode::Power :
+				{
+					if( integer && b.i >= 0 )
+					{
+						if( a.i == 0 || a.i == 1 )
+						{
+							return Value( Value::Int, b.i == 0 ? 1 : a.i );
+						}
+						else if( a.i == -1 )
+						{
+							return Value( Value::Int, b.i % 2 ? -1 : 1 );
+						}
+						// Overflow guarantees termination within 63 iterations.
+						int64_t result = 1;
+						for( int64_t e = 0; e < b.i; ++e )
+						{
+							result = multiply( result, a.i );
+						}
+						return Value( Value::Int, result );
+					}
+					const double x = a.asDouble();
+					const double y = b.asDouble();
+					if( ( x == 0.0 && y < 0.0 ) || ( x < 0.0 && y != std::floor( y ) ) )
+					{
+						// ZeroDivisionError or complex result in Python.
+						throw Unsupported();
+					}
+					return Value( Value::Float, 0, std::pow( x, y ) );
+				}
+				default :
+					throw Unsupported();
+			}
+		}
+
+		// Returns -1, 0 or 1. Throws for unordered comparisons unless
+		// `equalityOnly` is true, in which case mismatched types compare
+		// unequal.
+		static int compare( const Value &a, const Value &b, bool equalityOnly )
+		{
+			if( a.numeric() && b.numeric() )
+			{
+				if( a.type != Value::Float && b.type != Value::Float )
+				{
+					return a.i < b.i ? -1 : ( a.i > b.i ? 1 : 0 );
+				}
+				const double x = a.asDouble();
+				const double y = b.asDouble();
+				if( std::isnan( x ) || std::isnan( y ) )
+				{
+					throw Unsupported();
+				}
+				return x < y ? -1 : ( x > y ? 1 : 0 );
+			}
+			else if( a.type == Value::String && b.type == Value::String )
+			{
+				const int c = a.s.compare( b.s );
+				return c < 0 ? -1 : ( c > 0 ? 1 : 0 );
+			}
+			else if( equalityOnly )
+			{
+				return 1;
+			}
+			throw Unsupported();
+		}
+
+		static Value call( Opcode opcode, const Value &a )
+		{
+			switch( opcode )
+			{
+				case Opcode::Int :
+					if( a.type == Value::Float )
+					{
+						if( !( a.f > -9.2e18 && a.f < 9.2e18 ) )
+						{
+							throw Unsupported();
+						}
+						return Value( Value::Int, (int64_t)std::trunc( a.f ) );
+					}
+					else if( a.type == Value::String )
+					{
+						throw Unsupported();
+					}
+					return Value( Value::Int, a.i );
+				case Opcode::Float :
+					if( a.type == Value::String )
+					{
+						throw Unsupported();
+					}
+					return Value( Value::Float, 0, a.asDouble() );
+				case Opcode::Str :
+					switch( a.type )
+					{
+						case Value::Bool :
+							return Value( std::string( a.i ? "True" : "False" ) );
+						case Value::Int :
+							return Value( std::to_string( a.i ) );
+						case Value::String :
+							return a;
+						default :
+							// Python's shortest round-trip formatting
+							// isn't worth replicating here.
+							throw Unsupported();
+					}
+				case Opcode::Abs :
+					if( a.type == Value::Float )
+					{
+						return Value( Value::Float, 0, std::fabs( a.f ) );
+					}
+					else if( a.type == Value::String || a.i == std::numeric_limits<int64_t>::min() )
+					{
+						throw Unsupported();
+					}
+					return Value( Value::Int, std::abs( a.i ) );
+				case Opcode::Negate :
+					if( a.type == Value::Float )
+					{
+						return Value( Value::Float, 0, -a.f );
+					}
+					else if( a.type == Value::String || a.i == std::numeric_limits<int64_t>::min() )
+					{
+						throw Unsupported();
+					}
+					return Value( Value::Int, -a.i );
+				case Opcode::Positive :
+					if( a.type == Value::String )
+					{
+						throw Unsupported();
+					}
+					return a.type == Value::Bool ? Value( Value::Int, a.i ) : a;
+				default :
+					return Value( Value::Bool, !a.truthy() );
+			}
+		}
+
+		IECore::ConstObjectVectorPtr executeInternal( const Context *context, const std::vector<const ValuePlug *> &proxyInputs ) const
+		{
+			std::vector<Value> stack;
+			stack.reserve( 8 );
+			std::vector<Value> locals( m_numLocals );
+
+			IECore::ObjectVectorPtr result = new IECore::ObjectVector;
+			result->members().resize( m_numOutputs, IECore::NullObject::defaultNullObject() );
+
+			auto pop = [&stack] () {
+				Value v = std::move( stack.back() );
+				stack.pop_back();
+				return v;
+			};
+
+			for( const auto &instruction : m_instructions )
+			{
+				switch( instruction.opcode )
+				{
+					case Opcode::Constant :
+						stack.push_back( instruction.constant );
+						break;
+					case Opcode::Input :
+						stack.push_back( valueFromPlug( proxyInputs[instruction.index] ) );
+						break;
+					case Opcode::Context :
+						stack.push_back( valueFromData( context->get<IECore::Data>( instruction.name, nullptr ) ) );
+						break;
+					case Opcode::ContextGet : {
+						const IECore::Data *d = context->get<IECore::Data>( instruction.name, nullptr );
+						if( d )
+						{
+							stack.back() = valueFromData( d );
+						}
+						break;
+					}
+					case Opcode::Contains :
+						stack.push_back( Value( Value::Bool, context->get<IECore::Data>( instruction.name, nullptr ) != nullptr ) );
+						break;
+					case Opcode::Frame :
+						stack.push_back( Value( Value::Float, 0, context->getFrame() ) );
+						break;
+					case Opcode::Time :
+						stack.push_back( Value( Value::Float, 0, context->getTime() ) );
+						break;
+					case Opcode::FramesPerSecond :
+						stack.push_back( Value( Value::Float, 0, context->getFramesPerSecond() ) );
+						break;
+					case Opcode::Load :
+						stack.push_back( locals[instruction.index] );
+						break;
+					case Opcode::Store :
+						locals[instruction.index] = pop();
+						break;
+					case Opcode::Output :
+						result->members()[instruction.index] = valueToData( pop() );
+						break;
+					case Opcode::Equal :
+					case Opcode::NotEqual :
+					case Opcode::Less :
+					case Opcode::LessEqual :
+					case Opcode::Greater :
+					case Opcode::GreaterEqual : {
+						const Value b = pop();
+						const Value a = pop();
+						const bool equalityOnly = instruction.opcode == Opcode::Equal || instruction.opcode == Opcode::NotEqual;
+						const int c = compare( a, b, equalityOnly );
+						bool r;
+						switch( instruction.opcode )
+						{
+							case Opcode::Equal : r = c == 0; break;
+							case Opcode::NotEqual : r = c != 0; break;
+							case Opcode::Less : r = c < 0; break;
+							case Opcode::LessEqual : r = c <= 0; break;
+							case Opcode::Greater : r = c > 0; break;
+							default : r = c >= 0; break;
+						}
+						stack.push_back( Value( Value::Bool, r ) );
+						break;
+					}
+					case Opcode::And :
+					case Opcode::Or : {
+						Value b = pop();
+						Value a = pop();
+						const bool useA = instruction.opcode == Opcode::And ? !a.truthy() : a.truthy();
+						stack.push_back( useA ? std::move( a ) : std::move( b ) );
+						break;
+					}
+					case Opcode::Select : {
+						const bool condition = pop().truthy();
+						Value orElse = pop();
+						if( !condition )
+						{
+							stack.back() = std::move( orElse );
+						}
+						break;
+					}
+					case Opcode::Min :
+					case Opcode::Max : {
+						const size_t first = stack.size() - instruction.index;
+						size_t best = first;
+						for( size_t i = first + 1; i < stack.size(); ++i )
+						{
+							const int c = compare( stack[i], stack[best], false );
+							if( instruction.opcode == Opcode::Min ? c < 0 : c > 0 )
+							{
+								best = i;
+							}
+						}
+						Value v = std::move( stack[best] );
+						stack.resize( first );
+						stack.push_back( std::move( v ) );
+						break;
+					}
+					case Opcode::Int :
+					case Opcode::Float :
+					case Opcode::Str :
+					case Opcode::Abs :
+					case Opcode::Negate :
+					case Opcode::Positive :
+					case Opcode::Not :
+						stack.back() = call( instruction.opcode, stack.back() );
+						break;
+					default : {
+						const Value b = pop();
+						stack.back() = arithmetic( instruction.opcode, stack.back(), b );
+						break;
+					}
+				}
+			}
+
+			return result;
+		}
+
+		std::vector<Instruction> m_instructions;
+		size_t m_numLocals;
+		size_t m_numOutputs;
+
+};
+
 class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 {
 	public :
@@ -169,6 +899,16 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 						container_utils::extend_container( inputs, pythonInputs );
 						container_utils::extend_container( outputs, pythonOutputs );
 						container_utils::extend_container( contextVariables, pythonContextVariables );
+
+						m_nativeProgram.reset();
+						if( object nativeProgramFunction = this->methodOverride( "_nativeProgram" ) )
+						{
+							object nativeProgram = nativeProgramFunction();
+							if( nativeProgram )
+							{
+								m_nativeProgram = NativeProgram::fromPython( nativeProgram );
+							}
+						}
 						return;
 					}
 				}
@@ -183,6 +923,14 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 
 		IECore::ConstObjectVectorPtr execute( const Context *context, const std::vector<const ValuePlug *> &proxyInputs ) const override
 		{
+			if( m_nativeProgram )
+			{
+				if( IECore::ConstObjectVectorPtr result = m_nativeProgram->execute( context, proxyInputs ) )
+				{
+					return result;
+				}
+			}
+
 			if( isSubclassed() )
 			{
 				IECorePython::ScopedGILLock gilLock;
@@ -217,6 +965,11 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 
 		void apply( ValuePlug *proxyOutput, const ValuePlug *topLevelProxyOutput, const IECore::Object *value ) const override
 		{
+			if( m_nativeProgram && m_nativeProgram->apply( proxyOutput, topLevelProxyOutput, value ) )
+			{
+				return;
+			}
+
 			if( isSubclassed() )
 			{
 				IECorePython::ScopedGILLock gilLock;
@@ -336,6 +1089,11 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 		}
 
 		static ValuePlug::CachePolicy g_cachePolicy;
+
+	private :
+
+		std::unique_ptr<NativeProgram> m_nativeProgram;
+
 };
 
 
@@ -46,6 +46,7 @@
 #include "Gaffer/CompoundDataPlug.h"
 #include "Gaffer/Context.h"
 #include "Gaffer/Monitor.h"
+#include "Gaffer/PlugAlgo.h"
 #include "Gaffer/ScriptNode.h"
 #include "Gaffer/StandardSet.h"
 #include "Gaffer/StringPlug.h"
@@ -55,12 +56,16 @@
 #include "IECorePython/ScopedGILRelease.h"
 
 #include "IECore/MessageHandler.h"
+#include "IECore/ObjectVector.h"
+#include "IECore/VectorTypedData.h"
 
+#include "boost/algorithm/string/join.hpp"
 #include "boost/algorithm/string/replace.hpp"
 #include "boost/lexical_cast.hpp"
 #include "boost/regex.hpp"
 
 #include <memory>
+#include <unordered_map>
 
 using namespace Gaffer;
 using namespace GafferBindings;
@@ -224,7 +229,7 @@ boost::python::object executionDict( ScriptNodePtr script, NodePtr parent )
 	return std::move( result );
 }
 
-std::string serialise( const Node *parent, const Set *filter )
+std::string serialise( const Node *parent, const Set *filter, IECore::CompoundObjectPtr *binaryData )
 {
 	if( !Py_IsInitialized() )
 	{
@@ -249,8 +254,12 @@ std::string serialise( const Node *parent, const Set *filter )
 	std::string result;
 	try
 	{
-		Serialisation serialisation( parent, "parent", filter );
+		Serialisation serialisation( parent, "parent", filter, /* binary = */ binaryData != nullptr );
 		result = serialisation.result();
+		if( binaryData )
+		{
+			*binaryData = serialisation.binaryData();
+		}
 	}
 	catch( boost::python::error_already_set &e )
 	{
@@ -312,7 +321,7 @@ std::string replaceImath( const std::string &serialisation )
 	return result;
 }
 
-bool execute( ScriptNode *script, const std::string &serialisation, Node *parent, bool continueOnError, const std::string &context = "" )
+bool execute( ScriptNode *script, const std::string &serialisation, const IECore::CompoundObject *binaryData, Node *parent, bool continueOnError, const std::string &context = "" )
 {
 	if( !Py_IsInitialized() )
 	{
@@ -326,6 +335,10 @@ bool execute( ScriptNode *script, const std::string &serialisation, Node *parent
 	try
 	{
 		boost::python::object e = executionDict( script, parent );
+		if( binaryData )
+		{
+			e["__binaryData"] = IECore::CompoundObjectPtr( const_cast<IECore::CompoundObject *>( binaryData ) );
+		}
 
 		if( !continueOnError )
 		{
@@ -353,6 +366,172 @@ bool execute( ScriptNode *script, const std::string &serialisation, Node *parent
 	return result;
 }
 
+// Returns the child referred to by a single component of a
+// binary serialisation path. This is either a name, or an index
+// for the children of ArrayPlugs and Spreadsheet rows.
+GraphComponent *binaryPathChild( GraphComponent *parent, const std::string &component )
+{
+	if( component.empty() || !isdigit( component[0] ) )
+	{
+		return parent->getChild( component );
+	}
+
+	const size_t index = boost::lexical_cast<size_t>( component );
+	if( index >= parent->children().size() )
+	{
+		return nullptr;
+	}
+	return parent->getChild( index );
+}
+
+// Applies the values and connections recorded by a binary
+// serialisation. `children` maps from the original names of
+// the nodes constructed by the serialisation to the nodes
+// themselves, which may have been renamed to avoid clashes.
+class BinaryDataApplicator
+{
+
+	public :
+
+		BinaryDataApplicator( GraphComponent *parent, boost::python::dict children )
+			:	m_parent( parent ), m_children( children )
+		{
+		}
+
+		template<typename T>
+		T *resolve( const std::string &path )
+		{
+			const size_t dot = path.find( '.' );
+			const std::string head = path.substr( 0, dot );
+
+			auto it = m_heads.find( head );
+			if( it == m_heads.end() )
+			{
+				GraphComponent *g = nullptr;
+				boost::python::object child = m_children.get( head );
+				if( child.ptr() != Py_None )
+				{
+					g = boost::python::extract<GraphComponent *>( child )();
+				}
+				else
+				{
+					g = binaryPathChild( m_parent, head );
+				}
+				it = m_heads.insert( { head, g } ).first;
+			}
+
+			GraphComponent *result = it->second;
+			size_t begin = dot;
+			while( result && begin != std::string::npos )
+			{
+				const size_t end = path.find( '.', begin + 1 );
+				result = binaryPathChild( result, path.substr( begin + 1, end == std::string::npos ? end : end - begin - 1 ) );
+				begin = end;
+			}
+			return IECore::runTimeCast<T>( result );
+		}
+
+	private :
+
+		GraphComponent *m_parent;
+		boost::python::dict m_children;
+		std::unordered_map<std::string, GraphComponent *> m_heads;
+
+};
+
+void applyBinaryData( GraphComponent &parent, boost::python::dict children, const IECore::CompoundObject &binaryData )
+{
+	const auto &valuePaths = binaryData.member<IECore::StringVectorData>( "valuePaths", /* throwExceptions = */ true )->readable();
+	const auto &values = binaryData.member<IECore::ObjectVector>( "values", /* throwExceptions = */ true )->members();
+	const auto &inputPaths = binaryData.member<IECore::StringVectorData>( "inputPaths", /* throwExceptions = */ true )->readable();
+	const auto &inputSourcePaths = binaryData.member<IECore::StringVectorData>( "inputSourcePaths", /* throwExceptions = */ true )->readable();
+	if( values.size() != valuePaths.size() || inputSourcePaths.size() != inputPaths.size() )
+	{
+		throw IECore::Exception( "Invalid binary data" );
+	}
+
+	// We apply everything we can before reporting errors, so that
+	// `continueOnError` loads are as complete as possible.
+	BinaryDataApplicator applicator( &parent, children );
+	std::vector<std::string> errors;
+
+	auto setValue = [&] ( size_t i, ValuePlug *plug ) {
+		const IECore::Data *value = IECore::runTimeCast<const IECore::Data>( values[i].get() );
+		if( !value )
+		{
+			errors.push_back( "Invalid value for plug \"" + valuePaths[i] + "\"" );
+			return;
+		}
+
+		try
+		{
+			if( !PlugAlgo::setValueFromData( plug, value ) )
+			{
+				errors.push_back( "Unable to set value for plug \"" + valuePaths[i] + "\"" );
+			}
+		}
+		catch( const std::exception &e )
+		{
+			errors.push_back( "Unable to set value for plug \"" + valuePaths[i] + "\" : " + e.what() );
+		}
+	};
+
+	// Values are set before connections are made, matching the order
+	// of the text serialisation. But ArrayPlug elements may only be
+	// created by making connections, so we defer the values for any
+	// plugs we can't find until afterwards.
+
+	std::vector<size_t> deferredValues;
+	for( size_t i = 0, e = valuePaths.size(); i < e; ++i )
+	{
+		if( ValuePlug *plug = applicator.resolve<ValuePlug>( valuePaths[i] ) )
+		{
+			setValue( i, plug );
+		}
+		else
+		{
+			deferredValues.push_back( i );
+		}
+	}
+
+	for( size_t i = 0, e = inputPaths.size(); i < e; ++i )
+	{
+		Plug *plug = applicator.resolve<Plug>( inputPaths[i] );
+		Plug *input = applicator.resolve<Plug>( inputSourcePaths[i] );
+		if( !plug || !input )
+		{
+			errors.push_back( "Unable to connect \"" + inputPaths[i] + "\" to \"" + inputSourcePaths[i] + "\"" );
+			continue;
+		}
+
+		try
+		{
+			plug->setInput( input );
+		}
+		catch( const std::exception &e )
+		{
+			errors.push_back( "Unable to connect \"" + inputPaths[i] + "\" to \"" + inputSourcePaths[i] + "\" : " + e.what() );
+		}
+	}
+
+	for( size_t i : deferredValues )
+	{
+		if( ValuePlug *plug = applicator.resolve<ValuePlug>( valuePaths[i] ) )
+		{
+			setValue( i, plug );
+		}
+		else
+		{
+			errors.push_back( "Unable to find plug \"" + valuePaths[i] + "\"" );
+		}
+	}
+
+	if( errors.size() )
+	{
+		throw IECore::Exception( boost::algorithm::join( errors, "\n" ) );
+	}
+}
+
 } // namespace
 
 namespace GafferModule
@@ -543,6 +722,8 @@ void GafferModule::bindScriptNode()
 		.def( "load", &load, ( boost::python::arg( "continueOnError" ) = false ) )
 		.def( "importFile", &importFile, ( boost::python::arg( "fileName" ), boost::python::arg( "parent" ) = boost::python::object(), boost::python::arg( "continueOnError" ) = false ) )
 		.def( "context", &context )
+		.def( "_applyBinaryData", &applyBinaryData )
+		.staticmethod( "_applyBinaryData" )
 	;
 
 	SignalClass<ScriptNode::ActionSignal, DefaultSignalCaller<ScriptNode::ActionSignal>, ActionSlotCaller>( "ActionSignal" );
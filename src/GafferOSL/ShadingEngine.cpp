@@ -68,7 +68,9 @@
 #include "tbb/spin_mutex.h"
 #include "tbb/spin_rw_mutex.h"
 
+#include <atomic>
 #include <limits>
+#include <memory>
 #include <unordered_set>
 
 using namespace std;
@@ -645,15 +647,29 @@ class ShadingResults
 
 	public :
 
-		ShadingResults( size_t numPoints )
-			:	m_results( new CompoundData ), m_ci( nullptr )
+		ShadingResults( size_t numPoints, const std::vector<std::pair<std::string, std::string>> &knownOutputs )
+			:	m_results( new CompoundData ), m_ci( nullptr ), m_knownResultsWritten( new std::atomic<bool>[knownOutputs.size()] )
 		{
 			Color3fVectorDataPtr ciData = new Color3fVectorData();
 			m_ci = &ciData->writable();
 			m_ci->resize( numPoints, Color3f( 0.0f ) );
 
-			CompoundDataPtr result = new CompoundData();
 			m_results->writable()["Ci"] = ciData;
+
+			// Allocate the outputs we know about up front. These are never
+			// modified during shading, so can be looked up without locking.
+			for( size_t i = 0; i < knownOutputs.size(); ++i )
+			{
+				const ustring name( knownOutputs[i].first );
+				if( m_knownResults.find( name ) != m_knownResults.end() )
+				{
+					continue;
+				}
+				m_knownResultsWritten[i] = false;
+				DebugResult result = createDebugResult( name, ustring( knownOutputs[i].second ) );
+				result.written = &m_knownResultsWritten[i];
+				m_knownResults.insert( make_pair( name, result ) );
+			}
 		}
 
 		/// \todo This is a lot like the UserData struct above - maybe we should
@@ -661,12 +677,15 @@ class ShadingResults
 		struct DebugResult
 		{
 			DebugResult()
-				:	basePointer( nullptr )
+				:	basePointer( nullptr ), written( nullptr )
 			{
 			}
 
 			TypeDesc type;
 			void *basePointer;
+			// Only used for known results, so that we can remove any
+			// that were never actually output by the shader.
+			std::atomic<bool> *written;
 		};
 
 		typedef container::flat_map<ustring, DebugResult, OIIO::ustringPtrIsLess> DebugResultsMap;
@@ -678,6 +697,13 @@ class ShadingResults
 
 		CompoundDataPtr results()
 		{
+			for( const auto &r : m_knownResults )
+			{
+				if( !r.second.written->load( std::memory_order_relaxed ) )
+				{
+					m_results->writable().erase( r.first.c_str() );
+				}
+			}
 			return m_results;
 		}
 
@@ -717,10 +743,40 @@ class ShadingResults
 			(*m_ci)[pointIndex] += weight;
 		}
 
+		DebugResult createDebugResult( ustring name, ustring type )
+		{
+			DebugResult result;
+			result.type = typeDescFromTypeName( type );
+			result.type.arraylen = m_ci->size();
+
+			DataPtr data = dataFromTypeDesc( result.type, result.basePointer );
+			if( !data )
+			{
+				throw IECore::Exception( "Unsupported type specified in debug() closure." );
+			}
+			if( type == g_uvType )
+			{
+				static_cast<V2fVectorData *>( data.get() )->setInterpretation( GeometricData::UV );
+			}
+
+			result.type.unarray(); // so we can use convert_value
+
+			m_results->writable()[name.c_str()] = data;
+			return result;
+		}
+
 		DebugResult acquireDebugResult( const DebugParameters *parameters, DebugResultsMap &threadCache )
 		{
-			// Try the per-thread cache first.
-			auto it = threadCache.find( parameters->name );
+			// Try the known results first. These are immutable
+			// during shading, so no locking is required.
+			auto it = m_knownResults.find( parameters->name );
+			if( it != m_knownResults.end() )
+			{
+				return it->second;
+			}
+
+			// Then try the per-thread cache.
+			it = threadCache.find( parameters->name );
 			if( it != threadCache.end() )
 			{
 				return it->second;
@@ -740,25 +796,9 @@ class ShadingResults
 				it = m_debugResults.find( parameters->name );
 				if( it == m_debugResults.end() )
 				{
-					// Create the result.
-					DebugResult result;
-					result.type = typeDescFromTypeName( parameters->type );
-					result.type.arraylen = m_ci->size();
-
-					DataPtr data = dataFromTypeDesc( result.type, result.basePointer );
-					if( !data )
-					{
-						throw IECore::Exception( "Unsupported type specified in debug() closure." );
-					}
-					if( parameters->type == g_uvType )
-					{
-						static_cast<V2fVectorData *>( data.get() )->setInterpretation( GeometricData::UV );
-					}
-
-					result.type.unarray(); // so we can use convert_value
-
-					m_results->writable()[parameters->name.c_str()] = data;
-					it = m_debugResults.insert( make_pair( parameters->name, result ) ).first;
+					it = m_debugResults.insert(
+						make_pair( parameters->name, createDebugResult( parameters->name, parameters->type ) )
+					).first;
 				}
 			}
 
@@ -769,6 +809,10 @@ class ShadingResults
 		void addDebug( size_t pointIndex, const DebugParameters *parameters, const Color3f &weight, DebugResultsMap &threadCache )
 		{
 			DebugResult debugResult = acquireDebugResult( parameters, threadCache );
+			if( debugResult.written && !debugResult.written->load( std::memory_order_relaxed ) )
+			{
+				debugResult.written->store( true, std::memory_order_relaxed );
+			}
 
 			if( parameters->type == g_matrixType )
 			{
@@ -820,6 +864,8 @@ class ShadingResults
 
 		CompoundDataPtr m_results;
 		vector<Color3f> *m_ci;
+		DebugResultsMap m_knownResults;
+		std::unique_ptr<std::atomic<bool>[]> m_knownResultsWritten;
 		DebugResultsMap m_debugResults;
 		tbb::spin_rw_mutex m_resultsMutex;
 
@@ -932,6 +978,76 @@ void declareParameters( const CompoundDataMap &parameters, ShadingSystem *shadin
 	}
 }
 
+// Appends the outputs made by one of our standard ObjectProcessing or
+// ImageProcessing output shaders, provided that the output names aren't
+// determined by connections.
+void appendKnownOutputs( const ShaderNetwork *shaderNetwork, const InternedString &handle, std::vector<std::pair<std::string, std::string>> &outputs )
+{
+	static const boost::container::flat_map<std::string, std::string> g_objectProcessingTypes = {
+		{ "ObjectProcessing/OutFloat", "float" },
+		{ "ObjectProcessing/OutInt", "int" },
+		{ "ObjectProcessing/OutColor", "color" },
+		{ "ObjectProcessing/OutPoint", "point" },
+		{ "ObjectProcessing/OutVector", "vector" },
+		{ "ObjectProcessing/OutNormal", "normal" },
+		{ "ObjectProcessing/OutMatrix", "matrix" },
+		{ "ObjectProcessing/OutString", "string" },
+		{ "ObjectProcessing/OutUV", "uv" }
+	};
+
+	const Shader *shader = shaderNetwork->getShader( handle );
+	const std::string &shaderName = shader->getName();
+
+	std::string nameParameter;
+	auto typeIt = g_objectProcessingTypes.find( shaderName );
+	if( typeIt != g_objectProcessingTypes.end() )
+	{
+		nameParameter = "name";
+	}
+	else if( shaderName == "ImageProcessing/OutChannel" )
+	{
+		nameParameter = "channelName";
+	}
+	else if( shaderName == "ImageProcessing/OutLayer" )
+	{
+		nameParameter = "layerName";
+	}
+	else
+	{
+		return;
+	}
+
+	if( shaderNetwork->input( ShaderNetwork::Parameter( handle, nameParameter ) ) )
+	{
+		return;
+	}
+
+	const StringData *nameData = shader->parametersData()->member<StringData>( nameParameter );
+	if( !nameData )
+	{
+		return;
+	}
+
+	const std::string &name = nameData->readable();
+	if( typeIt != g_objectProcessingTypes.end() )
+	{
+		outputs.push_back( { name, typeIt->second } );
+	}
+	else if( shaderName == "ImageProcessing/OutChannel" )
+	{
+		outputs.push_back( { name, "float" } );
+	}
+	else
+	{
+		// Matches the channel naming in `outLayer()` in "GafferOSL/ImageProcessing.h".
+		const std::string prefix = name.empty() ? "" : name + ".";
+		for( const char *channel : { "R", "G", "B" } )
+		{
+			outputs.push_back( { prefix + channel, "float" } );
+		}
+	}
+}
+
 template <typename T>
 static T uniformValue( const IECore::CompoundData *points, const char *name )
 {
@@ -962,6 +1078,9 @@ static const T *varyingValue( const IECore::CompoundData *points, const char *na
 	}
 }
 
+// Number of points shaded between cancellation checks.
+const size_t g_cancellationCheckInterval = 16;
+
 } // namespace
 
 ShadingEngine::ShadingEngine( const IECoreScene::ShaderNetwork *shaderNetwork )
@@ -980,7 +1099,7 @@ ShadingEngine::ShadingEngine( const IECoreScene::ShaderNetwork *shaderNetwork )
 
 		ShaderNetworkAlgo::depthFirstTraverse(
 			shaderNetwork,
-			[shadingSystem, &invalidShaders] ( const ShaderNetwork *shaderNetwork, const InternedString &handle ) {
+			[this, shadingSystem, &invalidShaders] ( const ShaderNetwork *shaderNetwork, const InternedString &handle ) {
 
 				// Check for invalid (non-OSL) shaders. We stop declaring shaders if any
 				// have been found, but complete the traversal so that we can compile a
@@ -1009,6 +1128,11 @@ ShadingEngine::ShadingEngine( const IECoreScene::ShaderNetwork *shaderNetwork )
 						c.destination.shader.c_str(), c.destination.name.c_str()
 					);
 				}
+
+				// Record any outputs we can predict, so that they can be
+				// allocated before shading.
+
+				appendKnownOutputs( shaderNetwork, handle, m_knownOutputs );
 			}
 		);
 
@@ -1199,7 +1323,7 @@ IECore::CompoundDataPtr ShadingEngine::shade( const IECore::CompoundData *points
 
 	// Allocate data for the result
 
-	ShadingResults results( numPoints );
+	ShadingResults results( numPoints, m_knownOutputs );
 
 	// Iterate over the input points, doing the shading as we go
 
@@ -1220,40 +1344,44 @@ IECore::CompoundDataPtr ShadingEngine::shade( const IECore::CompoundData *points
 
 		threadShaderGlobals.renderstate = &threadRenderState;
 
-		for( size_t i = r.begin(); i < r.end(); ++i )
+		for( size_t blockBegin = r.begin(); blockBegin < r.end(); blockBegin += g_cancellationCheckInterval )
 		{
 			IECore::Canceller::check( canceller );
 
-			threadShaderGlobals.P = p[i];
-
-			if( uv )
+			const size_t blockEnd = std::min( blockBegin + g_cancellationCheckInterval, r.end() );
+			for( size_t i = blockBegin; i < blockEnd; ++i )
 			{
-				threadShaderGlobals.u = uv[i].x;
-				threadShaderGlobals.v = uv[i].y;
-			}
-			else
-			{
-				if( u )
+				threadShaderGlobals.P = p[i];
+
+				if( uv )
 				{
-					threadShaderGlobals.u = u[i];
+					threadShaderGlobals.u = uv[i].x;
+					threadShaderGlobals.v = uv[i].y;
 				}
-				if( v )
+				else
 				{
-					threadShaderGlobals.v = v[i];
+					if( u )
+					{
+						threadShaderGlobals.u = u[i];
+					}
+					if( v )
+					{
+						threadShaderGlobals.v = v[i];
+					}
 				}
-			}
 
-			if( n )
-			{
-				threadShaderGlobals.N = n[i];
-			}
+				if( n )
+				{
+					threadShaderGlobals.N = n[i];
+				}
 
-			threadShaderGlobals.Ci = nullptr;
+				threadShaderGlobals.Ci = nullptr;
 
-			threadRenderState.pointIndex = i;
-			shadingSystem->execute( threadInfo.shadingContext, shaderGroup, threadShaderGlobals );
+				threadRenderState.pointIndex = i;
+				shadingSystem->execute( threadInfo.shadingContext, shaderGroup, threadShaderGlobals );
 
-			results.addResult( i, threadShaderGlobals.Ci, threadInfo.debugResults );
+				results.addResult( i, threadShaderGlobals.Ci, threadInfo.debugResults );
+			}
 		}
 	};
 
@@ -40,11 +40,14 @@
 
 #include "Gaffer/Context.h"
 #include "Gaffer/StringPlug.h"
+#include "Gaffer/ThreadState.h"
 
 #include "IECore/NullObject.h"
 
 #include "boost/container/flat_map.hpp"
 
+#include "tbb/parallel_for.h"
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -171,6 +174,39 @@ IE_CORE_DECLAREPTR( RootTree )
 
 } // namespace
 
+//////////////////////////////////////////////////////////////////////////
+// Parallel evaluation of roots
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Roots are evaluated in parallel when there are at least this many of
+// them. For fewer roots, the overhead of launching tasks outweighs the
+// benefits.
+const size_t g_parallelRootsThreshold = 8;
+
+// Calls `f( range )` to evaluate all indices in `[0, numRoots)`, splitting
+// the work into parallel tasks when there are enough roots to make it
+// worthwhile. `f` is responsible for scoping the appropriate context for
+// each root, and must store results by index so that they can be combined
+// deterministically afterwards.
+template<typename F>
+void parallelForRoots( size_t numRoots, F &&f )
+{
+	using Range = tbb::blocked_range<size_t>;
+	if( numRoots < g_parallelRootsThreshold )
+	{
+		f( Range( 0, numRoots ) );
+		return;
+	}
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for( Range( 0, numRoots ), f, taskGroupContext );
+}
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // SourceScope and SourcePathScope
 //////////////////////////////////////////////////////////////////////////
@@ -185,6 +221,11 @@ class CollectScenes::SourceScope : public Context::EditableScope
 		{
 		}
 
+		SourceScope( const ThreadState &threadState, const InternedString &rootVariable )
+			:	EditableScope( threadState ), m_rootVariable( rootVariable )
+		{
+		}
+
 		void setRoot( const std::string &root )
 		{
 			set( m_rootVariable, root );
@@ -418,6 +459,34 @@ void CollectScenes::compute( Gaffer::ValuePlug *output, const Gaffer::Context *c
 	SceneProcessor::compute( output, context );
 }
 
+Gaffer::ValuePlug::CachePolicy CollectScenes::hashCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if(
+		output == outPlug()->globalsPlug() ||
+		output == outPlug()->setNamesPlug() ||
+		output == outPlug()->setPlug()
+	)
+	{
+		// We may evaluate the roots in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return SceneProcessor::hashCachePolicy( output );
+}
+
+Gaffer::ValuePlug::CachePolicy CollectScenes::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if(
+		output == outPlug()->globalsPlug() ||
+		output == outPlug()->setNamesPlug() ||
+		output == outPlug()->setPlug()
+	)
+	{
+		// We may evaluate the roots in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return SceneProcessor::computeCachePolicy( output );
+}
+
 void CollectScenes::hashBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
 	SourcePathScope sourcePathScope( context, this, path );
@@ -572,19 +641,34 @@ void CollectScenes::hashGlobals( const Gaffer::Context *context, const ScenePlug
 		return;
 	}
 
-	SourceScope sourceScope( context, rootNameVariablePlug()->getValue() );
+	const InternedString rootVariable = rootNameVariablePlug()->getValue();
 
 	if( mergeGlobalsPlug()->getValue() )
 	{
+		const vector<string> &roots = rootTree->roots();
+		vector<MurmurHash> rootHashes( roots.size() );
+		const ThreadState &threadState = ThreadState::current();
+		parallelForRoots(
+			roots.size(),
+			[&] ( const tbb::blocked_range<size_t> &range ) {
+				SourceScope sourceScope( threadState, rootVariable );
+				for( size_t i = range.begin(); i != range.end(); ++i )
+				{
+					sourceScope.setRoot( roots[i] );
+					rootHashes[i] = inPlug()->globalsPlug()->hash();
+				}
+			}
+		);
+
 		SceneProcessor::hashGlobals( context, parent, h );
-		for( const auto &root : rootTree->roots() )
+		for( const auto &rootHash : rootHashes )
 		{
-			sourceScope.setRoot( root );
-			inPlug()->globalsPlug()->hash( h );
+			h.append( rootHash );
 		}
 	}
 	else
 	{
+		SourceScope sourceScope( context, rootVariable );
 		sourceScope.setRoot( rootTree->roots()[0] );
 		h = inPlug()->globalsPlug()->hash();
 	}
@@ -598,15 +682,28 @@ IECore::ConstCompoundObjectPtr CollectScenes::computeGlobals( const Gaffer::Cont
 		return inPlug()->globalsPlug()->defaultValue();
 	}
 
-	SourceScope sourceScope( context, rootNameVariablePlug()->getValue() );
+	const InternedString rootVariable = rootNameVariablePlug()->getValue();
 
 	if( mergeGlobalsPlug()->getValue() )
 	{
+		const vector<string> &roots = rootTree->roots();
+		vector<ConstCompoundObjectPtr> rootGlobals( roots.size() );
+		const ThreadState &threadState = ThreadState::current();
+		parallelForRoots(
+			roots.size(),
+			[&] ( const tbb::blocked_range<size_t> &range ) {
+				SourceScope sourceScope( threadState, rootVariable );
+				for( size_t i = range.begin(); i != range.end(); ++i )
+				{
+					sourceScope.setRoot( roots[i] );
+					rootGlobals[i] = inPlug()->globalsPlug()->getValue();
+				}
+			}
+		);
+
 		CompoundObjectPtr result = new CompoundObject;
-		for( const auto &root : rootTree->roots() )
+		for( const auto &globals : rootGlobals )
 		{
-			sourceScope.setRoot( root );
-			ConstCompoundObjectPtr globals = inPlug()->globalsPlug()->getValue();
 			for( const auto &m : globals->members() )
 			{
 				result->members()[m.first] = m.second;
@@ -616,6 +713,7 @@ IECore::ConstCompoundObjectPtr CollectScenes::computeGlobals( const Gaffer::Cont
 	}
 	else
 	{
+		SourceScope sourceScope( context, rootVariable );
 		sourceScope.setRoot( rootTree->roots()[0] );
 		return inPlug()->globalsPlug()->getValue();
 	}
@@ -628,11 +726,25 @@ void CollectScenes::hashSetNames( const Gaffer::Context *context, const ScenePlu
 	ConstRootTreePtr rootTree = boost::static_pointer_cast<const RootTree>( rootTreePlug()->getValue() );
 	const ValuePlug *inSetNamesPlug = inPlug()->setNamesPlug();
 
-	SourceScope sourceScope( context, rootNameVariablePlug()->getValue() );
-	for( const auto &root : rootTree->roots() )
+	const vector<string> &roots = rootTree->roots();
+	vector<MurmurHash> rootHashes( roots.size() );
+	const InternedString rootVariable = rootNameVariablePlug()->getValue();
+	const ThreadState &threadState = ThreadState::current();
+	parallelForRoots(
+		roots.size(),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			SourceScope sourceScope( threadState, rootVariable );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				sourceScope.setRoot( roots[i] );
+				rootHashes[i] = inSetNamesPlug->hash();
+			}
+		}
+	);
+
+	for( const auto &rootHash : rootHashes )
 	{
-		sourceScope.setRoot( root );
-		inSetNamesPlug->hash( h );
+		h.append( rootHash );
 	}
 }
 
@@ -645,11 +757,24 @@ IECore::ConstInternedStringVectorDataPtr CollectScenes::computeSetNames( const G
 
 	const InternedStringVectorDataPlug *inSetNamesPlug = inPlug()->setNamesPlug();
 
-	SourceScope sourceScope( context, rootNameVariablePlug()->getValue() );
-	for( const auto &root : rootTree->roots() )
+	const vector<string> &roots = rootTree->roots();
+	vector<ConstInternedStringVectorDataPtr> rootSetNames( roots.size() );
+	const InternedString rootVariable = rootNameVariablePlug()->getValue();
+	const ThreadState &threadState = ThreadState::current();
+	parallelForRoots(
+		roots.size(),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			SourceScope sourceScope( threadState, rootVariable );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				sourceScope.setRoot( roots[i] );
+				rootSetNames[i] = inSetNamesPlug->getValue();
+			}
+		}
+	);
+
+	for( const auto &inSetNamesData : rootSetNames )
 	{
-		sourceScope.setRoot( root );
-		ConstInternedStringVectorDataPtr inSetNamesData = inSetNamesPlug->getValue();
 		for( const auto &setName : inSetNamesData->readable() )
 		{
 			if( find( setNames.begin(), setNames.end(), setName ) == setNames.end() )
@@ -675,13 +800,28 @@ void CollectScenes::hashSet( const IECore::InternedString &setName, const Gaffer
 	const PathMatcherDataPlug *inSetPlug = inPlug()->setPlug();
 	const StringPlug *sourceRootPlug = this->sourceRootPlug();
 
-	SourceScope sourceScope( context, rootNameVariablePlug()->getValue() );
-	for( const auto &root : rootTree->roots() )
+	const vector<string> &roots = rootTree->roots();
+	vector<MurmurHash> rootHashes( roots.size() );
+	const InternedString rootVariable = rootNameVariablePlug()->getValue();
+	const ThreadState &threadState = ThreadState::current();
+	parallelForRoots(
+		roots.size(),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			SourceScope sourceScope( threadState, rootVariable );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				sourceScope.setRoot( roots[i] );
+				MurmurHash &rootHash = rootHashes[i];
+				inSetPlug->hash( rootHash );
+				sourceRootPlug->hash( rootHash );
+				rootHash.append( roots[i] );
+			}
+		}
+	);
+
+	for( const auto &rootHash : rootHashes )
 	{
-		sourceScope.setRoot( root );
-		inSetPlug->hash( h );
-		sourceRootPlug->hash( h );
-		h.append( root );
+		h.append( rootHash );
 	}
 }
 
@@ -699,20 +839,39 @@ IECore::ConstPathMatcherDataPtr CollectScenes::computeSet( const IECore::Interne
 	const PathMatcherDataPlug *inSetPlug = inPlug()->setPlug();
 	const StringPlug *sourceRootPlug = this->sourceRootPlug();
 
-	SourceScope sourceScope( context, rootNameVariablePlug()->getValue() );
+	// Fetch the input sets for all roots in parallel, and
+	// then add them to the result serially.
+	const vector<string> &roots = rootTree->roots();
+	vector<ConstPathMatcherDataPtr> rootSets( roots.size() );
+	vector<string> sourceRoots( roots.size() );
+	const InternedString rootVariable = rootNameVariablePlug()->getValue();
+	const ThreadState &threadState = ThreadState::current();
+	parallelForRoots(
+		roots.size(),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			SourceScope sourceScope( threadState, rootVariable );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				sourceScope.setRoot( roots[i] );
+				rootSets[i] = inSetPlug->getValue();
+				if( !rootSets[i]->readable().isEmpty() )
+				{
+					sourceRoots[i] = sourceRootPlug->getValue();
+				}
+			}
+		}
+	);
+
 	ScenePlug::ScenePath prefix;
-	for( const auto &root : rootTree->roots() )
+	for( size_t i = 0; i < roots.size(); ++i )
 	{
-		sourceScope.setRoot( root );
-		ConstPathMatcherDataPtr inSetData = inSetPlug->getValue();
-		const PathMatcher &inSet = inSetData->readable();
+		const PathMatcher &inSet = rootSets[i]->readable();
 		if( !inSet.isEmpty() )
 		{
-			ScenePlug::stringToPath( root, prefix );
-			const string root = sourceRootPlug->getValue();
-			if( !root.empty() )
+			ScenePlug::stringToPath( roots[i], prefix );
+			if( !sourceRoots[i].empty() )
 			{
-				set.addPaths( inSet.subTree( root ), prefix );
+				set.addPaths( inSet.subTree( sourceRoots[i] ), prefix );
 			}
 			else
 			{
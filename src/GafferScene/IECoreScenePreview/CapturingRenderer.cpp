@@ -47,7 +47,7 @@ using namespace IECoreScenePreview;
 // CapturingRenderer
 //////////////////////////////////////////////////////////////////////////
 
-IECoreScenePreview::Renderer::TypeDescription<CapturingRenderer> CapturingRenderer::g_typeDescription( "Capturing" );
+IECoreScenePreview::Renderer::TypeDescription<CapturingRenderer> CapturingRenderer::g_typeDescription( "Capturing", /* supportsWaitForRender = */ true );
 
 CapturingRenderer::CapturingRenderer( RenderType type, const std::string &fileName, const IECore::MessageHandlerPtr &messageHandler )
 	:	m_messageHandler( messageHandler ), m_renderType( type ), m_rendering( false )
@@ -188,6 +188,14 @@ void CapturingRenderer::pause()
 	m_rendering = false;
 }
 
+bool CapturingRenderer::waitForRender()
+{
+	// We have no actual rendering to wait for, so "complete"
+	// the render immediately.
+	m_rendering = false;
+	return true;
+}
+
 void CapturingRenderer::checkPaused() const
 {
 	if( m_rendering )
@@ -56,7 +56,13 @@ vector<IECore::InternedString> &types()
 	return g_types;
 }
 
-typedef map<IECore::InternedString, Creator> CreatorMap;
+struct Registration
+{
+	Creator creator;
+	bool supportsWaitForRender;
+};
+
+typedef map<IECore::InternedString, Registration> CreatorMap;
 CreatorMap &creators()
 {
 	static CreatorMap g_creators;
@@ -84,6 +90,11 @@ Renderer::ObjectInterfacePtr Renderer::camera( const std::string &name,  const s
 	return camera( name, samples[0], attributes );
 }
 
+bool Renderer::waitForRender()
+{
+	return false;
+}
+
 IECore::DataPtr Renderer::command( const IECore::InternedString name, const IECore::CompoundDataMap &parameters )
 {
 	throw IECore::NotImplementedException( "Renderer::command" );
@@ -112,19 +123,25 @@ Renderer::Ptr Renderer::create( const IECore::InternedString &type, RenderType r
 	{
 		return nullptr;
 	}
-	return it->second( renderType, fileName, messageHandler );
+	return it->second.creator( renderType, fileName, messageHandler );
 }
 
+bool Renderer::supportsWaitForRender( const IECore::InternedString &type )
+{
+	const CreatorMap &c = creators();
+	CreatorMap::const_iterator it = c.find( type );
+	return it != c.end() && it->second.supportsWaitForRender;
+}
 
-void Renderer::registerType( const IECore::InternedString &typeName, Ptr (*creator)( RenderType, const std::string &, const IECore::MessageHandlerPtr & ) )
+void Renderer::registerType( const IECore::InternedString &typeName, Ptr (*creator)( RenderType, const std::string &, const IECore::MessageHandlerPtr & ), bool supportsWaitForRender )
 {
 	CreatorMap &c = creators();
 	CreatorMap::iterator it = c.find( typeName );
 	if( it != c.end() )
 	{
-		it->second = creator;
+		it->second = { creator, supportsWaitForRender };
 		return;
 	}
-	c[typeName] = creator;
+	c[typeName] = { creator, supportsWaitForRender };
 	::types().push_back( typeName );
 }
@@ -46,9 +46,13 @@
 #include "GafferScene/SceneAlgo.h"
 
 #include "Gaffer/ArrayPlug.h"
+#include "Gaffer/ThreadState.h"
 
 #include "IECore/NullObject.h"
 
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
+
 #include "unordered_set"
 
 using namespace std;
@@ -83,6 +87,11 @@ size_t first( const std::bitset<32> &inputs )
 	return 0;
 }
 
+// Inputs are evaluated in parallel when at least this many of them
+// are required. For fewer inputs, the overhead of launching tasks
+// outweighs the benefits.
+const size_t g_parallelInputsThreshold = 8;
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -300,6 +309,52 @@ void MergeScenes::compute( Gaffer::ValuePlug *output, const Gaffer::Context *con
 	}
 }
 
+Gaffer::ValuePlug::CachePolicy MergeScenes::hashCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == mergedDescendantsBoundPlug() )
+	{
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	else if( output == activeInputsPlug() || output == outPlug()->attributesPlug() || output == outPlug()->childNamesPlug() )
+	{
+		if( connectedInputs().count() >= g_parallelInputsThreshold )
+		{
+			return ValuePlug::CachePolicy::TaskIsolation;
+		}
+	}
+	else if( output == outPlug()->globalsPlug() || output == outPlug()->setNamesPlug() || output == outPlug()->setPlug() )
+	{
+		if( connectedInputs().count() >= g_parallelInputsThreshold )
+		{
+			return ValuePlug::CachePolicy::TaskCollaboration;
+		}
+	}
+	return SceneProcessor::hashCachePolicy( output );
+}
+
+Gaffer::ValuePlug::CachePolicy MergeScenes::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == mergedDescendantsBoundPlug() )
+	{
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	else if( output == activeInputsPlug() || output == outPlug()->attributesPlug() || output == outPlug()->childNamesPlug() )
+	{
+		if( connectedInputs().count() >= g_parallelInputsThreshold )
+		{
+			return ValuePlug::CachePolicy::TaskIsolation;
+		}
+	}
+	else if( output == outPlug()->globalsPlug() || output == outPlug()->setNamesPlug() || output == outPlug()->setPlug() )
+	{
+		if( connectedInputs().count() >= g_parallelInputsThreshold )
+		{
+			return ValuePlug::CachePolicy::TaskCollaboration;
+		}
+	}
+	return SceneProcessor::computeCachePolicy( output );
+}
+
 void MergeScenes::hashActiveInputs( const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	const ScenePath &scenePath = context->get<ScenePath>( ScenePlug::scenePathContextName );
@@ -323,18 +378,7 @@ void MergeScenes::hashActiveInputs( const Gaffer::Context *context, IECore::Murm
 		}
 		else
 		{
-			InputMask activeInputs;
-			visit(
-				parentActiveInputs,
-				[&scenePath, &activeInputs] ( InputType type, size_t index, const ScenePlug *scene ) {
-					if( scene->exists( scenePath ) )
-					{
-						activeInputs[index] = true;
-					}
-					return true;
-				}
-			);
-			h.append( (uint64_t)activeInputs.to_ulong() );
+			h.append( (uint64_t)existingInputs( parentActiveInputs ).to_ulong() );
 		}
 	}
 }
@@ -374,16 +418,7 @@ int MergeScenes::computeActiveInputs( const Gaffer::Context *context ) const
 			// a mask reduces the number of existence queries
 			// we must make when merging many sparsely overlapping
 			// scenes.
-			visit(
-				parentActiveInputs,
-				[&result, &scenePath] ( InputType type, size_t index, const ScenePlug *scene ) {
-					if( scene->exists( scenePath ) )
-					{
-						result[index] = true;
-					}
-					return true;
-				}
-			);
+			result = existingInputs( parentActiveInputs );
 		}
 	}
 
@@ -399,40 +434,66 @@ void MergeScenes::hashMergedDescendantsBound( const Gaffer::Context *context, IE
 	}
 
 	ConstInternedStringVectorDataPtr childNamesData = outPlug()->childNamesPlug()->getValue();
-	if( childNamesData->readable().empty() )
+	const vector<InternedString> &childNames = childNamesData->readable();
+	if( childNames.empty() )
 	{
 		return;
 	}
 
 	const size_t firstActiveIndex = first( activeInputs );
 
-	ScenePath childPath = context->get<ScenePath>( ScenePlug::scenePathContextName );
-	childPath.push_back( InternedString() ); // Room for child name
-	ScenePlug::PathScope childScope( context );
+	const ThreadState &threadState = ThreadState::current();
+	using Range = tbb::blocked_range<size_t>;
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 
-	for( const auto &childName : childNamesData->readable() )
-	{
-		childPath.back() = childName;
-		childScope.setPath( childPath );
-		const InputMask childActiveInputs( activeInputsPlug()->getValue() );
-		if( childActiveInputs.count() == 1 && childActiveInputs[firstActiveIndex] )
-		{
-			continue;
-		}
+	const IECore::MurmurHash reduction = tbb::parallel_deterministic_reduce(
+		Range( 0, childNames.size() ),
+		MurmurHash(),
+		[&] ( const Range &range, const MurmurHash &hash ) {
 
-		const ScenePlug *childScene = inPlugs()->getChild<ScenePlug>( first( childActiveInputs ) );
+			ScenePlug::PathScope childScope( threadState );
+			ScenePath childPath = context->get<ScenePath>( ScenePlug::scenePathContextName );
+			childPath.push_back( InternedString() ); // Room for child name
 
-		if( childActiveInputs.count() == 1 )
-		{
-			childScene->boundPlug()->hash( h );
-		}
-		else
-		{
-			mergedDescendantsBoundPlug()->hash( h );
-		}
+			MurmurHash result = hash;
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				childPath.back() = childNames[i];
+				childScope.setPath( childPath );
+				const InputMask childActiveInputs( activeInputsPlug()->getValue() );
+				if( childActiveInputs.count() == 1 && childActiveInputs[firstActiveIndex] )
+				{
+					continue;
+				}
+
+				const ScenePlug *childScene = inPlugs()->getChild<ScenePlug>( first( childActiveInputs ) );
+
+				if( childActiveInputs.count() == 1 )
+				{
+					childScene->boundPlug()->hash( result );
+				}
+				else
+				{
+					mergedDescendantsBoundPlug()->hash( result );
+				}
+
+				childScene->transformPlug()->hash( result );
+			}
+			return result;
 
-		childScene->transformPlug()->hash( h );
-	};
+		},
+		[] ( const MurmurHash &x, const MurmurHash &y ) {
+
+			MurmurHash result = x;
+			result.append( y );
+			return result;
+
+		},
+		tbb::simple_partitioner(),
+		taskGroupContext
+	);
+
+	h.append( reduction );
 }
 
 const Imath::Box3f MergeScenes::computeMergedDescendantsBound( const Gaffer::Context *context ) const
@@ -445,7 +506,8 @@ const Imath::Box3f MergeScenes::computeMergedDescendantsBound( const Gaffer::Con
 	}
 
 	ConstInternedStringVectorDataPtr childNamesData = outPlug()->childNamesPlug()->getValue();
-	if( childNamesData->readable().empty() )
+	const vector<InternedString> &childNames = childNamesData->readable();
+	if( childNames.empty() )
 	{
 		// No children. There can be no descendants to merge.
 		return Box3f();
@@ -453,42 +515,63 @@ const Imath::Box3f MergeScenes::computeMergedDescendantsBound( const Gaffer::Con
 
 	const size_t firstActiveIndex = first( activeInputs );
 
-	ScenePath childPath = context->get<ScenePath>( ScenePlug::scenePathContextName );
-	childPath.push_back( InternedString() ); // Room for child name
-	ScenePlug::PathScope childScope( context );
+	const ThreadState &threadState = ThreadState::current();
+	using Range = tbb::blocked_range<size_t>;
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 
-	Box3f result;
-	for( const auto &childName : childNamesData->readable() )
-	{
-		childPath.back() = childName;
-		childScope.setPath( childPath );
-		const InputMask childActiveInputs( activeInputsPlug()->getValue() );
-		if( childActiveInputs.count() == 1 && childActiveInputs[firstActiveIndex] )
-		{
-			// Child coming from first input only.
-			// There can be no descendants to merge.
-			continue;
-		}
+	return tbb::parallel_reduce(
+		Range( 0, childNames.size() ),
+		Box3f(),
+		[&] ( const Range &range, const Box3f &bound ) {
 
-		const ScenePlug *childScene = inPlugs()->getChild<ScenePlug>( first( childActiveInputs ) );
+			ScenePlug::PathScope childScope( threadState );
+			ScenePath childPath = context->get<ScenePath>( ScenePlug::scenePathContextName );
+			childPath.push_back( InternedString() ); // Room for child name
 
-		Box3f bound;
-		if( childActiveInputs.count() == 1 )
-		{
-			// Child being merged in from another input.
-			bound = childScene->boundPlug()->getValue();
-		}
-		else
-		{
-			// No child being merged in at this point, but
-			// there may still be a descendant merge lower
-			// in the hierarchy. Recurse.
-			bound = mergedDescendantsBoundPlug()->getValue();
-		}
+			Box3f result = bound;
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				childPath.back() = childNames[i];
+				childScope.setPath( childPath );
+				const InputMask childActiveInputs( activeInputsPlug()->getValue() );
+				if( childActiveInputs.count() == 1 && childActiveInputs[firstActiveIndex] )
+				{
+					// Child coming from first input only.
+					// There can be no descendants to merge.
+					continue;
+				}
 
-		result.extendBy( transform( bound, childScene->transformPlug()->getValue() ) );
-	};
-	return result;
+				const ScenePlug *childScene = inPlugs()->getChild<ScenePlug>( first( childActiveInputs ) );
+
+				Box3f childBound;
+				if( childActiveInputs.count() == 1 )
+				{
+					// Child being merged in from another input.
+					childBound = childScene->boundPlug()->getValue();
+				}
+				else
+				{
+					// No child being merged in at this point, but
+					// there may still be a descendant merge lower
+					// in the hierarchy. Recurse.
+					childBound = mergedDescendantsBoundPlug()->getValue();
+				}
+
+				result.extendBy( transform( childBound, childScene->transformPlug()->getValue() ) );
+			}
+			return result;
+
+		},
+		[] ( const Box3f &x, const Box3f &y ) {
+
+			Box3f result = x;
+			result.extendBy( y );
+			return result;
+
+		},
+		tbb::auto_partitioner(),
+		taskGroupContext
+	);
 }
 
 void MergeScenes::hashBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
@@ -579,59 +662,55 @@ Imath::M44f MergeScenes::computeTransform( const ScenePath &path, const Gaffer::
 
 void MergeScenes::hashAttributes( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
-	visit(
+	const vector<MurmurHash> inputHashes = evaluateInputs<MurmurHash>(
 		activeInputsPlug()->getValue(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					// Pass hash through unchanged
-					h = scene->attributesPlug()->hash();
-					break;
-				case InputType::First :
-					// Initialise hash and fall through
-					SceneProcessor::hashAttributes( path, context, parent, h );
-				case InputType::Other :
-					// Merge input hash
-					scene->attributesPlug()->hash( h );
-			}
-			return true;
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->attributesPlug()->hash();
 		},
 		visitOrder( (Mode)attributesModePlug()->getValue() )
 	);
+
+	if( inputHashes.size() == 1 )
+	{
+		// Pass hash through unchanged
+		h = inputHashes[0];
+		return;
+	}
+
+	// Merge input hashes
+	SceneProcessor::hashAttributes( path, context, parent, h );
+	for( const auto &inputHash : inputHashes )
+	{
+		h.append( inputHash );
+	}
 }
 
 IECore::ConstCompoundObjectPtr MergeScenes::computeAttributes( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstCompoundObjectPtr result;
-	CompoundObjectPtr merged;
-	visit(
+	const vector<ConstCompoundObjectPtr> inputAttributes = evaluateInputs<ConstCompoundObjectPtr>(
 		activeInputsPlug()->getValue(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					// Pass input through unchanged.
-					result = scene->attributesPlug()->getValue();
-					break;
-				case InputType::First :
-					// Initialise merged result and
-					// fall through.
-					merged = new CompoundObject();
-					result = merged;
-				case InputType::Other :
-					// Merge input attributes into result.
-					ConstCompoundObjectPtr attributes = scene->attributesPlug()->getValue();
-					for( const auto &a : attributes->members() )
-					{
-						merged->members()[a.first] = a.second;
-					}
-			}
-			return true;
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->attributesPlug()->getValue();
 		},
 		visitOrder( (Mode)attributesModePlug()->getValue() )
 	);
 
+	if( inputAttributes.size() == 1 )
+	{
+		// Pass input through unchanged.
+		return inputAttributes[0];
+	}
+
+	// Merge input attributes into result.
+	CompoundObjectPtr result = new CompoundObject();
+	for( const auto &attributes : inputAttributes )
+	{
+		for( const auto &a : attributes->members() )
+		{
+			result->members()[a.first] = a.second;
+		}
+	}
+
 	return result;
 }
 
@@ -686,234 +765,221 @@ IECore::ConstObjectPtr MergeScenes::computeObject( const ScenePath &path, const
 
 void MergeScenes::hashChildNames( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
-	visit(
+	const vector<MurmurHash> inputHashes = evaluateInputs<MurmurHash>(
 		activeInputsPlug()->getValue(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					h = scene->childNamesPlug()->hash();
-					break;
-				case InputType::First :
-					SceneProcessor::hashChildNames( path, context, parent, h );
-				case InputType::Other :
-					scene->childNamesPlug()->hash( h );
-			}
-			return true;
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->childNamesPlug()->hash();
 		}
 	);
+
+	if( inputHashes.size() == 1 )
+	{
+		h = inputHashes[0];
+		return;
+	}
+
+	SceneProcessor::hashChildNames( path, context, parent, h );
+	for( const auto &inputHash : inputHashes )
+	{
+		h.append( inputHash );
+	}
 }
 
 IECore::ConstInternedStringVectorDataPtr MergeScenes::computeChildNames( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstInternedStringVectorDataPtr result;
+	const vector<ConstInternedStringVectorDataPtr> inputChildNames = evaluateInputs<ConstInternedStringVectorDataPtr>(
+		activeInputsPlug()->getValue(),
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->childNamesPlug()->getValue();
+		}
+	);
+
+	ConstInternedStringVectorDataPtr result = inputChildNames[0];
 	InternedStringVectorDataPtr merged;
 	unordered_set<InternedString> visited;
 
-	visit(
-		activeInputsPlug()->getValue(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
+	for( size_t i = 1; i < inputChildNames.size(); ++i )
+	{
+		const InternedStringVectorData *toMerge = inputChildNames[i].get();
+		if( toMerge->readable().size() )
+		{
+			if( !merged )
 			{
-				case InputType::Sole :
-				case InputType::First :
-					result = scene->childNamesPlug()->getValue();
-					break;
-				case InputType::Other :
-					ConstInternedStringVectorDataPtr toMerge = scene->childNamesPlug()->getValue();
-					if( toMerge->readable().size() )
-					{
-						if( !merged )
-						{
-							merged = result->copy();
-							result = merged;
-							visited.insert( merged->readable().begin(), merged->readable().end() );
-						}
-
-						for( const auto & n : toMerge->readable() )
-						{
-							if( visited.insert( n ).second )
-							{
-								merged->writable().push_back( n );
-							}
-						}
-					}
+				merged = result->copy();
+				result = merged;
+				visited.insert( merged->readable().begin(), merged->readable().end() );
+			}
+
+			for( const auto & n : toMerge->readable() )
+			{
+				if( visited.insert( n ).second )
+				{
+					merged->writable().push_back( n );
+				}
 			}
-			return true;
 		}
-	);
+	}
 
 	return result;
 }
 
 void MergeScenes::hashGlobals( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
-	visit(
+	const vector<MurmurHash> inputHashes = evaluateInputs<MurmurHash>(
 		connectedInputs(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					// Pass hash through unchanged.
-					h = scene->globalsPlug()->hash();
-					break;
-				case InputType::First :
-					// Initialise hash and fall through.
-					SceneProcessor::hashGlobals( context, parent, h );
-				case InputType::Other :
-					// Merge input hash.
-					scene->globalsPlug()->hash( h );
-			}
-			return true;
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->globalsPlug()->hash();
 		},
 		visitOrder( (Mode)globalsModePlug()->getValue() )
 	);
+
+	if( inputHashes.size() == 1 )
+	{
+		// Pass hash through unchanged.
+		h = inputHashes[0];
+		return;
+	}
+
+	// Merge input hashes.
+	SceneProcessor::hashGlobals( context, parent, h );
+	for( const auto &inputHash : inputHashes )
+	{
+		h.append( inputHash );
+	}
 }
 
 IECore::ConstCompoundObjectPtr MergeScenes::computeGlobals( const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstCompoundObjectPtr result;
-	CompoundObjectPtr merged;
-	visit(
+	const vector<ConstCompoundObjectPtr> inputGlobals = evaluateInputs<ConstCompoundObjectPtr>(
 		connectedInputs(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					// Pass input through unchanged.
-					result = scene->globalsPlug()->getValue();
-					break;
-				case InputType::First :
-					// Initialise merged result and
-					// fall through.
-					merged = new CompoundObject();
-					result = merged;
-				case InputType::Other :
-					// Merge input globals into result.
-					ConstCompoundObjectPtr globals = scene->globalsPlug()->getValue();
-					for( const auto &g : globals->members() )
-					{
-						merged->members()[g.first] = g.second;
-					}
-			}
-			return true;
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->globalsPlug()->getValue();
 		},
 		visitOrder( (Mode)globalsModePlug()->getValue() )
 	);
 
+	if( inputGlobals.size() == 1 )
+	{
+		// Pass input through unchanged.
+		return inputGlobals[0];
+	}
+
+	// Merge input globals into result.
+	CompoundObjectPtr result = new CompoundObject();
+	for( const auto &globals : inputGlobals )
+	{
+		for( const auto &g : globals->members() )
+		{
+			result->members()[g.first] = g.second;
+		}
+	}
+
 	return result;
 }
 
 void MergeScenes::hashSetNames( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
-	visit(
+	const vector<MurmurHash> inputHashes = evaluateInputs<MurmurHash>(
 		connectedInputs(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					// Pass hash through unchanged.
-					h = scene->setNamesPlug()->hash();
-					break;
-				case InputType::First :
-					// Initialise hash and fall through.
-					SceneProcessor::hashSetNames( context, parent, h );
-				case InputType::Other :
-					// Merge input hash.
-					scene->setNamesPlug()->hash( h );
-			}
-			return true;
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->setNamesPlug()->hash();
 		}
 	);
+
+	if( inputHashes.size() == 1 )
+	{
+		// Pass hash through unchanged.
+		h = inputHashes[0];
+		return;
+	}
+
+	// Merge input hashes.
+	SceneProcessor::hashSetNames( context, parent, h );
+	for( const auto &inputHash : inputHashes )
+	{
+		h.append( inputHash );
+	}
 }
 
 IECore::ConstInternedStringVectorDataPtr MergeScenes::computeSetNames( const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstInternedStringVectorDataPtr result;
-	InternedStringVectorDataPtr merged;
-	visit(
+	const vector<ConstInternedStringVectorDataPtr> inputSetNames = evaluateInputs<ConstInternedStringVectorDataPtr>(
 		connectedInputs(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->setNamesPlug()->getValue();
+		}
+	);
+
+	if( inputSetNames.size() == 1 )
+	{
+		// Pass input through unchanged.
+		return inputSetNames[0];
+	}
+
+	InternedStringVectorDataPtr result = new InternedStringVectorData();
+	vector<InternedString> &merged = result->writable();
+	for( const auto &setNames : inputSetNames )
+	{
+		// This naive approach to merging set names preserves the order of the incoming names,
+		// but at the expense of using linear search. We assume that the number of sets is small
+		// enough and the InternedString comparison fast enough that this is OK.
+		for( const auto &setName : setNames->readable() )
+		{
+			if( std::find( merged.begin(), merged.end(), setName ) == merged.end() )
 			{
-				case InputType::Sole :
-					// Pass input through unchanged.
-					result = scene->setNamesPlug()->getValue();
-					break;
-				case InputType::First :
-					// Initialise merged result and
-					// fall through.
-					merged = new InternedStringVectorData();
-					result = merged;
-				case InputType::Other :
-					// This naive approach to merging set names preserves the order of the incoming names,
-					// but at the expense of using linear search. We assume that the number of sets is small
-					// enough and the InternedString comparison fast enough that this is OK.
-					ConstInternedStringVectorDataPtr setNames = scene->setNamesPlug()->getValue();
-					for( const auto &setName : setNames->readable() )
-					{
-						if( std::find( merged->readable().begin(), merged->readable().end(), setName ) == merged->readable().end() )
-						{
-							 merged->writable().push_back( setName );
-						}
-					}
+				merged.push_back( setName );
 			}
-			return true;
 		}
-	);
+	}
 
 	return result;
 }
 
 void MergeScenes::hashSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
-	visit(
+	const vector<MurmurHash> inputHashes = evaluateInputs<MurmurHash>(
 		connectedInputs(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					// Pass hash through unchanged.
-					h = scene->setPlug()->hash();
-					break;
-				case InputType::First :
-					// Initialise hash and fall through.
-					SceneProcessor::hashSet( setName, context, parent, h );
-				case InputType::Other :
-					// Merge input hash.
-					scene->setPlug()->hash( h );
-			}
-			return true;
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->setPlug()->hash();
 		}
 	);
+
+	if( inputHashes.size() == 1 )
+	{
+		// Pass hash through unchanged.
+		h = inputHashes[0];
+		return;
+	}
+
+	// Merge input hashes.
+	SceneProcessor::hashSet( setName, context, parent, h );
+	for( const auto &inputHash : inputHashes )
+	{
+		h.append( inputHash );
+	}
 }
 
 IECore::ConstPathMatcherDataPtr MergeScenes::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstPathMatcherDataPtr result;
-	PathMatcherDataPtr merged;
-	visit(
+	const vector<ConstPathMatcherDataPtr> inputSets = evaluateInputs<ConstPathMatcherDataPtr>(
 		connectedInputs(),
-		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					// Pass input through unchanged.
-					result = scene->setPlug()->getValue();
-					break;
-				case InputType::First :
-					// Initialise merged result and
-					// fall through.
-					merged = new PathMatcherData();
-					result = merged;
-				case InputType::Other :
-					ConstPathMatcherDataPtr paths = scene->setPlug()->getValue();
-					merged->writable().addPaths( paths->readable() );
-			}
-			return true;
+		[] ( size_t index, const ScenePlug *scene ) {
+			return scene->setPlug()->getValue();
 		}
 	);
 
+	if( inputSets.size() == 1 )
+	{
+		// Pass input through unchanged.
+		return inputSets[0];
+	}
+
+	PathMatcherDataPtr result = new PathMatcherData();
+	for( const auto &paths : inputSets )
+	{
+		result->writable().addPaths( paths->readable() );
+	}
+
 	return result;
 }
 
@@ -979,3 +1045,62 @@ void MergeScenes::visit( InputMask inputMask, Visitor &&visitor, VisitOrder orde
 		}
 	}
 }
+
+MergeScenes::InputMask MergeScenes::existingInputs( InputMask inputMask ) const
+{
+	InputMask result;
+	const vector<InputMask> inputResults = evaluateInputs<InputMask>(
+		inputMask,
+		[] ( size_t index, const ScenePlug *scene ) {
+			InputMask m;
+			m[index] = scene->exists();
+			return m;
+		}
+	);
+
+	for( const auto &m : inputResults )
+	{
+		result |= m;
+	}
+	return result;
+}
+
+template<typename T, typename Evaluator>
+std::vector<T> MergeScenes::evaluateInputs( InputMask inputMask, Evaluator &&evaluator, VisitOrder order ) const
+{
+	std::vector<std::pair<size_t, const ScenePlug *>> inputs;
+	visit(
+		inputMask,
+		[&inputs] ( InputType type, size_t index, const ScenePlug *scene ) {
+			inputs.push_back( { index, scene } );
+			return true;
+		},
+		order
+	);
+
+	std::vector<T> result( inputs.size() );
+	if( inputs.size() < g_parallelInputsThreshold )
+	{
+		for( size_t i = 0; i < inputs.size(); ++i )
+		{
+			result[i] = evaluator( inputs[i].first, inputs[i].second );
+		}
+		return result;
+	}
+
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, inputs.size() ),
+		[&] ( const tbb::blocked_range<size_t> &r ) {
+			ThreadState::Scope threadStateScope( threadState );
+			for( size_t i = r.begin(); i != r.end(); ++i )
+			{
+				result[i] = evaluator( inputs[i].first, inputs[i].second );
+			}
+		},
+		taskGroupContext
+	);
+
+	return result;
+}
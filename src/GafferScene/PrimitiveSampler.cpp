@@ -38,12 +38,13 @@
 
 #include "GafferScene/SceneAlgo.h"
 
-#include "IECoreScene/MeshAlgo.h"
-#include "IECoreScene/MeshPrimitive.h"
 #include "IECoreScene/PrimitiveEvaluator.h"
 
+#include "tbb/enumerable_thread_specific.h"
 #include "tbb/parallel_for.h"
 
+#include <algorithm>
+
 using namespace std;
 using namespace tbb;
 using namespace Imath;
@@ -59,7 +60,36 @@ using namespace GafferScene;
 namespace
 {
 
-using OutputVariableFunction = std::function<void ( size_t, const PrimitiveEvaluator::Result & )>;
+// Queries are made in blocks of this size. All the evaluator queries for a
+// block are made first, and then each output variable is filled for the
+// whole block in a single loop. This avoids the overhead of calling an
+// `OutputVariableFunction` per variable per point, and keeps the inner
+// loops specialised for the type of each variable.
+const size_t g_blockSize = 1024;
+
+struct SampleBlock
+{
+	// Indices into the destination primitive that were
+	// sampled successfully.
+	vector<size_t> indices;
+	// Evaluator results corresponding to `indices`. May contain
+	// additional results, which are reused for subsequent blocks.
+	vector<PrimitiveEvaluator::ResultPtr> results;
+};
+
+using OutputVariableFunction = std::function<void ( const SampleBlock & )>;
+
+template<typename T, typename F>
+OutputVariableFunction outputVariableFunction( T *d, F &&f )
+{
+	return [d, f] ( const SampleBlock &block ) {
+		const size_t numSamples = block.indices.size();
+		for( size_t i = 0; i < numSamples; ++i )
+		{
+			d[block.indices[i]] = f( *block.results[i] );
+		}
+	};
+}
 
 M44f matrix( const M44f &transform, GeometricData::Interpretation interpretation )
 {
@@ -101,9 +131,11 @@ OutputVariableFunction addPrimitiveVariable( Primitive *outputPrimitive, const s
 			outputPrimitive->variables[name] = PrimitiveVariable( outputInterpolation, data );
 			V3f *d = data->writable().data();
 			const M44f m = matrix( transform, interpretation );
-			return [d, &sourceVariable, m ] ( size_t index, const PrimitiveEvaluator::Result &result ) {
-				d[index] = result.vectorPrimVar( sourceVariable ) * m;
-			};
+			return outputVariableFunction(
+				d, [&sourceVariable, m] ( const PrimitiveEvaluator::Result &result ) {
+					return result.vectorPrimVar( sourceVariable ) * m;
+				}
+			);
 		}
 		case V2fVectorDataTypeId : {
 			V2fVectorDataPtr data = new V2fVectorData;
@@ -111,36 +143,44 @@ OutputVariableFunction addPrimitiveVariable( Primitive *outputPrimitive, const s
 			data->setInterpretation( static_cast<const V2fVectorData *>( sourceVariable.data.get() )->getInterpretation() );
 			outputPrimitive->variables[name] = PrimitiveVariable( outputInterpolation, data );
 			V2f *d = data->writable().data();
-			return [d, &sourceVariable] ( size_t index, const PrimitiveEvaluator::Result &result ) {
-				d[index] = result.vec2PrimVar( sourceVariable );
-			};
+			return outputVariableFunction(
+				d, [&sourceVariable] ( const PrimitiveEvaluator::Result &result ) {
+					return result.vec2PrimVar( sourceVariable );
+				}
+			);
 		}
 		case Color3fVectorDataTypeId : {
 			Color3fVectorDataPtr data = new Color3fVectorData;
 			data->writable().resize( size, Color3f( 0 ) );
 			outputPrimitive->variables[name] = PrimitiveVariable( outputInterpolation, data );
 			Color3f *d = data->writable().data();
-			return [d, &sourceVariable] ( size_t index, const PrimitiveEvaluator::Result &result ) {
-				d[index] = result.colorPrimVar( sourceVariable );
-			};
+			return outputVariableFunction(
+				d, [&sourceVariable] ( const PrimitiveEvaluator::Result &result ) {
+					return result.colorPrimVar( sourceVariable );
+				}
+			);
 		}
 		case FloatVectorDataTypeId : {
 			FloatVectorDataPtr data = new FloatVectorData;
 			data->writable().resize( size, 0 );
 			outputPrimitive->variables[name] = PrimitiveVariable( outputInterpolation, data );
 			float *d = data->writable().data();
-			return [d, &sourceVariable] ( size_t index, const PrimitiveEvaluator::Result &result ) {
-				d[index] = result.floatPrimVar( sourceVariable );
-			};
+			return outputVariableFunction(
+				d, [&sourceVariable] ( const PrimitiveEvaluator::Result &result ) {
+					return result.floatPrimVar( sourceVariable );
+				}
+			);
 		}
 		case IntVectorDataTypeId : {
 			IntVectorDataPtr data = new IntVectorData;
 			data->writable().resize( size, 0 );
 			outputPrimitive->variables[name] = PrimitiveVariable( outputInterpolation, data );
 			int *d = data->writable().data();
-			return [d, &sourceVariable] ( size_t index, const PrimitiveEvaluator::Result &result ) {
-				d[index] = result.intPrimVar( sourceVariable );
-			};
+			return outputVariableFunction(
+				d, [&sourceVariable] ( const PrimitiveEvaluator::Result &result ) {
+					return result.intPrimVar( sourceVariable );
+				}
+			);
 		}
 		default :
 			// Unsupported type
@@ -299,23 +339,16 @@ IECore::ConstObjectPtr PrimitiveSampler::computeProcessedObject( const ScenePath
 		return inputObject;
 	}
 
-	ConstObjectPtr sourceObject = sourcePlug()->object( sourcePath );
-	const Primitive *sourcePrimitive = runTimeCast<const Primitive>( sourceObject.get() );
-	if( !sourcePrimitive )
-	{
-		return inputObject;
-	}
-
-	ConstPrimitivePtr preprocessedSourcePrimitive = sourcePrimitive;
-	if( auto mesh = runTimeCast<const MeshPrimitive>( preprocessedSourcePrimitive.get() ) )
-	{
-		preprocessedSourcePrimitive = MeshAlgo::triangulate( mesh );
-	}
-	PrimitiveEvaluatorPtr evaluator = PrimitiveEvaluator::create( preprocessedSourcePrimitive );
+	// The evaluator is shared between all locations sampling the same
+	// source object, so we don't pay to triangulate the source and build
+	// its acceleration structures every time. This comes at the expense of
+	// keeping the evaluator resident in the cache after we're done with it.
+	ConstPrimitiveEvaluatorPtr evaluator = SceneAlgo::primitiveEvaluator( sourcePlug(), sourcePath );
 	if( !evaluator )
 	{
 		return inputObject;
 	}
+	ConstPrimitivePtr preprocessedSourcePrimitive = evaluator->primitive();
 
 	PrimitivePtr outputPrimitive = inputPrimitive->copy();
 	const size_t size = outputPrimitive->variableSize( outputInterpolation );
@@ -349,20 +382,38 @@ IECore::ConstObjectPtr PrimitiveSampler::computeProcessedObject( const ScenePath
 
 	const M44f samplingTransform = transform * sourceTransform.inverse();
 
+	tbb::enumerable_thread_specific<SampleBlock> sampleBlocks;
 	auto rangeSampler = [&]( const blocked_range<size_t> &r ) {
-		PrimitiveEvaluator::ResultPtr evaluatorResult = evaluator->createResult();
-		for( size_t i = r.begin(); i != r.end(); ++i )
+		SampleBlock &block = sampleBlocks.local();
+		for( size_t blockBegin = r.begin(); blockBegin < r.end(); blockBegin += g_blockSize )
 		{
 			Canceller::check( context->canceller() );
-			if( samplingFunction( *evaluator, i, samplingTransform, *evaluatorResult ) )
+
+			const size_t blockEnd = std::min( blockBegin + g_blockSize, r.end() );
+			block.indices.clear();
+			for( size_t i = blockBegin; i < blockEnd; ++i )
 			{
-				for( const auto &o : outputVariables )
+				const size_t resultIndex = block.indices.size();
+				if( resultIndex == block.results.size() )
 				{
-					o( i, *evaluatorResult );
+					block.results.push_back( evaluator->createResult() );
 				}
-				if( statusData )
+				if( samplingFunction( *evaluator, i, samplingTransform, *block.results[resultIndex] ) )
+				{
+					block.indices.push_back( i );
+				}
+			}
+
+			for( const auto &o : outputVariables )
+			{
+				o( block );
+			}
+			if( statusData )
+			{
+				vector<bool> &statusWritable = statusData->writable();
+				for( size_t i : block.indices )
 				{
-					statusData->writable()[i] = true;
+					statusWritable[i] = true;
 				}
 			}
 		}
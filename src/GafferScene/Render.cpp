@@ -37,6 +37,7 @@
 #include "GafferScene/Render.h"
 
 #include "GafferScene/Private/IECoreScenePreview/Renderer.h"
+#include "GafferScene/RenderController.h"
 #include "GafferScene/RendererAlgo.h"
 #include "GafferScene/SceneNode.h"
 #include "GafferScene/ScenePlug.h"
@@ -49,6 +50,7 @@
 
 #include "boost/filesystem.hpp"
 
+#include <limits>
 #include <memory>
 
 using namespace IECore;
@@ -300,11 +302,7 @@ void Render::execute() const
 		RendererAlgo::RenderSets renderSets( adaptedInPlug() );
 		RendererAlgo::LightLinks lightLinks;
 
-		RendererAlgo::outputCameras( adaptedInPlug(), globals.get(), renderSets, renderer.get() );
-		RendererAlgo::outputLights( adaptedInPlug(), globals.get(), renderSets, &lightLinks, renderer.get() );
-		RendererAlgo::outputLightFilters( adaptedInPlug(), globals.get(), renderSets, &lightLinks, renderer.get() );
-		lightLinks.outputLightFilterLinks( adaptedInPlug() );
-		RendererAlgo::outputObjects( adaptedInPlug(), globals.get(), renderSets, &lightLinks, renderer.get() );
+		RendererAlgo::outputScene( adaptedInPlug(), globals.get(), renderSets, &lightLinks, renderer.get() );
 	}
 
 	if( renderScope.sceneTranslationOnly() )
@@ -333,3 +331,94 @@ void Render::execute() const
 		std::cerr << MonitorAlgo::formatStatistics( *performanceMonitor );
 	}
 }
+
+void Render::executeSequence( const std::vector<float> &frames ) const
+{
+	// We can only share a renderer between frames if the renderer type
+	// and mode are the same for all of them, and the renderer supports
+	// `waitForRender()`. Scene descriptions are written to a separate
+	// file per frame, so there is nothing to gain from sharing a renderer
+	// for them.
+
+	std::string rendererType;
+	bool shareRenderer = frames.size() > 1 && inPlug()->source()->direction() == Plug::Out;
+	if( shareRenderer )
+	{
+		RenderScope renderScope( Context::current() );
+		for( size_t i = 0; i < frames.size() && shareRenderer; ++i )
+		{
+			renderScope.setFrame( frames[i] );
+			const std::string frameRendererType = rendererPlug()->getValue();
+			if( i == 0 )
+			{
+				rendererType = frameRendererType;
+			}
+			shareRenderer = frameRendererType == rendererType && static_cast<Mode>( modePlug()->getValue() ) == RenderMode;
+		}
+		shareRenderer = shareRenderer && !rendererType.empty() && IECoreScenePreview::Renderer::supportsWaitForRender( rendererType );
+	}
+
+	IECoreScenePreview::RendererPtr renderer;
+	if( shareRenderer )
+	{
+		renderer = IECoreScenePreview::Renderer::create( rendererType, IECoreScenePreview::Renderer::Interactive );
+	}
+
+	if( !renderer )
+	{
+		TaskNode::executeSequence( frames );
+		return;
+	}
+
+	// Use a RenderController to output the scene for each
+	// frame. This compares the hashes for each location with
+	// those from the previous frame, and only outputs the
+	// locations that have changed.
+
+	RenderScope renderScope( Context::current() );
+	renderScope.set( g_rendererContextName, rendererType );
+
+	ContextPtr context = new Context( *Context::current() );
+	context->setFrame( frames[0] );
+	Context::Scope contextScope( context.get() );
+
+	PerformanceMonitorPtr performanceMonitor;
+	{
+		ConstCompoundObjectPtr globals = adaptedInPlug()->globalsPlug()->getValue();
+		if( const BoolData *d = globals->member<const BoolData>( g_performanceMonitorOptionName ) )
+		{
+			if( d->readable() )
+			{
+				performanceMonitor = new PerformanceMonitor;
+			}
+		}
+	}
+	Monitor::Scope performanceMonitorScope( performanceMonitor );
+
+	RenderController renderController( adaptedInPlug(), context, renderer );
+	renderController.setMinimumExpansionDepth( std::numeric_limits<size_t>::max() );
+
+	for( auto frame : frames )
+	{
+		context->setFrame( frame );
+		if( !renderScope.sceneTranslationOnly() )
+		{
+			ConstCompoundObjectPtr globals = adaptedInPlug()->globalsPlug()->getValue();
+			GafferScene::RendererAlgo::createOutputDirectories( globals.get() );
+		}
+
+		renderController.update();
+
+		if( !renderScope.sceneTranslationOnly() )
+		{
+			renderer->render();
+			renderer->waitForRender();
+		}
+	}
+
+	if( performanceMonitor )
+	{
+		std::cerr << "\nPerformance Monitor\n===================\n\n";
+		std::cerr << MonitorAlgo::formatStatistics( *performanceMonitor );
+	}
+}
@@ -36,7 +36,10 @@
 
 #include "GafferScene/RenderController.h"
 
+#include "GafferScene/AttributeProcessor.h"
+#include "GafferScene/ObjectProcessor.h"
 #include "GafferScene/SceneAlgo.h"
+#include "GafferScene/SceneElementProcessor.h"
 
 #include "Gaffer/ParallelAlgo.h"
 
@@ -286,6 +289,36 @@ class RenderController::SceneGraph
 			}
 		}
 
+		// As above, but only dirtying the locations matched exactly by
+		// `paths`. Unexpanded ancestors of those locations also have their
+		// bounds dirtied, since they are drawn as bounding boxes.
+		void dirty( unsigned components, const PathMatcher &paths, ScenePlug::ScenePath &path )
+		{
+			const unsigned match = paths.match( path );
+			if( match & PathMatcher::ExactMatch )
+			{
+				m_dirtyComponents |= components;
+			}
+
+			if( !( match & PathMatcher::DescendantMatch ) )
+			{
+				return;
+			}
+
+			if( !m_expanded )
+			{
+				m_dirtyComponents |= ( components & BoundComponent );
+			}
+
+			path.push_back( InternedString() );
+			for( const auto &c : m_children )
+			{
+				path.back() = c->name();
+				c->dirty( components, paths, path );
+			}
+			path.pop_back();
+		}
+
 		// Called by SceneGraphUpdateTask to update this location. Returns true if
 		// anything changed.
 		bool update( const ScenePlug::ScenePath &path, unsigned changedGlobals, Type type, RenderController *controller )
@@ -720,6 +753,9 @@ class RenderController::SceneGraph
 			else
 			{
 				m_objectInterface = renderer->object( name, object.get(), attributesInterface( renderer ) );
+				// New objects must always be linked, even if the
+				// links themselves are unchanged.
+				m_lightLinksHash = IECore::MurmurHash();
 			}
 
 			return true;
@@ -884,7 +920,8 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 			const ThreadState &threadState,
 			const ScenePlug::ScenePath &scenePath,
 			const ProgressCallback &callback,
-			const PathMatcher *pathsToUpdate
+			const PathMatcher *pathsToUpdate,
+			bool pathsToUpdateComplete
 		)
 			:	m_controller( controller ),
 				m_sceneGraph( sceneGraph ),
@@ -893,7 +930,8 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				m_threadState( threadState ),
 				m_scenePath( scenePath ),
 				m_callback( callback ),
-				m_pathsToUpdate( pathsToUpdate )
+				m_pathsToUpdate( pathsToUpdate ),
+				m_pathsToUpdateComplete( pathsToUpdateComplete )
 		{
 		}
 
@@ -949,7 +987,7 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				for( const auto &child : children )
 				{
 					childPath.back() = child->name();
-					SceneGraphUpdateTask *t = new( allocate_child() ) SceneGraphUpdateTask( m_controller, child.get(), m_sceneGraphType, m_changedGlobalComponents, m_threadState, childPath, m_callback, m_pathsToUpdate );
+					SceneGraphUpdateTask *t = new( allocate_child() ) SceneGraphUpdateTask( m_controller, child.get(), m_sceneGraphType, m_changedGlobalComponents, m_threadState, childPath, m_callback, m_pathsToUpdate, m_pathsToUpdateComplete );
 					spawn( *t );
 				}
 
@@ -963,7 +1001,10 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				}
 			}
 
-			if( pathsToUpdateMatch & ( PathMatcher::AncestorMatch | PathMatcher::ExactMatch ) )
+			// If `m_pathsToUpdate` contains every location that needs
+			// updating, then we have visited all the children that
+			// require it, even if we didn't visit all the children.
+			if( m_pathsToUpdateComplete || ( pathsToUpdateMatch & ( PathMatcher::AncestorMatch | PathMatcher::ExactMatch ) ) )
 			{
 				m_sceneGraph->allChildrenUpdated();
 			}
@@ -1015,6 +1056,7 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 		ScenePlug::ScenePath m_scenePath;
 		const ProgressCallback &m_callback;
 		const PathMatcher *m_pathsToUpdate;
+		bool m_pathsToUpdateComplete;
 
 };
 
@@ -1028,6 +1070,10 @@ RenderController::RenderController( const ConstScenePlugPtr &scene, const Gaffer
 		m_updateRequired( false ),
 		m_updateRequested( false ),
 		m_failedAttributeEdits( 0 ),
+		m_pendingDirtyPathsInvalid( false ),
+		m_pendingDirtyComponents( SceneGraph::NoComponent ),
+		m_dirtyPathsComponents( SceneGraph::NoComponent ),
+		m_dirtyPathsValid( false ),
 		m_dirtyGlobalComponents( NoGlobalComponent ),
 		m_globals( new CompoundObject )
 {
@@ -1059,6 +1105,10 @@ RenderController::~RenderController()
 	// Cancel background task before the things it relies
 	// on are destroyed.
 	cancelBackgroundTask();
+	for( auto &c : m_upstreamConnections )
+	{
+		c.disconnect();
+	}
 	// Drop references to ObjectInterfaces before the renderer
 	// is destroyed.
 	m_renderer->pause();
@@ -1091,6 +1141,7 @@ void RenderController::setScene( const ConstScenePlugPtr &scene )
 	m_plugDirtiedConnection = const_cast<Node *>( node )->plugDirtiedSignal().connect(
 		boost::bind( &RenderController::plugDirtied, this, ::_1 )
 	);
+	updateUpstreamProcessors();
 
 	dirtyGlobals( AllGlobalComponents );
 	dirtySceneGraphs( SceneGraph::AllComponents );
@@ -1171,21 +1222,25 @@ bool RenderController::updateRequired() const
 
 void RenderController::plugDirtied( const Gaffer::Plug *plug )
 {
+	// Dirtiness for the per-location components is accumulated until
+	// the scene plug itself is dirtied, which is signalled after all
+	// its children. At that point we know whether or not the dirtiness
+	// came solely from edits to our upstream processors.
 	if( plug == m_scene->boundPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::BoundComponent );
+		m_pendingDirtyComponents |= SceneGraph::BoundComponent;
 	}
 	else if( plug == m_scene->transformPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::TransformComponent );
+		m_pendingDirtyComponents |= SceneGraph::TransformComponent;
 	}
 	else if( plug == m_scene->attributesPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::AttributesComponent );
+		m_pendingDirtyComponents |= SceneGraph::AttributesComponent;
 	}
 	else if( plug == m_scene->objectPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::ObjectComponent );
+		m_pendingDirtyComponents |= SceneGraph::ObjectComponent;
 	}
 	else if( plug == m_scene->childNamesPlug() )
 	{
@@ -1201,10 +1256,153 @@ void RenderController::plugDirtied( const Gaffer::Plug *plug )
 	}
 	else if( plug == m_scene )
 	{
+		if( m_pendingDirtyComponents )
+		{
+			if( !m_pendingDirtyPathsInvalid && m_pendingDirtyPathsSources.size() )
+			{
+				for( const auto &source : m_pendingDirtyPathsSources )
+				{
+					if( std::find( m_dirtyPathsSources.begin(), m_dirtyPathsSources.end(), source ) == m_dirtyPathsSources.end() )
+					{
+						m_dirtyPathsSources.push_back( source );
+					}
+				}
+				m_dirtyPathsComponents |= m_pendingDirtyComponents;
+			}
+			else
+			{
+				dirtySceneGraphs( m_pendingDirtyComponents );
+			}
+		}
+		m_pendingDirtyPathsSources.clear();
+		m_pendingDirtyPathsInvalid = false;
+		m_pendingDirtyComponents = SceneGraph::NoComponent;
 		requestUpdate();
 	}
 }
 
+void RenderController::updateUpstreamProcessors()
+{
+	for( auto &c : m_upstreamConnections )
+	{
+		c.disconnect();
+	}
+	m_upstreamConnections.clear();
+	m_upstreamProcessors.clear();
+
+	// Walk upstream from `m_scene`, collecting the chain of filtered
+	// processors whose per-location outputs feed directly into it. We
+	// follow connections through nodes such as Boxes and Dots, and through
+	// nodes which only modify the globals, since none of these can affect
+	// individual locations. We stop at the first node which might modify
+	// locations in some other way.
+
+	boost::container::flat_set<const Node *> visited;
+	auto monitor = [this, &visited] ( const Node *node ) {
+		if( node && visited.insert( node ).second )
+		{
+			m_upstreamConnections.push_back(
+				const_cast<Node *>( node )->plugInputChangedSignal().connect(
+					boost::bind( &RenderController::upstreamPlugInputChanged, this, ::_1 )
+				)
+			);
+		}
+	};
+
+	const ScenePlug *scene = m_scene.get();
+	while( scene )
+	{
+		while( const ScenePlug *input = scene->getInput<ScenePlug>() )
+		{
+			monitor( scene->node() );
+			scene = input;
+		}
+
+		const Node *node = scene->node();
+		monitor( node );
+
+		const FilteredSceneProcessor *processor = runTimeCast<const FilteredSceneProcessor>( node );
+		if(
+			processor && scene == processor->outPlug() &&
+			(
+				runTimeCast<const SceneElementProcessor>( processor ) ||
+				runTimeCast<const AttributeProcessor>( processor ) ||
+				runTimeCast<const ObjectProcessor>( processor )
+			)
+		)
+		{
+			// These processors only modify the locations matched
+			// by their filter, and the bounds of their ancestors.
+			m_upstreamProcessors.push_back( processor );
+			m_upstreamConnections.push_back(
+				const_cast<FilteredSceneProcessor *>( processor )->plugDirtiedSignal().connect(
+					boost::bind( &RenderController::upstreamPlugDirtied, this, ::_1 )
+				)
+			);
+			scene = processor->inPlug();
+			continue;
+		}
+
+		// Nodes which pass through all locations unchanged.
+		const ValuePlug *locationPlugs[] = { scene->boundPlug(), scene->transformPlug(), scene->attributesPlug(), scene->objectPlug(), scene->childNamesPlug() };
+		const ScenePlug *passThrough = nullptr;
+		for( const ValuePlug *p : locationPlugs )
+		{
+			const ValuePlug *input = p->getInput<ValuePlug>();
+			const ScenePlug *inputScene = input ? input->parent<ScenePlug>() : nullptr;
+			if( !inputScene || input->getName() != p->getName() || ( passThrough && inputScene != passThrough ) )
+			{
+				passThrough = nullptr;
+				break;
+			}
+			passThrough = inputScene;
+		}
+		scene = passThrough;
+	}
+}
+
+void RenderController::upstreamPlugDirtied( const Gaffer::Plug *plug )
+{
+	const FilteredSceneProcessor *processor = runTimeCast<const FilteredSceneProcessor>( plug->node() );
+
+	auto isOrContains = [plug] ( const Plug *p ) {
+		return p == plug || p->isAncestorOf( plug );
+	};
+
+	if( isOrContains( processor->outPlug() ) )
+	{
+		return;
+	}
+	else if( isOrContains( processor->filterPlug() ) )
+	{
+		// The set of matching paths itself may have changed.
+		m_pendingDirtyPathsInvalid = true;
+	}
+	else if( isOrContains( processor->inPlug() ) )
+	{
+		// Dirtiness arriving at the last processor in the chain comes
+		// from somewhere we know nothing about. Anywhere else, it is
+		// just the result of edits to processors further upstream.
+		if( processor == m_upstreamProcessors.back() )
+		{
+			m_pendingDirtyPathsInvalid = true;
+		}
+	}
+	else if( std::find( m_pendingDirtyPathsSources.begin(), m_pendingDirtyPathsSources.end(), processor ) == m_pendingDirtyPathsSources.end() )
+	{
+		m_pendingDirtyPathsSources.push_back( processor );
+	}
+}
+
+void RenderController::upstreamPlugInputChanged( const Gaffer::Plug *plug )
+{
+	// Input changes are signalled before dirtiness is propagated,
+	// so this also prevents the pending dirtiness from being treated
+	// as a processor edit.
+	m_pendingDirtyPathsInvalid = true;
+	updateUpstreamProcessors();
+}
+
 void RenderController::contextChanged( const IECore::InternedString &name )
 {
 	if( boost::starts_with( name.string(), "ui:" ) )
@@ -1240,6 +1438,45 @@ void RenderController::dirtySceneGraphs( unsigned components )
 	{
 		sg->dirty( components );
 	}
+	// Locations outside any dirty paths now need updating too.
+	m_dirtyPathsValid = false;
+}
+
+bool RenderController::updateDirtyPaths()
+{
+	if( !m_dirtyPathsValid || m_dirtyGlobalComponents != NoGlobalComponent || m_changedGlobalComponents != NoGlobalComponent )
+	{
+		// A full update is needed anyway, so there's no
+		// point in computing the dirty paths.
+		dirtySceneGraphs( m_dirtyPathsComponents );
+		m_dirtyPathsSources.clear();
+		m_dirtyPathsComponents = SceneGraph::NoComponent;
+		return false;
+	}
+
+	if( m_dirtyPathsSources.empty() )
+	{
+		// Either there is nothing to update, or we are
+		// resuming a previously cancelled update.
+		return !m_dirtyPaths.isEmpty();
+	}
+
+	PathMatcher paths;
+	for( const auto &source : m_dirtyPathsSources )
+	{
+		SceneAlgo::matchingPaths( source->filterPlug(), source->inPlug(), paths );
+	}
+
+	ScenePlug::ScenePath path;
+	for( auto &sg : m_sceneGraphs )
+	{
+		sg->dirty( m_dirtyPathsComponents, paths, path );
+	}
+
+	m_dirtyPaths.addPaths( paths );
+	m_dirtyPathsSources.clear();
+	m_dirtyPathsComponents = SceneGraph::NoComponent;
+	return true;
 }
 
 void RenderController::update( const ProgressCallback &callback )
@@ -1302,6 +1539,14 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 {
 	try
 	{
+		// Figure out which locations need updating
+
+		const PathMatcher *sceneGraphPathsToUpdate = pathsToUpdate;
+		if( !pathsToUpdate && updateDirtyPaths() )
+		{
+			sceneGraphPathsToUpdate = &m_dirtyPaths;
+		}
+
 		// Update globals
 
 		if( m_dirtyGlobalComponents & GlobalsGlobalComponent )
@@ -1338,27 +1583,12 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 
 		// Update scene graphs
 
-		for( int i = SceneGraph::FirstType; i <= SceneGraph::LastType; ++i )
+		updateSceneGraphs( callback, sceneGraphPathsToUpdate, /* pathsToUpdateComplete = */ !pathsToUpdate );
+		if( sceneGraphPathsToUpdate == &m_dirtyPaths && m_lightLinks && m_lightLinks->lightLinksDirty() )
 		{
-			SceneGraph *sceneGraph = m_sceneGraphs[i].get();
-			if( i == SceneGraph::CameraType && ( m_changedGlobalComponents & CameraOptionsGlobalComponent ) )
-			{
-				// Because the globals are applied to camera objects, we must update the object whenever
-				// the globals have changed, so we clear the scene graph and start again.
-				/// \todo Can we do better here, by using m_changedGlobalComponents in `SceneGraph::update()`?
-				sceneGraph->clear();
-			}
-
-			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
-			SceneGraphUpdateTask *task = new( tbb::task::allocate_root( taskGroupContext ) ) SceneGraphUpdateTask(
-				this, sceneGraph, (SceneGraph::Type)i, m_changedGlobalComponents, ThreadState::current(), ScenePlug::ScenePath(), callback, pathsToUpdate
-			);
-			tbb::task::spawn_root_and_wait( *task );
-
-			if( i == SceneGraph::LightFilterType && m_lightLinks && m_lightLinks->lightFilterLinksDirty() )
-			{
-				m_lightLinks->outputLightFilterLinks( m_scene.get() );
-			}
+			// Edits to lights require new links to be output for
+			// locations outside of the dirty paths.
+			updateSceneGraphs( callback, nullptr, /* pathsToUpdateComplete = */ true );
 		}
 
 		if( m_changedGlobalComponents & CameraOptionsGlobalComponent )
@@ -1371,6 +1601,8 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 			// Only clear `m_changedGlobalComponents` when we
 			// know our entire scene has been updated successfully.
 			m_changedGlobalComponents = NoGlobalComponent;
+			m_dirtyPaths.clear();
+			m_dirtyPathsValid = true;
 			m_updateRequired = false;
 			if( m_failedAttributeEdits )
 			{
@@ -1414,6 +1646,32 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 	}
 }
 
+void RenderController::updateSceneGraphs( const ProgressCallback &callback, const IECore::PathMatcher *pathsToUpdate, bool pathsToUpdateComplete )
+{
+	for( int i = SceneGraph::FirstType; i <= SceneGraph::LastType; ++i )
+	{
+		SceneGraph *sceneGraph = m_sceneGraphs[i].get();
+		if( i == SceneGraph::CameraType && ( m_changedGlobalComponents & CameraOptionsGlobalComponent ) )
+		{
+			// Because the globals are applied to camera objects, we must update the object whenever
+			// the globals have changed, so we clear the scene graph and start again.
+			/// \todo Can we do better here, by using m_changedGlobalComponents in `SceneGraph::update()`?
+			sceneGraph->clear();
+		}
+
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+		SceneGraphUpdateTask *task = new( tbb::task::allocate_root( taskGroupContext ) ) SceneGraphUpdateTask(
+			this, sceneGraph, (SceneGraph::Type)i, m_changedGlobalComponents, ThreadState::current(), ScenePlug::ScenePath(), callback, pathsToUpdate, pathsToUpdateComplete
+		);
+		tbb::task::spawn_root_and_wait( *task );
+
+		if( i == SceneGraph::LightFilterType && m_lightLinks && m_lightLinks->lightFilterLinksDirty() )
+		{
+			m_lightLinks->outputLightFilterLinks( m_scene.get() );
+		}
+	}
+}
+
 void RenderController::updateDefaultCamera()
 {
 	if( m_renderer->name() == g_openGLRendererName )
@@ -63,6 +63,7 @@
 #include "boost/filesystem.hpp"
 
 #include "tbb/blocked_range.h"
+#include "tbb/concurrent_vector.h"
 #include "tbb/parallel_reduce.h"
 #include "tbb/parallel_for.h"
 #include "tbb/task.h"
@@ -129,23 +130,46 @@ void transformSamples( const ScenePlug *scene, size_t segments, const Imath::V2f
 		return;
 	}
 
-	// Motion case
+	// Motion case. We hash all the samples first, so that
+	// we only need to compute the distinct ones.
 
 	motionTimes( segments, shutter, sampleTimes );
 
 	Context::EditableScope timeContext( Context::current() );
 
-	bool moving = false;
-	samples.reserve( sampleTimes.size() );
+	vector<MurmurHash> hashes; hashes.reserve( sampleTimes.size() );
+	bool uniformHash = true;
 	for( const float sampleTime : sampleTimes )
 	{
 		timeContext.setFrame( sampleTime );
-		const M44f m = scene->transformPlug()->getValue();
-		if( !moving && !samples.empty() && m != samples.front() )
+		hashes.push_back( scene->transformPlug()->hash() );
+		uniformHash = uniformHash && hashes.back() == hashes.front();
+	}
+
+	if( uniformHash )
+	{
+		timeContext.setFrame( sampleTimes.front() );
+		samples.push_back( scene->transformPlug()->getValue( &hashes.front() ) );
+		sampleTimes.clear();
+		return;
+	}
+
+	// Differing hashes don't necessarily mean differing values, so
+	// we decide whether or not we're moving by comparing the matrices
+	// themselves.
+
+	bool moving = false;
+	samples.reserve( sampleTimes.size() );
+	for( size_t i = 0; i < sampleTimes.size(); ++i )
+	{
+		if( i && hashes[i] == hashes[i-1] )
 		{
-			moving = true;
+			samples.push_back( samples.back() );
+			continue;
 		}
-		samples.push_back( m );
+		timeContext.setFrame( sampleTimes[i] );
+		samples.push_back( scene->transformPlug()->getValue( &hashes[i] ) );
+		moving = moving || samples.back() != samples.front();
 	}
 
 	if( !moving )
@@ -175,38 +199,69 @@ void objectSamples( const ScenePlug *scene, size_t segments, const Imath::V2f &s
 		return;
 	}
 
-	// Motion case
+	// Motion case. We hash all the samples first, so that
+	// we only need to compute the distinct ones.
 
 	motionTimes( segments, shutter, sampleTimes );
 
+	const ThreadState &threadState = ThreadState::current();
 	const Context *frameContext = Context::current();
-	Context::EditableScope timeContext( frameContext );
 
-	bool moving = false;
-	MurmurHash lastHash;
-	samples.reserve( sampleTimes.size() );
-	for( const float sampleTime : sampleTimes )
+	vector<MurmurHash> hashes; hashes.reserve( sampleTimes.size() );
+	vector<size_t> distinctSamples;
 	{
-		timeContext.setFrame( sampleTime );
+		Context::EditableScope timeContext( frameContext );
+		for( size_t i = 0; i < sampleTimes.size(); ++i )
+		{
+			timeContext.setFrame( sampleTimes[i] );
+			hashes.push_back( scene->objectPlug()->hash() );
+			if( !i || std::find( hashes.begin(), hashes.end() - 1, hashes.back() ) == hashes.end() - 1 )
+			{
+				distinctSamples.push_back( i );
+			}
+		}
+	}
 
-		const MurmurHash objectHash = scene->objectPlug()->hash();
-		ConstObjectPtr object = scene->objectPlug()->getValue( &objectHash );
+	// Compute the distinct samples, in parallel if there
+	// is more than one.
 
-		if(
-			runTimeCast<const Primitive>( object.get() ) ||
-			runTimeCast<const Camera>( object.get() )
-		)
+	samples.resize( sampleTimes.size() );
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, distinctSamples.size() ),
+		[&]( const tbb::blocked_range<size_t> &range )
 		{
-			// We can support multiple samples for these, so check to see
-			// if we actually have something moving.
-			if( !moving && !samples.empty() && objectHash != lastHash )
+			Context::EditableScope timeContext( threadState );
+			for( size_t i = range.begin(); i != range.end(); ++i )
 			{
-				moving = true;
+				const size_t sampleIndex = distinctSamples[i];
+				timeContext.setFrame( sampleTimes[sampleIndex] );
+				samples[sampleIndex] = scene->objectPlug()->getValue( &hashes[sampleIndex] );
 			}
-			samples.push_back( object.get() );
-			lastHash = objectHash;
+		},
+		taskGroupContext
+	);
+
+	// Fill in the duplicates, and check that we have
+	// something we can actually motion blur.
+
+	for( size_t i = 0; i < samples.size(); ++i )
+	{
+		if( !samples[i] )
+		{
+			samples[i] = samples[std::find( hashes.begin(), hashes.begin() + i, hashes[i] ) - hashes.begin()];
 		}
-		else if( runTimeCast<const VisibleRenderable>( object.get() ) )
+
+		const Object *object = samples[i].get();
+		if(
+			runTimeCast<const Primitive>( object ) ||
+			runTimeCast<const Camera>( object )
+		)
+		{
+			// We can support multiple samples for these.
+			continue;
+		}
+		else if( runTimeCast<const VisibleRenderable>( object ) )
 		{
 			// We can't motion blur these chappies, so just take the one
 			// sample. This must be at the frame time rather than shutter
@@ -220,10 +275,14 @@ void objectSamples( const ScenePlug *scene, size_t segments, const Imath::V2f &s
 		{
 			// We don't even know what these chappies are, so
 			// don't take any samples at all.
+			samples.resize( i );
+			hashes.resize( i );
+			sampleTimes.resize( i );
 			break;
 		}
 	}
 
+	const bool moving = samples.size() > 1 && std::find_if( hashes.begin(), hashes.end(), [&hashes]( const MurmurHash &h ) { return h != hashes.front(); } ) != hashes.end();
 	if( !moving )
 	{
 		samples.resize( std::min<size_t>( samples.size(), 1 ) );
@@ -553,7 +612,7 @@ namespace RendererAlgo
 {
 
 LightLinks::LightLinks()
-	:	m_lightLinksDirty( true ), m_lightFilterLinksDirty( true )
+	:	m_setsGeneration( 1 ), m_lightsGeneration( 1 ), m_lightLinksDirty( true ), m_lightFilterLinksDirty( true )
 {
 }
 
@@ -564,17 +623,17 @@ void LightLinks::addLight( const std::string &path, const IECoreScenePreview::Re
 	m_lights.insert( a, path );
 	assert( !a->second ); // We expect `removeLight()` to be called before `addLight()` is called again
 	a->second = light;
+	m_lightsGeneration++;
 	m_lightLinksDirty = true;
 	m_lightFilterLinksDirty = true;
-	clearLightLinks();
 }
 
 void LightLinks::removeLight( const std::string &path )
 {
 	m_lights.erase( path );
+	m_lightsGeneration++;
 	m_lightLinksDirty = true;
 	m_lightFilterLinksDirty = true;
-	clearLightLinks();
 }
 
 void LightLinks::addLightFilter( const IECoreScenePreview::Renderer::ObjectInterfacePtr &lightFilter, const IECore::CompoundObject *attributes )
@@ -662,7 +721,7 @@ void LightLinks::setsDirtied()
 	{
 		f.second.filteredLightsDirty = true;
 	}
-	clearLightLinks();
+	m_setsGeneration++;
 	m_lightLinksDirty = true;
 	m_lightFilterLinksDirty = true;
 }
@@ -683,14 +742,6 @@ void LightLinks::clean()
 	m_lightFilterLinksDirty = false;
 }
 
-void LightLinks::clearLightLinks()
-{
-	// We may be called concurrently from `addLight()/removeLight()`, and
-	// `clear()` is not threadsafe - hence the mutex.
-	tbb::spin_mutex::scoped_lock l( m_lightLinksClearMutex );
-	m_lightLinks.clear();
-}
-
 std::string LightLinks::filteredLightsExpression( const IECore::CompoundObject *attributes ) const
 {
 	const StringData *d = attributes->member<StringData>( g_filteredLightsAttributeName );
@@ -707,60 +758,103 @@ void LightLinks::outputLightLinks( const ScenePlug *scene, const IECore::Compoun
 	const std::string linkedLightsExpression = linkedLightsExpressionData ? linkedLightsExpressionData->readable() : "defaultLights";
 	const std::string linkedShadowsExpression = linkedShadowsExpressionData ? linkedShadowsExpressionData->readable() : "__lights";
 
+	uint64_t lightsVersion, shadowsVersion;
+	IECoreScenePreview::Renderer::ConstObjectSetPtr lights = linkedLights( linkedLightsExpression, scene, lightsVersion );
+	IECoreScenePreview::Renderer::ConstObjectSetPtr shadows = linkedLights( linkedShadowsExpression, scene, shadowsVersion );
+
 	if( hash )
 	{
 		IECore::MurmurHash h;
 		h.append( linkedLightsExpression );
 		h.append( linkedShadowsExpression );
-		if( !m_lightLinksDirty && *hash == h )
-		{
-			// We're only being called because the attributes have changed as a whole, but the
-			// specific attributes we care about haven't changed. No need to relink anything.
-			/// \todo Investigate other optimisations. Perhaps `setExpressionHash()` is fast enough
-			/// that we could use it to avoid editing links when sets have been dirtied but the
-			/// specific sets we care about haven't changed?
+		h.append( lightsVersion );
+		h.append( shadowsVersion );
+		if( *hash == h )
+		{
+			// Either the attributes have changed as a whole but the specific
+			// attributes we care about haven't, or sets or lights have changed
+			// without affecting the lights we are linked to. No need to relink
+			// anything.
 			return;
 		}
 		*hash = h;
 	}
 
-	IECoreScenePreview::Renderer::ConstObjectSetPtr objectSet = linkedLights( linkedLightsExpression, scene );
-	object->link( g_lights, objectSet );
-	objectSet = linkedLights( linkedShadowsExpression, scene );
-	object->link( g_shadowGroupAttributeName, objectSet );
+	object->link( g_lights, lights );
+	object->link( g_shadowGroupAttributeName, shadows );
 }
 
-IECoreScenePreview::Renderer::ConstObjectSetPtr LightLinks::linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene ) const
+IECoreScenePreview::Renderer::ConstObjectSetPtr LightLinks::linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene, uint64_t &version ) const
 {
-	LightLinkMap::accessor a;
-	if( !m_lightLinks.insert( a, linkedLightsExpression ) )
+	const uint64_t setsGeneration = m_setsGeneration;
+	const uint64_t lightsGeneration = m_lightsGeneration;
+
 	{
-		// Already did the work
-		return a->second;
+		// Fast path for when the LightLink is already up to date. This
+		// uses a `const_accessor` so that we don't serialise calls for
+		// common expressions such as "defaultLights".
+		LightLinkMap::const_accessor a;
+		if(
+			m_lightLinks.find( a, linkedLightsExpression ) &&
+			a->second.setsGeneration == setsGeneration &&
+			a->second.lightsGeneration == lightsGeneration
+		)
+		{
+			version = a->second.version;
+			return a->second.lights;
+		}
 	}
 
-	PathMatcher paths = SetAlgo::evaluateSetExpression( linkedLightsExpression, scene );
+	LightLinkMap::accessor a;
+	m_lightLinks.insert( a, linkedLightsExpression );
+	LightLink &lightLink = a->second;
 
-	auto objectSet = std::make_shared<IECoreScenePreview::Renderer::ObjectSet>();
-	for( PathMatcher::Iterator it = paths.begin(), eIt = paths.end(); it != eIt; ++it )
+	bool pathsChanged = false;
+	if( lightLink.setsGeneration != setsGeneration )
 	{
-		std::string pathString;
-		ScenePlug::pathToString( *it, pathString );
-		LightMap::const_accessor a;
-		if( m_lights.find( a, pathString ) )
-		{
-			objectSet->insert( a->second );
+		// Sets have been dirtied, but we only need to reevaluate
+		// the expression if the sets it refers to have changed.
+		const IECore::MurmurHash setExpressionHash = SetAlgo::setExpressionHash( linkedLightsExpression, scene );
+		if( setExpressionHash != lightLink.setExpressionHash )
+		{
+			lightLink.paths = SetAlgo::evaluateSetExpression( linkedLightsExpression, scene );
+			lightLink.setExpressionHash = setExpressionHash;
+			pathsChanged = true;
 		}
+		lightLink.setsGeneration = setsGeneration;
 	}
-	if( objectSet->size() == m_lights.size() )
+
+	if( pathsChanged || lightLink.lightsGeneration != lightsGeneration )
 	{
-		// All lights are linked, in which case we can avoid
-		// explicitly listing all the links as an optimisation.
-		objectSet = nullptr;
+		auto objectSet = std::make_shared<IECoreScenePreview::Renderer::ObjectSet>();
+		for( PathMatcher::Iterator it = lightLink.paths.begin(), eIt = lightLink.paths.end(); it != eIt; ++it )
+		{
+			std::string pathString;
+			ScenePlug::pathToString( *it, pathString );
+			LightMap::const_accessor a;
+			if( m_lights.find( a, pathString ) )
+			{
+				objectSet->insert( a->second );
+			}
+		}
+		if( objectSet->size() == m_lights.size() )
+		{
+			// All lights are linked, in which case we can avoid
+			// explicitly listing all the links as an optimisation.
+			objectSet = nullptr;
+		}
+
+		const bool lightsChanged = objectSet && lightLink.lights ? *objectSet != *lightLink.lights : objectSet != lightLink.lights;
+		if( lightsChanged || !lightLink.version )
+		{
+			lightLink.lights = objectSet;
+			lightLink.version++;
+		}
+		lightLink.lightsGeneration = lightsGeneration;
 	}
 
-	a->second = objectSet;
-	return a->second;
+	version = lightLink.version;
+	return lightLink.lights;
 }
 
 void LightLinks::outputLightFilterLinks( const ScenePlug *scene )
@@ -888,7 +982,7 @@ struct LocationOutput
 {
 
 	LocationOutput( IECoreScenePreview::Renderer *renderer, const IECore::CompoundObject *globals, const GafferScene::RendererAlgo::RenderSets &renderSets, const ScenePlug::ScenePath &root, const ScenePlug *scene )
-		:	m_renderer( renderer ), m_attributes( SceneAlgo::globalAttributes( globals ) ), m_renderSets( renderSets ), m_root( root )
+		:	m_renderer( renderer ), m_globals( globals ), m_attributes( SceneAlgo::globalAttributes( globals ) ), m_renderSets( renderSets ), m_root( root )
 	{
 		const BoolData *transformBlurData = globals->member<BoolData>( g_transformBlurOptionName );
 		m_options.transformBlur = transformBlurData ? transformBlurData->readable() : false;
@@ -990,6 +1084,143 @@ struct LocationOutput
 			}
 		}
 
+		void outputCamera( const ScenePlug *scene, const ScenePlug::ScenePath &path )
+		{
+			// Sample cameras and apply globals
+
+			vector<ConstObjectPtr> samples; vector<float> sampleTimes;
+			RendererAlgo::objectSamples( scene, deformationSegments(), shutter(), samples, sampleTimes );
+
+			vector<ConstCameraPtr> cameraSamples; cameraSamples.reserve( samples.size() );
+			for( const auto &sample : samples )
+			{
+				if( auto cameraSample = runTimeCast<const Camera>( sample.get() ) )
+				{
+					IECoreScene::CameraPtr cameraSampleCopy = cameraSample->copy();
+					GafferScene::RendererAlgo::applyCameraGlobals( cameraSampleCopy.get(), m_globals, scene );
+					cameraSamples.push_back( cameraSampleCopy );
+				}
+			}
+
+			// Create ObjectInterface
+
+			if( !samples.size() || cameraSamples.size() != samples.size() )
+			{
+				IECore::msg(
+					IECore::Msg::Warning,
+					"RendererAlgo::CameraOutput",
+					boost::format( "Camera missing for location \"%1%\" at frame %2%" )
+						% name( path )
+						% Context::current()->getFrame()
+				);
+				return;
+			}
+
+			IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface;
+			if( !sampleTimes.size() )
+			{
+				objectInterface = m_renderer->camera(
+					name( path ),
+					cameraSamples[0].get(),
+					attributesInterface().get()
+				);
+			}
+			else
+			{
+				vector<const Camera *> rawCameraSamples; rawCameraSamples.reserve( cameraSamples.size() );
+				for( auto &c : cameraSamples )
+				{
+					rawCameraSamples.push_back( c.get() );
+				}
+				objectInterface = m_renderer->camera(
+					name( path ),
+					rawCameraSamples,
+					sampleTimes,
+					attributesInterface().get()
+				);
+			}
+
+			if( objectInterface )
+			{
+				applyTransform( objectInterface.get() );
+			}
+		}
+
+		void outputLight( const ScenePlug *scene, const ScenePlug::ScenePath &path, GafferScene::RendererAlgo::LightLinks *lightLinks )
+		{
+			IECore::ConstObjectPtr object = scene->objectPlug()->getValue();
+
+			const std::string name = this->name( path );
+			IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface = m_renderer->light(
+				name,
+				!runTimeCast<const NullObject>( object.get() ) ? object.get() : nullptr,
+				attributesInterface().get()
+			);
+
+			if( objectInterface )
+			{
+				applyTransform( objectInterface.get() );
+				if( lightLinks )
+				{
+					lightLinks->addLight( name, objectInterface );
+				}
+			}
+		}
+
+		void outputLightFilter( const ScenePlug *scene, const ScenePlug::ScenePath &path, GafferScene::RendererAlgo::LightLinks *lightLinks )
+		{
+			IECore::ConstObjectPtr object = scene->objectPlug()->getValue();
+
+			IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface = m_renderer->lightFilter(
+				name( path ),
+				!runTimeCast<const NullObject>( object.get() ) ? object.get() : nullptr,
+				attributesInterface().get()
+			);
+
+			if( objectInterface )
+			{
+				applyTransform( objectInterface.get() );
+				if( lightLinks )
+				{
+					lightLinks->addLightFilter( objectInterface, attributes() );
+				}
+			}
+		}
+
+		IECoreScenePreview::Renderer::ObjectInterfacePtr outputObject( const ScenePlug *scene, const ScenePlug::ScenePath &path )
+		{
+			vector<ConstObjectPtr> samples; vector<float> sampleTimes;
+			RendererAlgo::objectSamples( scene, deformationSegments(), shutter(), samples, sampleTimes );
+			if( !samples.size() )
+			{
+				return nullptr;
+			}
+
+			IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface;
+			IECoreScenePreview::Renderer::AttributesInterfacePtr attributesInterface = this->attributesInterface();
+			if( !sampleTimes.size() )
+			{
+				objectInterface = m_renderer->object( name( path ), samples[0].get(), attributesInterface.get() );
+			}
+			else
+			{
+				/// \todo Can we rejig things so this conversion isn't necessary?
+				vector<const Object *> objectsVector; objectsVector.reserve( samples.size() );
+				for( const auto &sample : samples )
+				{
+					objectsVector.push_back( sample.get() );
+				}
+				objectInterface = m_renderer->object( name( path ), objectsVector, sampleTimes, attributesInterface.get() );
+			}
+
+			if( objectInterface )
+			{
+				applyTransform( objectInterface.get() );
+			}
+
+			return objectInterface;
+		}
+
 	private :
 
 		size_t motionSegments( bool motionBlur, const InternedString &attributeName, const InternedString &segmentsAttributeName ) const
@@ -1099,6 +1330,7 @@ struct LocationOutput
 		}
 
 		IECoreScenePreview::Renderer *m_renderer;
+		const IECore::CompoundObject *m_globals;
 
 		struct Options
 		{
@@ -1121,7 +1353,7 @@ struct CameraOutput : public LocationOutput
 {
 
 	CameraOutput( IECoreScenePreview::Renderer *renderer, const IECore::CompoundObject *globals, const GafferScene::RendererAlgo::RenderSets &renderSets, const ScenePlug::ScenePath &root, const ScenePlug *scene )
-		:	LocationOutput( renderer, globals, renderSets, root, scene ), m_globals( globals ), m_cameraSet( renderSets.camerasSet() )
+		:	LocationOutput( renderer, globals, renderSets, root, scene ), m_cameraSet( renderSets.camerasSet() )
 	{
 	}
 
@@ -1135,65 +1367,7 @@ struct CameraOutput : public LocationOutput
 		const size_t cameraMatch = m_cameraSet.match( path );
 		if( cameraMatch & IECore::PathMatcher::ExactMatch )
 		{
-			// Sample cameras and apply globals
-
-			vector<ConstObjectPtr> samples; vector<float> sampleTimes;
-			RendererAlgo::objectSamples( scene, deformationSegments(), shutter(), samples, sampleTimes );
-
-			vector<ConstCameraPtr> cameraSamples; cameraSamples.reserve( samples.size() );
-			for( const auto &sample : samples )
-			{
-				if( auto cameraSample = runTimeCast<const Camera>( sample.get() ) )
-				{
-					IECoreScene::CameraPtr cameraSampleCopy = cameraSample->copy();
-					GafferScene::RendererAlgo::applyCameraGlobals( cameraSampleCopy.get(), m_globals, scene );
-					cameraSamples.push_back( cameraSampleCopy );
-				}
-			}
-
-			// Create ObjectInterface
-
-			if( !samples.size() || cameraSamples.size() != samples.size() )
-			{
-				IECore::msg(
-					IECore::Msg::Warning,
-					"RendererAlgo::CameraOutput",
-					boost::format( "Camera missing for location \"%1%\" at frame %2%" )
-						% name( path )
-						% Context::current()->getFrame()
-				);
-			}
-			else
-			{
-				IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface;
-				if( !sampleTimes.size() )
-				{
-					objectInterface = renderer()->camera(
-						name( path ),
-						cameraSamples[0].get(),
-						attributesInterface().get()
-					);
-				}
-				else
-				{
-					vector<const Camera *> rawCameraSamples; rawCameraSamples.reserve( cameraSamples.size() );
-					for( auto &c : cameraSamples )
-					{
-						rawCameraSamples.push_back( c.get() );
-					}
-					objectInterface = renderer()->camera(
-						name( path ),
-						rawCameraSamples,
-						sampleTimes,
-						attributesInterface().get()
-					);
-				}
-
-				if( objectInterface )
-				{
-					applyTransform( objectInterface.get() );
-				}
-			}
+			outputCamera( scene, path );
 		}
 
 		return cameraMatch & IECore::PathMatcher::DescendantMatch;
@@ -1201,7 +1375,6 @@ struct CameraOutput : public LocationOutput
 
 	private :
 
-		const IECore::CompoundObject *m_globals;
 		const PathMatcher &m_cameraSet;
 
 };
@@ -1224,24 +1397,7 @@ struct LightOutput : public LocationOutput
 		const size_t lightMatch = m_lightSet.match( path );
 		if( lightMatch & IECore::PathMatcher::ExactMatch )
 		{
-			IECore::ConstObjectPtr object = scene->objectPlug()->getValue();
-
-			const std::string name = this->name( path );
-			IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface = renderer()->light(
-				name,
-				!runTimeCast<const NullObject>( object.get() ) ? object.get() : nullptr,
-				attributesInterface().get()
-			);
-
-			if( objectInterface )
-			{
-				applyTransform( objectInterface.get() );
-				if( m_lightLinks )
-				{
-					m_lightLinks->addLight( name, objectInterface );
-				}
-			}
-
+			outputLight( scene, path, m_lightLinks );
 		}
 
 		return lightMatch & IECore::PathMatcher::DescendantMatch;
@@ -1270,22 +1426,7 @@ struct LightFiltersOutput : public LocationOutput
 		const size_t lightFilterMatch = m_lightFiltersSet.match( path );
 		if( lightFilterMatch & IECore::PathMatcher::ExactMatch )
 		{
-			IECore::ConstObjectPtr object = scene->objectPlug()->getValue();
-
-			IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface = renderer()->lightFilter(
-				name( path ),
-				!runTimeCast<const NullObject>( object.get() ) ? object.get() : nullptr,
-				attributesInterface().get()
-			);
-
-			if( objectInterface )
-			{
-				applyTransform( objectInterface.get() );
-				if( m_lightLinks )
-				{
-					m_lightLinks->addLightFilter( objectInterface, attributes() );
-				}
-			}
+			outputLightFilter( scene, path, m_lightLinks );
 		}
 
 		return lightFilterMatch & IECore::PathMatcher::DescendantMatch;
@@ -1318,49 +1459,135 @@ struct ObjectOutput : public LocationOutput
 			return true;
 		}
 
-		vector<ConstObjectPtr> samples; vector<float> sampleTimes;
-		RendererAlgo::objectSamples( scene, deformationSegments(), shutter(), samples, sampleTimes );
-		if( !samples.size() )
+		IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface = outputObject( scene, path );
+		if( objectInterface && m_lightLinks )
 		{
-			return true;
+			m_lightLinks->outputLightLinks( scene, attributes(), objectInterface.get() );
 		}
 
-		IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface;
-		IECoreScenePreview::Renderer::AttributesInterfacePtr attributesInterface = this->attributesInterface();
-		if( !sampleTimes.size() )
+		return true;
+	}
+
+	const PathMatcher &m_cameraSet;
+	const PathMatcher &m_lightSet;
+	const PathMatcher &m_lightFiltersSet;
+	const RendererAlgo::LightLinks *m_lightLinks;
+
+};
+
+// An object whose light links must be output once all lights
+// have been registered with LightLinks. We store only the attributes
+// that `LightLinks::outputLightLinks()` uses, rather than the full
+// attributes for every object in the scene.
+struct DeferredLightLink
+{
+	IECoreScenePreview::Renderer::ObjectInterfacePtr object;
+	ConstStringDataPtr linkedLights;
+	ConstStringDataPtr shadowGroup;
+};
+
+using DeferredLightLinks = tbb::concurrent_vector<DeferredLightLink>;
+
+// Outputs cameras, lights, light filters and objects in a single
+// traversal, so that attributes and transforms are only computed
+// once per location. Because lights may be output after the objects
+// that are linked to them, light links are not output here. Instead
+// they are accumulated in `deferredLightLinks` for output after the
+// traversal is complete.
+struct SceneOutput : public LocationOutput
+{
+
+	SceneOutput( IECoreScenePreview::Renderer *renderer, const IECore::CompoundObject *globals, const GafferScene::RendererAlgo::RenderSets &renderSets, GafferScene::RendererAlgo::LightLinks *lightLinks, DeferredLightLinks *deferredLightLinks, const ScenePlug::ScenePath &root, const ScenePlug *scene )
+		:	LocationOutput( renderer, globals, renderSets, root, scene ),
+			m_cameraSet( renderSets.camerasSet() ), m_lightSet( renderSets.lightsSet() ), m_lightFiltersSet( renderSets.lightFiltersSet() ),
+			m_lightLinks( lightLinks ), m_deferredLightLinks( deferredLightLinks )
+	{
+	}
+
+	bool operator()( const ScenePlug *scene, const ScenePlug::ScenePath &path )
+	{
+		if( !LocationOutput::operator()( scene, path ) )
 		{
-			objectInterface = renderer()->object( name( path ), samples[0].get(), attributesInterface.get() );
+			return false;
 		}
-		else
+
+		bool special = false;
+		if( m_cameraSet.match( path ) & IECore::PathMatcher::ExactMatch )
 		{
-			/// \todo Can we rejig things so this conversion isn't necessary?
-			vector<const Object *> objectsVector; objectsVector.reserve( samples.size() );
-			for( const auto &sample : samples )
-			{
-				objectsVector.push_back( sample.get() );
-			}
-			objectInterface = renderer()->object( name( path ), objectsVector, sampleTimes, attributesInterface.get() );
+			outputCamera( scene, path );
+			special = true;
+		}
+		if( m_lightSet.match( path ) & IECore::PathMatcher::ExactMatch )
+		{
+			outputLight( scene, path, m_lightLinks );
+			special = true;
+		}
+		if( m_lightFiltersSet.match( path ) & IECore::PathMatcher::ExactMatch )
+		{
+			outputLightFilter( scene, path, m_lightLinks );
+			special = true;
 		}
 
-		if( objectInterface )
+		if( !special )
 		{
-			applyTransform( objectInterface.get() );
-			if( m_lightLinks )
+			IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface = outputObject( scene, path );
+			if( objectInterface && m_lightLinks )
 			{
-				m_lightLinks->outputLightLinks( scene, attributes(), objectInterface.get() );
+				const CompoundObject *a = attributes();
+				m_deferredLightLinks->push_back( {
+					objectInterface,
+					a->member<StringData>( g_linkedLightsAttributeName ),
+					a->member<StringData>( g_shadowGroupAttributeName )
+				} );
 			}
 		}
 
 		return true;
 	}
 
-	const PathMatcher &m_cameraSet;
-	const PathMatcher &m_lightSet;
-	const PathMatcher &m_lightFiltersSet;
-	const RendererAlgo::LightLinks *m_lightLinks;
+	private :
+
+		const PathMatcher &m_cameraSet;
+		const PathMatcher &m_lightSet;
+		const PathMatcher &m_lightFiltersSet;
+		GafferScene::RendererAlgo::LightLinks *m_lightLinks;
+		DeferredLightLinks *m_deferredLightLinks;
 
 };
 
+// Throws if the camera option refers to a camera that won't be output.
+// Returns true if a camera has been specified by the globals.
+bool validateCameraOption( const ScenePlug *scene, const IECore::CompoundObject *globals, const GafferScene::RendererAlgo::RenderSets &renderSets )
+{
+	const StringData *cameraOption = globals->member<StringData>( g_cameraOptionLegacyName );
+	if( !cameraOption || cameraOption->readable().empty() )
+	{
+		return false;
+	}
+
+	ScenePlug::ScenePath cameraPath; ScenePlug::stringToPath( cameraOption->readable(), cameraPath );
+	if( !scene->exists( cameraPath ) )
+	{
+		throw IECore::Exception( "Camera \"" + cameraOption->readable() + "\" does not exist" );
+	}
+	if( !( renderSets.camerasSet().match( cameraPath ) & IECore::PathMatcher::ExactMatch ) )
+	{
+		throw IECore::Exception( "Camera \"" + cameraOption->readable() + "\" is not in the camera set" );
+	}
+
+	return true;
+}
+
+void outputDefaultCamera( const ScenePlug *scene, const IECore::CompoundObject *globals, IECoreScenePreview::Renderer *renderer )
+{
+	CameraPtr defaultCamera = new IECoreScene::Camera;
+	GafferScene::RendererAlgo::applyCameraGlobals( defaultCamera.get(), globals, scene );
+	IECoreScenePreview::Renderer::AttributesInterfacePtr defaultAttributes = renderer->attributes( scene->attributesPlug()->defaultValue() );
+	ConstStringDataPtr name = new StringData( "gaffer:defaultCamera" );
+	renderer->camera( name->readable(), defaultCamera.get(), defaultAttributes.get() );
+	renderer->option( "camera", name.get() );
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -1553,32 +1780,15 @@ void outputOutputs( const ScenePlug *scene, const IECore::CompoundObject *global
 
 void outputCameras( const ScenePlug *scene, const IECore::CompoundObject *globals, const RenderSets &renderSets, IECoreScenePreview::Renderer *renderer )
 {
-	const StringData *cameraOption = globals->member<StringData>( g_cameraOptionLegacyName );
-	if( cameraOption && !cameraOption->readable().empty() )
-	{
-		ScenePlug::ScenePath cameraPath; ScenePlug::stringToPath( cameraOption->readable(), cameraPath );
-		if( !scene->exists( cameraPath ) )
-		{
-			throw IECore::Exception( "Camera \"" + cameraOption->readable() + "\" does not exist" );
-		}
-		if( !( renderSets.camerasSet().match( cameraPath ) & IECore::PathMatcher::ExactMatch ) )
-		{
-			throw IECore::Exception( "Camera \"" + cameraOption->readable() + "\" is not in the camera set" );
-		}
-	}
+	const bool haveCameraOption = validateCameraOption( scene, globals, renderSets );
 
 	const ScenePlug::ScenePath root;
 	CameraOutput output( renderer, globals, renderSets, root, scene );
 	SceneAlgo::parallelProcessLocations( scene, output );
 
-	if( !cameraOption || cameraOption->readable().empty() )
+	if( !haveCameraOption )
 	{
-		CameraPtr defaultCamera = new IECoreScene::Camera;
-		RendererAlgo::applyCameraGlobals( defaultCamera.get(), globals, scene );
-		IECoreScenePreview::Renderer::AttributesInterfacePtr defaultAttributes = renderer->attributes( scene->attributesPlug()->defaultValue() );
-		ConstStringDataPtr name = new StringData( "gaffer:defaultCamera" );
-		renderer->camera( name->readable(), defaultCamera.get(), defaultAttributes.get() );
-		renderer->option( "camera", name.get() );
+		outputDefaultCamera( scene, globals, renderer );
 	}
 }
 
@@ -1602,6 +1812,52 @@ void outputObjects( const ScenePlug *scene, const IECore::CompoundObject *global
 	SceneAlgo::parallelProcessLocations( scene, output, root );
 }
 
+void outputScene( const ScenePlug *scene, const IECore::CompoundObject *globals, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer )
+{
+	const bool haveCameraOption = validateCameraOption( scene, globals, renderSets );
+
+	DeferredLightLinks deferredLightLinks;
+	const ScenePlug::ScenePath root;
+	SceneOutput output( renderer, globals, renderSets, lightLinks, &deferredLightLinks, root, scene );
+	SceneAlgo::parallelProcessLocations( scene, output );
+
+	if( lightLinks )
+	{
+		lightLinks->outputLightFilterLinks( scene );
+
+		const ThreadState &threadState = ThreadState::current();
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+		tbb::parallel_for(
+			tbb::blocked_range<size_t>( 0, deferredLightLinks.size() ),
+			[&]( const tbb::blocked_range<size_t> &range )
+			{
+				ThreadState::Scope threadStateScope( threadState );
+				CompoundObjectPtr attributes = new CompoundObject;
+				for( size_t i = range.begin(); i != range.end(); ++i )
+				{
+					const DeferredLightLink &link = deferredLightLinks[i];
+					attributes->members().clear();
+					if( link.linkedLights )
+					{
+						attributes->members()[g_linkedLightsAttributeName] = boost::const_pointer_cast<StringData>( link.linkedLights );
+					}
+					if( link.shadowGroup )
+					{
+						attributes->members()[g_shadowGroupAttributeName] = boost::const_pointer_cast<StringData>( link.shadowGroup );
+					}
+					lightLinks->outputLightLinks( scene, attributes.get(), link.object.get() );
+				}
+			},
+			taskGroupContext
+		);
+	}
+
+	if( !haveCameraOption )
+	{
+		outputDefaultCamera( scene, globals, renderer );
+	}
+}
+
 void applyCameraGlobals( IECoreScene::Camera *camera, const IECore::CompoundObject *globals, const ScenePlug *scene )
 {
 	// Set any camera-relevant render globals that haven't been overridden on the camera
@@ -58,19 +58,27 @@
 #include "IECoreScene/ClippingPlane.h"
 #include "IECoreScene/CoordinateSystem.h"
 #include "IECoreScene/MatrixMotionTransform.h"
+#include "IECoreScene/MeshAlgo.h"
+#include "IECoreScene/MeshPrimitive.h"
+#include "IECoreScene/PrimitiveEvaluator.h"
 #include "IECoreScene/VisibleRenderable.h"
 
 #include "IECore/MessageHandler.h"
 #include "IECore/NullObject.h"
 
+#include "OpenEXR/ImathBoxAlgo.h"
+
 #include "boost/algorithm/string/predicate.hpp"
 #include "boost/unordered_map.hpp"
 
+#include "tbb/blocked_range.h"
 #include "tbb/concurrent_unordered_set.h"
 #include "tbb/parallel_for.h"
 #include "tbb/spin_mutex.h"
 #include "tbb/task.h"
 
+#include <unordered_set>
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -983,6 +991,602 @@ IECore::PathMatcher GafferScene::SceneAlgo::linkedLights( const ScenePlug *scene
 	return result.intersection( scene->set( g_lights )->readable() );
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Spatial queries
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+struct PrimitiveEvaluatorCacheKey
+{
+
+	PrimitiveEvaluatorCacheKey( const IECore::MurmurHash &hash, const Primitive *primitive )
+		:	hash( hash ), primitive( primitive )
+	{
+	}
+
+	operator const IECore::MurmurHash &() const
+	{
+		return hash;
+	}
+
+	const IECore::MurmurHash hash;
+	const Primitive *primitive;
+
+};
+
+// PrimitiveEvaluators don't report their memory usage, so we estimate it.
+// As well as the primitive itself, they hold acceleration structures with
+// a bound and an index for each element they search. The MeshPrimitiveEvaluator
+// builds separate structures for positions and UVs.
+size_t evaluatorMemoryUsage( const PrimitiveEvaluator *evaluator )
+{
+	const Primitive *primitive = evaluator->primitive().get();
+	size_t numElements;
+	if( runTimeCast<const MeshPrimitive>( primitive ) )
+	{
+		numElements = 2 * primitive->variableSize( PrimitiveVariable::Uniform );
+	}
+	else
+	{
+		numElements = primitive->variableSize( PrimitiveVariable::Vertex );
+	}
+
+	return primitive->memoryUsage() + numElements * ( sizeof( Box3f ) + sizeof( size_t ) );
+}
+
+ConstPrimitiveEvaluatorPtr primitiveEvaluatorGetter( const PrimitiveEvaluatorCacheKey &key, size_t &cost )
+{
+	ConstPrimitivePtr primitive = key.primitive;
+	if( auto mesh = runTimeCast<const MeshPrimitive>( primitive.get() ) )
+	{
+		primitive = MeshAlgo::triangulate( mesh );
+	}
+	ConstPrimitiveEvaluatorPtr result = PrimitiveEvaluator::create( primitive );
+	cost = result ? evaluatorMemoryUsage( result.get() ) : primitive->memoryUsage();
+	return result;
+}
+
+using PrimitiveEvaluatorCache = IECorePreview::LRUCache<IECore::MurmurHash, ConstPrimitiveEvaluatorPtr, IECorePreview::LRUCachePolicy::TaskParallel, PrimitiveEvaluatorCacheKey>;
+
+PrimitiveEvaluatorCache &primitiveEvaluatorCache()
+{
+	static PrimitiveEvaluatorCache *c = new PrimitiveEvaluatorCache( primitiveEvaluatorGetter, 1024 * 1024 * 1024, PrimitiveEvaluatorCache::RemovalCallback(), /* cacheErrors = */ false );
+	return *c;
+}
+
+// Returns the parametric distance along the ray at which it enters the
+// box, or infinity if it misses.
+float rayBoxIntersection( const Box3f &box, const V3f &origin, const V3f &inverseDirection, float maxDistance )
+{
+	float tMin = 0.0f;
+	float tMax = maxDistance;
+	for( int i = 0; i < 3; ++i )
+	{
+		float t0 = ( box.min[i] - origin[i] ) * inverseDirection[i];
+		float t1 = ( box.max[i] - origin[i] ) * inverseDirection[i];
+		if( t0 > t1 )
+		{
+			std::swap( t0, t1 );
+		}
+		tMin = std::max( tMin, t0 );
+		tMax = std::min( tMax, t1 );
+		if( tMin > tMax )
+		{
+			return std::numeric_limits<float>::infinity();
+		}
+	}
+	return tMin;
+}
+
+float pointBoxDistance( const Box3f &box, const V3f &point )
+{
+	return ( closestPointInBox( point, box ) - point ).length();
+}
+
+bool boxOutsidePlane( const Box3f &box, const Plane3f &plane )
+{
+	// Test the corner furthest along the plane normal.
+	const V3f corner(
+		plane.normal.x > 0 ? box.max.x : box.min.x,
+		plane.normal.y > 0 ? box.max.y : box.min.y,
+		plane.normal.z > 0 ? box.max.z : box.min.z
+	);
+	return plane.distanceTo( corner ) < 0.0f;
+}
+
+bool boxOutsidePlanes( const Box3f &box, const std::vector<Plane3f> &planes )
+{
+	for( const auto &plane : planes )
+	{
+		if( boxOutsidePlane( box, plane ) )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+const size_t g_maxLeafSize = 4;
+
+} // namespace
+
+// A bounding volume hierarchy over the world space bounds of
+// each location, with primitive level queries delegated to the
+// PrimitiveEvaluator for each object.
+class SceneAlgo::SpatialIndex::Implementation
+{
+
+	public :
+
+		Implementation( const ScenePlug *scene, const std::vector<ScenePlug::ScenePath> &paths )
+		{
+			m_entries.resize( paths.size() );
+
+			const ThreadState &threadState = ThreadState::current();
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, paths.size() ),
+				[&] ( const tbb::blocked_range<size_t> &range ) {
+					ThreadState::Scope threadStateScope( threadState );
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						Entry &entry = m_entries[i];
+						entry.path = paths[i];
+						entry.transform = scene->fullTransform( entry.path );
+						entry.inverseTransform = entry.transform.inverse();
+						ConstObjectPtr object = scene->object( entry.path );
+						entry.bound = transform( SceneAlgo::bound( object.get() ), entry.transform );
+						if( auto primitive = runTimeCast<const Primitive>( object.get() ) )
+						{
+							entry.evaluator = primitiveEvaluatorCache().get(
+								PrimitiveEvaluatorCacheKey( scene->objectHash( entry.path ), primitive )
+							);
+						}
+					}
+				},
+				taskGroupContext
+			);
+
+			m_entries.erase(
+				std::remove_if( m_entries.begin(), m_entries.end(), [] ( const Entry &e ) { return e.bound.isEmpty(); } ),
+				m_entries.end()
+			);
+
+			if( m_entries.size() )
+			{
+				m_nodes.reserve( 2 * ( m_entries.size() / g_maxLeafSize + 1 ) );
+				build( 0, m_entries.size() );
+			}
+
+			// Include the evaluators we reference, since we keep them
+			// alive even if they are evicted from their own cache.
+			// Instances may share an evaluator, so we count each only once.
+			m_memoryUsage = sizeof( *this ) + m_entries.capacity() * sizeof( Entry ) + m_nodes.capacity() * sizeof( Node );
+			std::unordered_set<const PrimitiveEvaluator *> evaluators;
+			for( const auto &entry : m_entries )
+			{
+				m_memoryUsage += entry.path.capacity() * sizeof( InternedString );
+				if( entry.evaluator && evaluators.insert( entry.evaluator.get() ).second )
+				{
+					m_memoryUsage += evaluatorMemoryUsage( entry.evaluator.get() );
+				}
+			}
+		}
+
+		size_t memoryUsage() const
+		{
+			return m_memoryUsage;
+		}
+
+		Box3f bound() const
+		{
+			return m_nodes.size() ? m_nodes[0].bound : Box3f();
+		}
+
+		bool rayCast( const V3f &origin, const V3f &direction, ScenePlug::ScenePath &hitPath, V3f &hitPoint, float maxDistance ) const
+		{
+			if( m_nodes.empty() || direction.length() == 0.0f )
+			{
+				return false;
+			}
+
+			const V3f normalizedDirection = direction.normalized();
+			const V3f inverseDirection( 1.0f / normalizedDirection.x, 1.0f / normalizedDirection.y, 1.0f / normalizedDirection.z );
+
+			float closestDistance = maxDistance;
+			const Entry *closestEntry = nullptr;
+
+			std::vector<size_t> stack = { 0 };
+			while( stack.size() )
+			{
+				const Node &node = m_nodes[stack.back()];
+				stack.pop_back();
+				if( rayBoxIntersection( node.bound, origin, inverseDirection, closestDistance ) > closestDistance )
+				{
+					continue;
+				}
+
+				if( !node.leaf() )
+				{
+					stack.push_back( node.right );
+					stack.push_back( node.left );
+					continue;
+				}
+
+				for( size_t i = node.begin; i != node.end; ++i )
+				{
+					const Entry &entry = m_entries[i];
+					if( !entry.evaluator || rayBoxIntersection( entry.bound, origin, inverseDirection, closestDistance ) > closestDistance )
+					{
+						continue;
+					}
+
+					// Intersect in object space, taking into account the
+					// effect of any scaling on the distance.
+					const V3f objectOrigin = origin * entry.inverseTransform;
+					V3f objectDirection;
+					entry.inverseTransform.multDirMatrix( normalizedDirection, objectDirection );
+					const float scale = objectDirection.length();
+					if( scale == 0.0f )
+					{
+						continue;
+					}
+					objectDirection /= scale;
+
+					PrimitiveEvaluator::ResultPtr result = entry.evaluator->createResult();
+					if( entry.evaluator->intersectionPoint( objectOrigin, objectDirection, result.get(), closestDistance * scale ) )
+					{
+						const V3f p = result->point() * entry.transform;
+						const float distance = ( p - origin ).length();
+						if( distance <= closestDistance )
+						{
+							closestDistance = distance;
+							closestEntry = &entry;
+							hitPoint = p;
+						}
+					}
+				}
+			}
+
+			if( closestEntry )
+			{
+				hitPath = closestEntry->path;
+				return true;
+			}
+			return false;
+		}
+
+		bool closestPoint( const V3f &point, ScenePlug::ScenePath &closestPath, V3f &closestPoint, float maxDistance ) const
+		{
+			if( m_nodes.empty() )
+			{
+				return false;
+			}
+
+			float closestDistance = maxDistance;
+			const Entry *closestEntry = nullptr;
+
+			std::vector<size_t> stack = { 0 };
+			while( stack.size() )
+			{
+				const Node &node = m_nodes[stack.back()];
+				stack.pop_back();
+				if( pointBoxDistance( node.bound, point ) > closestDistance )
+				{
+					continue;
+				}
+
+				if( !node.leaf() )
+				{
+					// Visit the nearest child first, so that we
+					// can prune more of the other.
+					const bool leftNearest = pointBoxDistance( m_nodes[node.left].bound, point ) < pointBoxDistance( m_nodes[node.right].bound, point );
+					stack.push_back( leftNearest ? node.right : node.left );
+					stack.push_back( leftNearest ? node.left : node.right );
+					continue;
+				}
+
+				for( size_t i = node.begin; i != node.end; ++i )
+				{
+					const Entry &entry = m_entries[i];
+					if( !entry.evaluator || pointBoxDistance( entry.bound, point ) > closestDistance )
+					{
+						continue;
+					}
+
+					PrimitiveEvaluator::ResultPtr result = entry.evaluator->createResult();
+					if( entry.evaluator->closestPoint( point * entry.inverseTransform, result.get() ) )
+					{
+						const V3f p = result->point() * entry.transform;
+						const float distance = ( p - point ).length();
+						if( distance <= closestDistance )
+						{
+							closestDistance = distance;
+							closestEntry = &entry;
+							closestPoint = p;
+						}
+					}
+				}
+			}
+
+			if( closestEntry )
+			{
+				closestPath = closestEntry->path;
+				return true;
+			}
+			return false;
+		}
+
+		PathMatcher frustumQuery( const std::vector<Plane3f> &planes ) const
+		{
+			PathMatcher result;
+			if( m_nodes.empty() )
+			{
+				return result;
+			}
+
+			std::vector<size_t> stack = { 0 };
+			while( stack.size() )
+			{
+				const Node &node = m_nodes[stack.back()];
+				stack.pop_back();
+				if( boxOutsidePlanes( node.bound, planes ) )
+				{
+					continue;
+				}
+
+				if( !node.leaf() )
+				{
+					stack.push_back( node.right );
+					stack.push_back( node.left );
+					continue;
+				}
+
+				for( size_t i = node.begin; i != node.end; ++i )
+				{
+					if( !boxOutsidePlanes( m_entries[i].bound, planes ) )
+					{
+						result.addPath( m_entries[i].path );
+					}
+				}
+			}
+
+			return result;
+		}
+
+	private :
+
+		struct Entry
+		{
+			ScenePlug::ScenePath path;
+			M44f transform;
+			M44f inverseTransform;
+			Box3f bound; // In world space
+			ConstPrimitiveEvaluatorPtr evaluator;
+		};
+
+		struct Node
+		{
+			bool leaf() const
+			{
+				return left == 0;
+			}
+
+			Box3f bound;
+			// Range of entries for leaf nodes.
+			size_t begin = 0;
+			size_t end = 0;
+			// Children for internal nodes. The root can
+			// never be a child, so 0 denotes a leaf.
+			size_t left = 0;
+			size_t right = 0;
+		};
+
+		// Builds a node for the entries in the specified range,
+		// returning its index.
+		size_t build( size_t begin, size_t end )
+		{
+			const size_t index = m_nodes.size();
+			m_nodes.push_back( Node() );
+
+			Box3f bound;
+			Box3f centerBound;
+			for( size_t i = begin; i != end; ++i )
+			{
+				bound.extendBy( m_entries[i].bound );
+				centerBound.extendBy( m_entries[i].bound.center() );
+			}
+			m_nodes[index].bound = bound;
+
+			if( end - begin <= g_maxLeafSize )
+			{
+				m_nodes[index].begin = begin;
+				m_nodes[index].end = end;
+				return index;
+			}
+
+			// Split at the median along the axis in which
+			// the entries are most spread out.
+			const int axis = centerBound.majorAxis();
+			const size_t middle = ( begin + end ) / 2;
+			std::nth_element(
+				m_entries.begin() + begin, m_entries.begin() + middle, m_entries.begin() + end,
+				[axis] ( const Entry &a, const Entry &b ) {
+					return a.bound.center()[axis] < b.bound.center()[axis];
+				}
+			);
+
+			const size_t left = build( begin, middle );
+			const size_t right = build( middle, end );
+			m_nodes[index].left = left;
+			m_nodes[index].right = right;
+			return index;
+		}
+
+		std::vector<Entry> m_entries;
+		std::vector<Node> m_nodes;
+		size_t m_memoryUsage;
+
+};
+
+SceneAlgo::SpatialIndex::SpatialIndex( const ScenePlug *scene, const std::vector<ScenePlug::ScenePath> &paths )
+	:	m_implementation( new Implementation( scene, paths ) )
+{
+}
+
+SceneAlgo::SpatialIndex::~SpatialIndex()
+{
+}
+
+size_t SceneAlgo::SpatialIndex::memoryUsage() const
+{
+	return m_implementation->memoryUsage();
+}
+
+Imath::Box3f SceneAlgo::SpatialIndex::bound() const
+{
+	return m_implementation->bound();
+}
+
+bool SceneAlgo::SpatialIndex::rayCast( const Imath::V3f &origin, const Imath::V3f &direction, ScenePlug::ScenePath &hitPath, Imath::V3f &hitPoint, float maxDistance ) const
+{
+	return m_implementation->rayCast( origin, direction, hitPath, hitPoint, maxDistance );
+}
+
+bool SceneAlgo::SpatialIndex::closestPoint( const Imath::V3f &point, ScenePlug::ScenePath &closestPath, Imath::V3f &closestPoint, float maxDistance ) const
+{
+	return m_implementation->closestPoint( point, closestPath, closestPoint, maxDistance );
+}
+
+IECore::PathMatcher SceneAlgo::SpatialIndex::frustumQuery( const std::vector<Imath::Plane3f> &planes ) const
+{
+	return m_implementation->frustumQuery( planes );
+}
+
+namespace
+{
+
+struct SpatialIndexCacheKey
+{
+
+	SpatialIndexCacheKey( const IECore::MurmurHash &hash, const ScenePlug *scene, const std::vector<ScenePlug::ScenePath> &paths )
+		:	hash( hash ), scene( scene ), paths( paths )
+	{
+	}
+
+	operator const IECore::MurmurHash &() const
+	{
+		return hash;
+	}
+
+	const IECore::MurmurHash hash;
+	const ScenePlug *scene;
+	const std::vector<ScenePlug::ScenePath> &paths;
+
+};
+
+SceneAlgo::ConstSpatialIndexPtr spatialIndexGetter( const SpatialIndexCacheKey &key, size_t &cost )
+{
+	SceneAlgo::ConstSpatialIndexPtr result = new SceneAlgo::SpatialIndex( key.scene, key.paths );
+	cost = result->memoryUsage();
+	return result;
+}
+
+using SpatialIndexCache = IECorePreview::LRUCache<IECore::MurmurHash, SceneAlgo::ConstSpatialIndexPtr, IECorePreview::LRUCachePolicy::TaskParallel, SpatialIndexCacheKey>;
+
+SpatialIndexCache &spatialIndexCache()
+{
+	static SpatialIndexCache *c = new SpatialIndexCache( spatialIndexGetter, 1024 * 1024 * 1024, SpatialIndexCache::RemovalCallback(), /* cacheErrors = */ false );
+	return *c;
+}
+
+// The cached evaluators and indices are derived from computed values,
+// so should be released along with them.
+struct CacheClearerRegistration
+{
+
+	CacheClearerRegistration()
+	{
+		ValuePlug::registerCacheClearer(
+			[] {
+				spatialIndexCache().clear();
+				primitiveEvaluatorCache().clear();
+			}
+		);
+	}
+
+};
+
+CacheClearerRegistration g_cacheClearerRegistration;
+
+SceneAlgo::ConstSpatialIndexPtr spatialIndexFromPaths( const ScenePlug *scene, const PathMatcher &existingPaths )
+{
+	std::vector<ScenePlug::ScenePath> paths;
+	for( PathMatcher::Iterator it = existingPaths.begin(), eIt = existingPaths.end(); it != eIt; ++it )
+	{
+		paths.push_back( *it );
+	}
+
+	// Hash the objects and transforms, which is much cheaper
+	// than building an index, and allows us to reuse a previous
+	// index if nothing has changed.
+
+	std::vector<IECore::MurmurHash> hashes( paths.size() );
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, paths.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			ThreadState::Scope threadStateScope( threadState );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				hashes[i].append( paths[i].data(), paths[i].size() );
+				hashes[i].append( scene->fullTransformHash( paths[i] ) );
+				hashes[i].append( scene->objectHash( paths[i] ) );
+			}
+		},
+		taskGroupContext
+	);
+
+	IECore::MurmurHash h;
+	h.append( (uint64_t)paths.size() );
+	for( const auto &pathHash : hashes )
+	{
+		h.append( pathHash );
+	}
+
+	return spatialIndexCache().get( SpatialIndexCacheKey( h, scene, paths ) );
+}
+
+} // namespace
+
+SceneAlgo::ConstSpatialIndexPtr GafferScene::SceneAlgo::spatialIndex( const ScenePlug *scene, const IECore::PathMatcher &paths )
+{
+	PathMatcher existingPaths;
+	matchingPaths( paths, scene, existingPaths );
+	return spatialIndexFromPaths( scene, existingPaths );
+}
+
+SceneAlgo::ConstSpatialIndexPtr GafferScene::SceneAlgo::spatialIndex( const FilterPlug *filterPlug, const ScenePlug *scene )
+{
+	PathMatcher paths;
+	matchingPaths( filterPlug, scene, paths );
+	return spatialIndexFromPaths( scene, paths );
+}
+
+IECoreScene::ConstPrimitiveEvaluatorPtr GafferScene::SceneAlgo::primitiveEvaluator( const ScenePlug *scene, const ScenePlug::ScenePath &path )
+{
+	ConstObjectPtr object = scene->object( path );
+	const Primitive *primitive = runTimeCast<const Primitive>( object.get() );
+	if( !primitive )
+	{
+		return nullptr;
+	}
+	return primitiveEvaluatorCache().get( PrimitiveEvaluatorCacheKey( scene->objectHash( path ), primitive ) );
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Miscellaneous
 //////////////////////////////////////////////////////////////////////////
@@ -42,10 +42,14 @@
 #include "IECore/MessageHandler.h"
 
 #include "boost/bind.hpp"
+#include "boost/lexical_cast.hpp"
 
 #include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
 #include "tbb/parallel_reduce.h"
 
+#include <atomic>
+
 using namespace std;
 using namespace tbb;
 using namespace Imath;
@@ -53,6 +57,51 @@ using namespace IECore;
 using namespace GafferScene;
 using namespace Gaffer;
 
+//////////////////////////////////////////////////////////////////////////
+// Child bounds blocks
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+size_t defaultChildBoundsBlockSize()
+{
+	if( const char *e = getenv( "GAFFERSCENE_CHILDBOUNDS_BLOCKSIZE" ) )
+	{
+		try
+		{
+			return boost::lexical_cast<size_t>( e );
+		}
+		catch( const boost::bad_lexical_cast & )
+		{
+			IECore::msg( IECore::Msg::Warning, "SceneNode", "Invalid value for GAFFERSCENE_CHILDBOUNDS_BLOCKSIZE. Must be a positive integer." );
+		}
+	}
+	return 0;
+}
+
+std::atomic<size_t> g_childBoundsBlockSize( defaultChildBoundsBlockSize() );
+
+// Context variable specifying the range of children to be unioned by
+// `ScenePlug::childBoundsBlockPlug()`.
+const InternedString g_childBoundsBlockContextName( "scene:childBoundsBlock" );
+
+size_t numChildBoundsBlocks( size_t numChildren, size_t blockSize )
+{
+	return ( numChildren + blockSize - 1 ) / blockSize;
+}
+
+V2i childBoundsBlockRange( size_t block, size_t numChildren, size_t blockSize )
+{
+	return V2i( (int)( block * blockSize ), (int)std::min( ( block + 1 ) * blockSize, numChildren ) );
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// SceneNode
+//////////////////////////////////////////////////////////////////////////
+
 GAFFER_NODE_DEFINE_TYPE( SceneNode );
 
 size_t SceneNode::g_firstPlugIndex = 0;
@@ -129,6 +178,12 @@ void SceneNode::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outp
 				input == scenePlug->boundPlug() ||
 				input == scenePlug->transformPlug()
 			)
+			{
+				outputs.push_back( scenePlug->childBoundsPlug() );
+				outputs.push_back( scenePlug->childBoundsBlockPlug() );
+			}
+
+			if( input == scenePlug->childBoundsBlockPlug() )
 			{
 				outputs.push_back( scenePlug->childBoundsPlug() );
 			}
@@ -224,6 +279,10 @@ void SceneNode::hash( const ValuePlug *output, const Context *context, IECore::M
 		{
 			hashChildBounds( context, scenePlug, h );
 		}
+		else if( output == scenePlug->childBoundsBlockPlug() )
+		{
+			hashChildBoundsBlock( context, scenePlug, h );
+		}
 	}
 	else
 	{
@@ -359,6 +418,10 @@ void SceneNode::compute( ValuePlug *output, const Context *context ) const
 			{
 				static_cast<AtomicBox3fPlug *>( output )->setValue( computeChildBounds( context, scenePlug ) );
 			}
+			else if( output == scenePlug->childBoundsBlockPlug() )
+			{
+				static_cast<AtomicBox3fPlug *>( output )->setValue( computeChildBoundsBlock( context, scenePlug ) );
+			}
 		}
 		else
 		{
@@ -412,7 +475,7 @@ Gaffer::ValuePlug::CachePolicy SceneNode::hashCachePolicy( const Gaffer::ValuePl
 {
 	if( auto parent = output->parent<ScenePlug>() )
 	{
-		if( output == parent->childBoundsPlug() )
+		if( output == parent->childBoundsPlug() || output == parent->childBoundsBlockPlug() )
 		{
 			return ValuePlug::CachePolicy::TaskCollaboration;
 		}
@@ -425,7 +488,7 @@ Gaffer::ValuePlug::CachePolicy SceneNode::computeCachePolicy( const Gaffer::Valu
 {
 	if( auto parent = output->parent<ScenePlug>() )
 	{
-		if( output == parent->childBoundsPlug() )
+		if( output == parent->childBoundsPlug() || output == parent->childBoundsBlockPlug() )
 		{
 			return ValuePlug::CachePolicy::TaskCollaboration;
 		}
@@ -440,6 +503,16 @@ IECore::MurmurHash SceneNode::hashOfTransformedChildBounds( const ScenePath &pat
 	return out->childBoundsPlug()->hash();
 }
 
+void SceneNode::setChildBoundsBlockSize( size_t blockSize )
+{
+	g_childBoundsBlockSize = blockSize;
+}
+
+size_t SceneNode::getChildBoundsBlockSize()
+{
+	return g_childBoundsBlockSize;
+}
+
 Imath::Box3f SceneNode::unionOfTransformedChildBounds( const ScenePath &path, const ScenePlug *out, const IECore::InternedStringVectorData *childNamesData ) const
 {
 	ScenePlug::PathScope pathScope( Context::current(), path );
@@ -482,8 +555,10 @@ void SceneNode::plugInputChanged( Gaffer::Plug *plug )
 	// If a node makes a pass-through connection for a `childNamesPlug()` then we
 	// want to automatically create the equivalent pass-throughs for the
 	// `existsPlug()` and `sortedChildNamesPlug()`, to avoid unnecessary computes.
-	// We can't expect derived classes to do this for us, because those plugs are
-	// private, so we do it ourselves here.
+	// Likewise, if the `childNamesPlug()`, `boundPlug()` and `transformPlug()` are
+	// all passed through, we pass through the `childBoundsBlockPlug()`. We can't
+	// expect derived classes to do this for us, because those plugs are private,
+	// so we do it ourselves here.
 
 	if( plug->direction() != Plug::Out )
 	{
@@ -491,19 +566,32 @@ void SceneNode::plugInputChanged( Gaffer::Plug *plug )
 	}
 
 	auto scene = plug->parent<ScenePlug>();
-	if( !scene || plug != scene->childNamesPlug() )
+	if( !scene )
 	{
 		return;
 	}
 
-	ScenePlug *sourceScene = nullptr;
-	if( Plug *source = plug->getInput() )
+	auto sourceScene = [] ( Plug *p ) -> ScenePlug * {
+		Plug *source = p->getInput();
+		return source ? source->parent<ScenePlug>() : nullptr;
+	};
+
+	if( plug == scene->childNamesPlug() )
 	{
-		sourceScene = source->parent<ScenePlug>();
+		ScenePlug *source = sourceScene( plug );
+		scene->existsPlug()->setInput( source ? source->existsPlug() : nullptr );
+		scene->sortedChildNamesPlug()->setInput( source ? source->sortedChildNamesPlug() : nullptr );
 	}
 
-	scene->existsPlug()->setInput( sourceScene ? sourceScene->existsPlug() : nullptr );
-	scene->sortedChildNamesPlug()->setInput( sourceScene ? sourceScene->sortedChildNamesPlug() : nullptr );
+	if( plug == scene->childNamesPlug() || plug == scene->boundPlug() || plug == scene->transformPlug() )
+	{
+		ScenePlug *source = sourceScene( scene->childNamesPlug() );
+		if( source != sourceScene( scene->boundPlug() ) || source != sourceScene( scene->transformPlug() ) )
+		{
+			source = nullptr;
+		}
+		scene->childBoundsBlockPlug()->setInput( source ? source->childBoundsBlockPlug() : nullptr );
+	}
 }
 
 void SceneNode::hashExists( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
@@ -588,6 +676,35 @@ void SceneNode::hashChildBounds( const Gaffer::Context *context, const ScenePlug
 	using Range = blocked_range<size_t>;
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 
+	const size_t blockSize = g_childBoundsBlockSize;
+	if( blockSize && childNames.size() > blockSize )
+	{
+		// Hash each block via `childBoundsBlockPlug()`, so that the block
+		// hashes are held in the hash cache, ready for reuse by
+		// `computeChildBounds()`.
+		vector<IECore::MurmurHash> blockHashes( numChildBoundsBlocks( childNames.size(), blockSize ) );
+		tbb::parallel_for(
+			Range( 0, blockHashes.size() ),
+			[&] ( const Range &range ) {
+
+				Context::EditableScope blockScope( threadState );
+				for( size_t b = range.begin(); b != range.end(); ++b )
+				{
+					blockScope.set( g_childBoundsBlockContextName, childBoundsBlockRange( b, childNames.size(), blockSize ) );
+					blockHashes[b] = parent->childBoundsBlockPlug()->hash();
+				}
+
+			},
+			taskGroupContext
+		);
+
+		for( const auto &blockHash : blockHashes )
+		{
+			h.append( blockHash );
+		}
+		return;
+	}
+
 	const IECore::MurmurHash reduction = parallel_deterministic_reduce(
 		Range( 0, childNames.size() ),
 		h,
@@ -634,6 +751,40 @@ Imath::Box3f SceneNode::computeChildBounds( const Gaffer::Context *context, cons
 	using Range = blocked_range<size_t>;
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 
+	const size_t blockSize = g_childBoundsBlockSize;
+	if( blockSize && childNames.size() > blockSize )
+	{
+		// Union the bounds of each block of children. The hashes for
+		// the blocks were computed by `hashChildBounds()`, so will be
+		// found in the hash cache, and blocks which haven't changed
+		// will be found in the compute cache.
+		return tbb::parallel_reduce(
+			Range( 0, numChildBoundsBlocks( childNames.size(), blockSize ) ),
+			Box3f(),
+			[&] ( const Range &range, const Box3f &bound ) {
+
+				Context::EditableScope blockScope( threadState );
+				Box3f result = bound;
+				for( size_t b = range.begin(); b != range.end(); ++b )
+				{
+					blockScope.set( g_childBoundsBlockContextName, childBoundsBlockRange( b, childNames.size(), blockSize ) );
+					result.extendBy( parent->childBoundsBlockPlug()->getValue() );
+				}
+				return result;
+
+			},
+			[] ( const Box3f &x, const Box3f &y ) {
+
+				Box3f result = x;
+				result.extendBy( y );
+				return result;
+
+			},
+			tbb::auto_partitioner(),
+			taskGroupContext
+		);
+	}
+
 	return tbb::parallel_reduce(
 		Range( 0, childNames.size() ),
 		Box3f(),
@@ -666,3 +817,56 @@ Imath::Box3f SceneNode::computeChildBounds( const Gaffer::Context *context, cons
 		taskGroupContext
 	);
 }
+
+void SceneNode::hashChildBoundsBlock( const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
+{
+	ComputeNode::hash( parent->childBoundsBlockPlug(), context, h );
+
+	const V2i range = context->get<V2i>( g_childBoundsBlockContextName );
+	h.append( range );
+
+	// Remove the block variable, so that we share cache entries with
+	// all other evaluations of the child names, bounds and transforms.
+	ScenePlug::PathScope pathScope( context );
+	pathScope.remove( g_childBoundsBlockContextName );
+
+	ConstInternedStringVectorDataPtr childNamesData = parent->childNamesPlug()->getValue();
+	const vector<InternedString> &childNames = childNamesData->readable();
+
+	ScenePath childPath = context->get<ScenePath>( ScenePlug::scenePathContextName );
+	childPath.push_back( InternedString() ); // room for the child name
+	const size_t end = std::min( (size_t)range[1], childNames.size() );
+	for( size_t i = range[0]; i < end; ++i )
+	{
+		childPath.back() = childNames[i];
+		pathScope.setPath( childPath );
+		parent->boundPlug()->hash( h );
+		parent->transformPlug()->hash( h );
+	}
+}
+
+Imath::Box3f SceneNode::computeChildBoundsBlock( const Gaffer::Context *context, const ScenePlug *parent ) const
+{
+	const V2i range = context->get<V2i>( g_childBoundsBlockContextName );
+
+	ScenePlug::PathScope pathScope( context );
+	pathScope.remove( g_childBoundsBlockContextName );
+
+	ConstInternedStringVectorDataPtr childNamesData = parent->childNamesPlug()->getValue();
+	const vector<InternedString> &childNames = childNamesData->readable();
+
+	ScenePath childPath = context->get<ScenePath>( ScenePlug::scenePathContextName );
+	childPath.push_back( InternedString() ); // room for the child name
+	Box3f result;
+	const size_t end = std::min( (size_t)range[1], childNames.size() );
+	for( size_t i = range[0]; i < end; ++i )
+	{
+		childPath.back() = childNames[i];
+		pathScope.setPath( childPath );
+		Box3f childBound = parent->boundPlug()->getValue();
+		childBound = transform( childBound, parent->transformPlug()->getValue() );
+		result.extendBy( childBound );
+	}
+
+	return result;
+}
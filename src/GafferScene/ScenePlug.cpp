@@ -42,6 +42,9 @@
 #include "Gaffer/Context.h"
 #include "Gaffer/ContextAlgo.h"
 
+#include "IECoreScene/CurvesPrimitive.h"
+#include "IECoreScene/MeshPrimitive.h"
+
 #include "IECore/NullObject.h"
 #include "IECore/StringAlgo.h"
 
@@ -58,6 +61,54 @@ static ContextAlgo::GlobalScope::Registration g_globalScopeRegistration(
 	{ ScenePlug::scenePathContextName, ScenePlug::setNameContextName }
 );
 
+namespace
+{
+
+// Exposes the data held by primitives, so that the compute cache can
+// account for buffers shared between the objects output by different
+// nodes. This is very common, as most nodes modify only a few primitive
+// variables, passing through the rest along with the topology.
+struct CacheDataEnumeratorRegistration
+{
+
+	CacheDataEnumeratorRegistration()
+	{
+		ValuePlug::registerCacheDataEnumerator(
+			IECoreScene::Primitive::staticTypeId(),
+			[] ( const IECore::Object *object, const std::function<void ( const IECore::Data * )> &dataFunctor ) {
+				const auto primitive = static_cast<const IECoreScene::Primitive *>( object );
+				for( const auto &primitiveVariable : primitive->variables )
+				{
+					dataFunctor( primitiveVariable.second.data.get() );
+					dataFunctor( primitiveVariable.second.indices.get() );
+				}
+			}
+		);
+
+		ValuePlug::registerCacheDataEnumerator(
+			IECoreScene::MeshPrimitive::staticTypeId(),
+			[] ( const IECore::Object *object, const std::function<void ( const IECore::Data * )> &dataFunctor ) {
+				const auto mesh = static_cast<const IECoreScene::MeshPrimitive *>( object );
+				dataFunctor( mesh->verticesPerFace() );
+				dataFunctor( mesh->vertexIds() );
+			}
+		);
+
+		ValuePlug::registerCacheDataEnumerator(
+			IECoreScene::CurvesPrimitive::staticTypeId(),
+			[] ( const IECore::Object *object, const std::function<void ( const IECore::Data * )> &dataFunctor ) {
+				const auto curves = static_cast<const IECoreScene::CurvesPrimitive *>( object );
+				dataFunctor( curves->verticesPerCurve() );
+			}
+		);
+	}
+
+};
+
+CacheDataEnumeratorRegistration g_cacheDataEnumeratorRegistration;
+
+} // namespace
+
 ScenePlug::ScenePlug( const std::string &name, Direction direction, unsigned flags )
 	:	ValuePlug( name, direction, flags )
 {
@@ -166,6 +217,15 @@ ScenePlug::ScenePlug( const std::string &name, Direction direction, unsigned fla
 		)
 	);
 
+	addChild(
+		new AtomicBox3fPlug(
+			"__childBoundsBlock",
+			direction,
+			Imath::Box3f(),
+			childFlags
+		)
+	);
+
 }
 
 ScenePlug::~ScenePlug()
@@ -178,7 +238,7 @@ bool ScenePlug::acceptsChild( const GraphComponent *potentialChild ) const
 	{
 		return false;
 	}
-	return children().size() != 11;
+	return children().size() != 12;
 }
 
 Gaffer::PlugPtr ScenePlug::createCounterpart( const std::string &name, Direction direction ) const
@@ -310,6 +370,16 @@ const Gaffer::InternedStringVectorDataPlug *ScenePlug::sortedChildNamesPlug() co
 	return getChild<InternedStringVectorDataPlug>( 10 );
 }
 
+Gaffer::AtomicBox3fPlug *ScenePlug::childBoundsBlockPlug()
+{
+	return getChild<AtomicBox3fPlug>( 11 );
+}
+
+const Gaffer::AtomicBox3fPlug *ScenePlug::childBoundsBlockPlug() const
+{
+	return getChild<AtomicBox3fPlug>( 11 );
+}
+
 ScenePlug::PathScope::PathScope( const Gaffer::Context *context )
 	:	EditableScope( context )
 {
@@ -40,6 +40,9 @@
 
 #include "GafferScene/SetAlgo.h"
 
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+#include "Gaffer/ValuePlug.h"
+
 #include "IECore/MessageHandler.h"
 
 #include "boost/algorithm/string/predicate.hpp"
@@ -51,6 +54,9 @@
 #include "boost/variant/apply_visitor.hpp"
 #include "boost/variant/recursive_variant.hpp"
 
+#include <memory>
+#include <unordered_map>
+
 using namespace IECore;
 using namespace Gaffer;
 using namespace GafferScene;
@@ -191,12 +197,85 @@ std::ostream& operator<<( std::ostream& stream, const ExpressionAst& expr )
 
 // Evaluating the AST
 // ------------------
+//
+// The results of each binary operation are cached, keyed by a hash of the
+// operation and its inputs. So when one set changes, we only need to
+// recompute the operations which depend on it, and the results of the
+// others are reused.
+
+struct AstEvaluator;
+
+// GetterKey for the cache, providing everything needed to evaluate
+// the operation. Satisfies the LRUCache requirements because `hash`
+// uniquely identifies the operation and the sets it is applied to.
+struct BinaryOpCacheKey
+{
+
+	BinaryOpCacheKey( const IECore::MurmurHash &hash, const BinaryOp &op, const AstEvaluator &evaluator )
+		:	hash( hash ), op( op ), evaluator( evaluator )
+	{
+	}
+
+	operator const IECore::MurmurHash &() const
+	{
+		return hash;
+	}
+
+	const IECore::MurmurHash hash;
+	const BinaryOp &op;
+	const AstEvaluator &evaluator;
+
+};
+
+PathMatcher binaryOpCacheGetter( const BinaryOpCacheKey &key, size_t &cost );
+
+using BinaryOpCache = IECorePreview::LRUCache<IECore::MurmurHash, PathMatcher, IECorePreview::LRUCachePolicy::TaskParallel, BinaryOpCacheKey>;
+
+BinaryOpCache &binaryOpCache()
+{
+	static BinaryOpCache *c = new BinaryOpCache( binaryOpCacheGetter, 512 * 1024 * 1024, BinaryOpCache::RemovalCallback(), /* cacheErrors = */ false );
+	return *c;
+}
+
+// The cached results are derived from computed sets, so should be
+// released along with them.
+struct CacheClearerRegistration
+{
+
+	CacheClearerRegistration()
+	{
+		ValuePlug::registerCacheClearer(
+			[] {
+				binaryOpCache().clear();
+			}
+		);
+	}
+
+};
+
+CacheClearerRegistration g_cacheClearerRegistration;
+
+// PathMatcher doesn't report its memory usage, so we estimate it
+// from the number of nodes in its tree. Each node is allocated
+// separately and referenced by an entry in its parent's child map,
+// which we approximate as a fixed size per node.
+size_t pathMatcherMemoryUsage( const PathMatcher &paths )
+{
+	const size_t nodeSize = 64;
+	size_t numNodes = 0;
+	for( PathMatcher::RawIterator it = paths.begin(), eIt = paths.end(); it != eIt; ++it )
+	{
+		numNodes++;
+	}
+	return sizeof( PathMatcher ) + numNodes * nodeSize;
+}
+
 struct AstEvaluator
 {
 	typedef PathMatcher result_type;
 
 	AstEvaluator( const ScenePlug *scene )
-		: m_scene( scene )
+		: m_scene( scene ), m_context( Context::current() )
 	{
 	}
 
@@ -249,6 +328,17 @@ struct AstEvaluator
 
 	result_type operator()( const ExpressionAst &ast ) const
 	{
+		if( auto op = boost::get<BinaryOp>( &ast.expr ) )
+		{
+			if( m_hashes.find( op ) == m_hashes.end() )
+			{
+				// Compute hashes for this operation and all the operations
+				// beneath it in one pass, so that we don't repeatedly hash
+				// the same subtrees as we descend.
+				hash( ast );
+			}
+			return (*this)( *op );
+		}
 		return boost::apply_visitor( *this, ast.expr );
 	}
 
@@ -259,6 +349,13 @@ struct AstEvaluator
 	}
 
 	result_type operator()( const BinaryOp &expr ) const
+	{
+		auto it = m_hashes.find( &expr );
+		assert( it != m_hashes.end() );
+		return binaryOpCache().get( BinaryOpCacheKey( it->second, expr, *this ) );
+	}
+
+	result_type evaluate( const BinaryOp &expr ) const
 	{
 		PathMatcher left = boost::apply_visitor( *this, expr.left.expr );
 		PathMatcher right = boost::apply_visitor( *this, expr.right.expr );
@@ -308,10 +405,68 @@ struct AstEvaluator
 		}
 	}
 
+	// Returns a hash uniquely identifying the result of `ast`, recording
+	// the hashes of any BinaryOps in `m_hashes`. Unlike the hash from
+	// `setExpressionHash()`, this includes the names of all identifiers
+	// so that it can be used as a cache key.
+	IECore::MurmurHash hash( const ExpressionAst &ast ) const
+	{
+		IECore::MurmurHash result;
+		if( auto identifier = boost::get<std::string>( &ast.expr ) )
+		{
+			result.append( *identifier );
+			if( (*identifier)[0] != '/' )
+			{
+				if( !StringAlgo::hasWildcards( *identifier ) )
+				{
+					result.append( m_scene->setHash( *identifier ) );
+				}
+				else
+				{
+					IECore::ConstInternedStringVectorDataPtr setNamesData = m_scene->setNamesPlug()->getValue();
+					ScenePlug::SetScope setScope( Context::current() );
+					for( const IECore::InternedString &setName : setNamesData->readable() )
+					{
+						if( StringAlgo::match( setName.string(), *identifier ) )
+						{
+							setScope.setSetName( setName );
+							result.append( m_scene->setPlug()->hash() );
+						}
+					}
+				}
+			}
+		}
+		else if( auto binaryOp = boost::get<BinaryOp>( &ast.expr ) )
+		{
+			result.append( (int)binaryOp->op );
+			result.append( hash( binaryOp->left ) );
+			result.append( hash( binaryOp->right ) );
+			m_hashes[binaryOp] = result;
+		}
+		else if( auto subExpression = boost::get<ExpressionAst>( &ast.expr ) )
+		{
+			result = hash( *subExpression );
+		}
+		return result;
+	}
+
 	const ScenePlug *m_scene;
+	const Context *m_context;
+	mutable std::unordered_map<const BinaryOp *, IECore::MurmurHash> m_hashes;
 
 };
 
+PathMatcher binaryOpCacheGetter( const BinaryOpCacheKey &key, size_t &cost )
+{
+	// The TaskParallel policy doesn't guarantee that the getter is
+	// called with the context of the original request, so we scope
+	// it explicitly.
+	Context::Scope scopedContext( key.evaluator.m_context );
+	PathMatcher result = key.evaluator.evaluate( key.op );
+	cost = pathMatcherMemoryUsage( result );
+	return result;
+}
+
 // Hashing the AST
 // ---------------
 struct AstHasher
@@ -511,6 +666,27 @@ void expressionToAST( const std::string &setExpression, ExpressionAst &ast)
 	}
 }
 
+// Parsing is relatively expensive, and the same expressions are
+// evaluated and hashed repeatedly, so we cache the ASTs.
+
+using ConstExpressionAstPtr = std::shared_ptr<const ExpressionAst>;
+
+ConstExpressionAstPtr astCacheGetter( const std::string &setExpression, size_t &cost )
+{
+	cost = 1;
+	auto ast = std::make_shared<ExpressionAst>();
+	expressionToAST( setExpression, *ast );
+	return ast;
+}
+
+using AstCache = IECorePreview::LRUCache<std::string, ConstExpressionAstPtr>;
+
+AstCache &astCache()
+{
+	static AstCache *c = new AstCache( astCacheGetter, 10000 );
+	return *c;
+}
+
 } // namespace
 
 namespace GafferScene
@@ -521,20 +697,18 @@ namespace SetAlgo
 
 PathMatcher evaluateSetExpression( const std::string &setExpression, const ScenePlug *scene )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
+	ConstExpressionAstPtr ast = astCache().get( setExpression );
 
 	AstEvaluator eval( scene );
-	return eval( ast );
+	return eval( *ast );
 }
 
 void setExpressionHash( const std::string &setExpression, const ScenePlug* scene, IECore::MurmurHash &h )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
+	ConstExpressionAstPtr ast = astCache().get( setExpression );
 
 	AstHasher hasher = AstHasher( scene, h );
-	hasher(ast);
+	hasher( *ast );
 }
 
 IECore::MurmurHash setExpressionHash( const std::string &setExpression, const ScenePlug* scene)
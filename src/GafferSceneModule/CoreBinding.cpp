@@ -391,7 +391,12 @@ void GafferSceneModule::bindCore()
 	ScenePathFromString();
 
 	typedef ComputeNodeWrapper<SceneNode> SceneNodeWrapper;
-	GafferBindings::DependencyNodeClass<SceneNode, SceneNodeWrapper>();
+	GafferBindings::DependencyNodeClass<SceneNode, SceneNodeWrapper>()
+		.def( "setChildBoundsBlockSize", &SceneNode::setChildBoundsBlockSize )
+		.staticmethod( "setChildBoundsBlockSize" )
+		.def( "getChildBoundsBlockSize", &SceneNode::getChildBoundsBlockSize )
+		.staticmethod( "getChildBoundsBlockSize" )
+	;
 
 	typedef ComputeNodeWrapper<SceneProcessor> SceneProcessorWrapper;
 	GafferBindings::DependencyNodeClass<SceneProcessor, SceneProcessorWrapper>()
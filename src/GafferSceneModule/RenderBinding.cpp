@@ -201,6 +201,12 @@ void render( Renderer &renderer )
 	renderer.render();
 }
 
+bool waitForRender( Renderer &renderer )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return renderer.waitForRender();
+}
+
 class ProceduralWrapper : public IECorePython::RunTimeTypedWrapper<IECoreScenePreview::Procedural>
 {
 
@@ -359,6 +365,8 @@ void GafferSceneModule::bindRender()
 			.staticmethod( "types" )
 			.def( "create", &Renderer::create, ( arg( "type" ), arg( "renderType" ) = Renderer::Batch, arg( "fileName" ) = "", arg( "messageHandler" ) = IECore::MessageHandlerPtr() ) )
 			.staticmethod( "create" )
+			.def( "supportsWaitForRender", &Renderer::supportsWaitForRender )
+			.staticmethod( "supportsWaitForRender" )
 
 			.def( "name", &rendererName )
 
@@ -377,6 +385,7 @@ void GafferSceneModule::bindRender()
 
 			.def( "render", render )
 			.def( "pause", &Renderer::pause )
+			.def( "waitForRender", &waitForRender )
 			.def( "command", &rendererCommand )
 
 		;
@@ -50,6 +50,30 @@ using namespace GafferScene;
 namespace
 {
 
+tuple transformSamplesWrapper( const ScenePlug &scene, size_t segments, const Imath::V2f &shutter )
+{
+	std::vector<Imath::M44f> samples;
+	std::vector<float> sampleTimes;
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		RendererAlgo::transformSamples( &scene, segments, shutter, samples, sampleTimes );
+	}
+
+	list pythonSamples;
+	for( auto &s : samples )
+	{
+		pythonSamples.append( s );
+	}
+
+	list pythonSampleTimes;
+	for( auto &s : sampleTimes )
+	{
+		pythonSampleTimes.append( s );
+	}
+
+	return make_tuple( pythonSamples, pythonSampleTimes );
+}
+
 tuple objectSamplesWrapper( const ScenePlug &scene, size_t segments, const Imath::V2f &shutter, bool copy )
 {
 	std::vector<IECore::ConstObjectPtr> samples;
@@ -113,6 +137,13 @@ void outputCamerasWrapper( const ScenePlug &scene, const IECore::CompoundObject
 	RendererAlgo::outputCameras( &scene, &globals, renderSets, &renderer );
 }
 
+void outputSceneWrapper( const ScenePlug &scene, const IECore::CompoundObject &globals, const RendererAlgo::RenderSets &renderSets, IECoreScenePreview::Renderer &renderer )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	RendererAlgo::LightLinks lightLinks;
+	RendererAlgo::outputScene( &scene, &globals, renderSets, &lightLinks, &renderer );
+}
+
 void applyCameraGlobalsWrapper( IECoreScene::Camera &camera, const IECore::CompoundObject &globals, const ScenePlug &scene )
 {
 	IECorePython::ScopedGILRelease gilRelease;
@@ -131,6 +162,7 @@ void bindRendererAlgo()
 	scope().attr( "RendererAlgo" ) = module;
 	scope moduleScope( module );
 
+	def( "transformSamples", &transformSamplesWrapper, ( arg( "scene" ), arg( "segments" ), arg( "shutter" ) ) );
 	def( "objectSamples", &objectSamplesWrapper, ( arg( "scene" ), arg( "segments" ), arg( "shutter" ), arg( "_copy" ) = true ) );
 
 	def( "registerAdaptor", &registerAdaptorWrapper );
@@ -142,6 +174,7 @@ void bindRendererAlgo()
 	;
 
 	def( "outputCameras", &outputCamerasWrapper );
+	def( "outputScene", &outputSceneWrapper );
 
 	def( "applyCameraGlobals", &applyCameraGlobalsWrapper );
 
@@ -46,6 +46,7 @@
 #include "GafferImage/ImagePlug.h"
 
 #include "IECoreScene/Camera.h"
+#include "IECoreScene/PrimitiveEvaluator.h"
 
 #include "IECorePython/RefCountedBinding.h"
 #include "IECorePython/ScopedGILRelease.h"
@@ -257,6 +258,57 @@ IECore::PathMatcher linkedLightsWrapper2( const GafferScene::ScenePlug &scene, c
 	return SceneAlgo::linkedLights( &scene, objects );
 }
 
+SceneAlgo::SpatialIndexPtr spatialIndexWrapper1( const ScenePlug &scene, const IECore::PathMatcher &paths )
+{
+	IECorePython::ScopedGILRelease r;
+	return boost::const_pointer_cast<SceneAlgo::SpatialIndex>( SceneAlgo::spatialIndex( &scene, paths ) );
+}
+
+SceneAlgo::SpatialIndexPtr spatialIndexWrapper2( const FilterPlug &filterPlug, const ScenePlug &scene )
+{
+	IECorePython::ScopedGILRelease r;
+	return boost::const_pointer_cast<SceneAlgo::SpatialIndex>( SceneAlgo::spatialIndex( &filterPlug, &scene ) );
+}
+
+object spatialIndexRayCast( const SceneAlgo::SpatialIndex &index, const Imath::V3f &origin, const Imath::V3f &direction, float maxDistance )
+{
+	ScenePlug::ScenePath path;
+	Imath::V3f point;
+	if( !index.rayCast( origin, direction, path, point, maxDistance ) )
+	{
+		return object();
+	}
+	std::string pathString;
+	ScenePlug::pathToString( path, pathString );
+	return make_tuple( pathString, point );
+}
+
+object spatialIndexClosestPoint( const SceneAlgo::SpatialIndex &index, const Imath::V3f &p, float maxDistance )
+{
+	ScenePlug::ScenePath path;
+	Imath::V3f point;
+	if( !index.closestPoint( p, path, point, maxDistance ) )
+	{
+		return object();
+	}
+	std::string pathString;
+	ScenePlug::pathToString( path, pathString );
+	return make_tuple( pathString, point );
+}
+
+IECoreScene::PrimitiveEvaluatorPtr primitiveEvaluatorWrapper( const ScenePlug &scene, const ScenePlug::ScenePath &path )
+{
+	IECorePython::ScopedGILRelease r;
+	return boost::const_pointer_cast<IECoreScene::PrimitiveEvaluator>( SceneAlgo::primitiveEvaluator( &scene, path ) );
+}
+
+IECore::PathMatcher spatialIndexFrustumQuery( const SceneAlgo::SpatialIndex &index, object pythonPlanes )
+{
+	std::vector<Imath::Plane3f> planes;
+	boost::python::container_utils::extend_container( planes, pythonPlanes );
+	return index.frustumQuery( planes );
+}
+
 } // namespace
 
 namespace GafferSceneModule
@@ -332,6 +384,20 @@ void bindSceneAlgo()
 	def( "linkedLights", &linkedLightsWrapper1 );
 	def( "linkedLights", &linkedLightsWrapper2 );
 
+	// Spatial queries
+
+	IECorePython::RefCountedClass<SceneAlgo::SpatialIndex, IECore::RefCounted>( "SpatialIndex" )
+		.def( "memoryUsage", &SceneAlgo::SpatialIndex::memoryUsage )
+		.def( "bound", &SceneAlgo::SpatialIndex::bound )
+		.def( "rayCast", &spatialIndexRayCast, ( arg( "origin" ), arg( "direction" ), arg( "maxDistance" ) = std::numeric_limits<float>::max() ) )
+		.def( "closestPoint", &spatialIndexClosestPoint, ( arg( "point" ), arg( "maxDistance" ) = std::numeric_limits<float>::max() ) )
+		.def( "frustumQuery", &spatialIndexFrustumQuery )
+	;
+
+	def( "spatialIndex", &spatialIndexWrapper1 );
+	def( "spatialIndex", &spatialIndexWrapper2 );
+	def( "primitiveEvaluator", &primitiveEvaluatorWrapper );
+
 }
 
 } // namespace GafferSceneModule
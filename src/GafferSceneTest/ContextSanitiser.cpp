@@ -70,6 +70,8 @@ namespace
 
 const InternedString g_internalOut( "__internalOut" );
 const InternedString g_sortedChildNames( "__sortedChildNames" );
+const InternedString g_childBoundsBlock( "__childBoundsBlock" );
+const InternedString g_childBoundsBlockContextName( "scene:childBoundsBlock" );
 
 } // namespace
 
@@ -102,9 +104,10 @@ void ContextSanitiser::processStarted( const Gaffer::Process *process )
 			process->plug() != scene->childNamesPlug() &&
 			process->plug() != scene->existsPlug() &&
 			process->plug() != scene->childBoundsPlug() &&
-			// Private plug, so we have no choice but to test
-			// for it by name.
-			process->plug()->getName() != g_sortedChildNames
+			// Private plugs, so we have no choice but to test
+			// for them by name.
+			process->plug()->getName() != g_sortedChildNames &&
+			process->plug()->getName() != g_childBoundsBlock
 		)
 		{
 			if( process->context()->get<IECore::Data>( ScenePlug::scenePathContextName, nullptr ) )
@@ -112,6 +115,14 @@ void ContextSanitiser::processStarted( const Gaffer::Process *process )
 				warn( *process, ScenePlug::scenePathContextName );
 			}
 		}
+
+		if( process->plug()->getName() != g_childBoundsBlock )
+		{
+			if( process->context()->get<IECore::Data>( g_childBoundsBlockContextName, nullptr ) )
+			{
+				warn( *process, g_childBoundsBlockContextName );
+			}
+		}
 	}
 
 	if( process->plug()->parent<const FilterResults>() )
@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2021, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferSceneTest/SceneAlgoTest.h"
+
+#include "GafferScene/SceneAlgo.h"
+
+#include "IECoreScene/PrimitiveEvaluator.h"
+
+#include <limits>
+
+using namespace Imath;
+using namespace IECore;
+using namespace IECoreScene;
+using namespace Gaffer;
+using namespace GafferScene;
+
+size_t GafferSceneTest::bruteForceRayCasts( const GafferScene::ScenePlug *scene, const IECore::PathMatcher &paths, const std::vector<Imath::V3f> &origins, const Imath::V3f &direction )
+{
+	struct Entry
+	{
+		M44f transform;
+		M44f inverseTransform;
+		ConstPrimitiveEvaluatorPtr evaluator;
+	};
+
+	PathMatcher existingPaths;
+	SceneAlgo::matchingPaths( paths, scene, existingPaths );
+
+	std::vector<Entry> entries;
+	for( PathMatcher::Iterator it = existingPaths.begin(), eIt = existingPaths.end(); it != eIt; ++it )
+	{
+		Entry entry;
+		entry.evaluator = SceneAlgo::primitiveEvaluator( scene, *it );
+		if( entry.evaluator )
+		{
+			entry.transform = scene->fullTransform( *it );
+			entry.inverseTransform = entry.transform.inverse();
+			entries.push_back( entry );
+		}
+	}
+
+	const V3f normalizedDirection = direction.normalized();
+
+	size_t hits = 0;
+	for( const auto &origin : origins )
+	{
+		float closestDistance = std::numeric_limits<float>::max();
+		bool hit = false;
+		for( const auto &entry : entries )
+		{
+			const V3f objectOrigin = origin * entry.inverseTransform;
+			V3f objectDirection;
+			entry.inverseTransform.multDirMatrix( normalizedDirection, objectDirection );
+			const float scale = objectDirection.length();
+			if( scale == 0.0f )
+			{
+				continue;
+			}
+			objectDirection /= scale;
+
+			PrimitiveEvaluator::ResultPtr result = entry.evaluator->createResult();
+			if( entry.evaluator->intersectionPoint( objectOrigin, objectDirection, result.get(), closestDistance * scale ) )
+			{
+				closestDistance = std::min( closestDistance, ( result->point() * entry.transform - origin ).length() );
+				hit = true;
+			}
+		}
+		hits += hit;
+	}
+
+	return hits;
+}
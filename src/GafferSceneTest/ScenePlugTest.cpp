@@ -40,8 +40,40 @@
 
 #include "IECore/Timer.h"
 
+#include "tbb/parallel_for.h"
+
+using namespace IECore;
+using namespace Gaffer;
 using namespace GafferScene;
 
+namespace
+{
+
+const size_t g_numLocations = 1000000;
+
+ScenePlug::ScenePath parentPath( int pathDepth )
+{
+	ScenePlug::ScenePath result;
+	for( int i = 0; i < pathDepth - 1; ++i )
+	{
+		result.push_back( InternedString( "level" + std::to_string( i ) ) );
+	}
+	return result;
+}
+
+std::vector<InternedString> childNames()
+{
+	std::vector<InternedString> result;
+	result.reserve( g_numLocations );
+	for( size_t i = 0; i < g_numLocations; ++i )
+	{
+		result.push_back( InternedString( (int64_t)i ) );
+	}
+	return result;
+}
+
+} // namespace
+
 void GafferSceneTest::testManyStringToPathCalls()
 {
 	std::string s = "/i/am/a/fairly/long/string/for/testing/string/to/path";
@@ -56,3 +88,48 @@ void GafferSceneTest::testManyStringToPathCalls()
 	// Uncomment to get timing information.
 	//std::cerr << t.stop() << std::endl;
 }
+
+void GafferSceneTest::testPathScopeConstructionPerformance( int pathDepth )
+{
+	const ScenePlug::ScenePath parent = parentPath( pathDepth );
+	const std::vector<InternedString> names = childNames();
+
+	const ThreadState &threadState = ThreadState::current();
+
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, names.size() ),
+		[&] ( const tbb::blocked_range<size_t> &r ) {
+			ScenePlug::ScenePath path = parent;
+			path.push_back( InternedString() );
+			for( size_t i = r.begin(); i != r.end(); ++i )
+			{
+				path.back() = names[i];
+				ScenePlug::PathScope scope( threadState, path );
+				scope.context()->hash();
+			}
+		}
+	);
+}
+
+void GafferSceneTest::testPathScopeHashPerformance( int pathDepth )
+{
+	const ScenePlug::ScenePath parent = parentPath( pathDepth );
+	const std::vector<InternedString> names = childNames();
+
+	const ThreadState &threadState = ThreadState::current();
+
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, names.size() ),
+		[&] ( const tbb::blocked_range<size_t> &r ) {
+			ScenePlug::PathScope scope( threadState );
+			ScenePlug::ScenePath path = parent;
+			path.push_back( InternedString() );
+			for( size_t i = r.begin(); i != r.end(); ++i )
+			{
+				path.back() = names[i];
+				scope.setPath( path );
+				scope.context()->hash();
+			}
+		}
+	);
+}
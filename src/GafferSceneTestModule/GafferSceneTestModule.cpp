@@ -39,6 +39,7 @@
 
 #include "GafferSceneTest/ContextSanitiser.h"
 #include "GafferSceneTest/CompoundObjectSource.h"
+#include "GafferSceneTest/SceneAlgoTest.h"
 #include "GafferSceneTest/ScenePlugTest.h"
 #include "GafferSceneTest/TestLight.h"
 #include "GafferSceneTest/TestShader.h"
@@ -57,6 +58,12 @@ static void traverseSceneWrapper( const GafferScene::ScenePlug *scenePlug )
 	traverseScene( scenePlug );
 }
 
+static size_t bruteForceRayCastsWrapper( const GafferScene::ScenePlug *scenePlug, const IECore::PathMatcher &paths, const IECore::V3fVectorData *origins, const Imath::V3f &direction )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return bruteForceRayCasts( scenePlug, paths, origins->readable(), direction );
+}
+
 BOOST_PYTHON_MODULE( _GafferSceneTest )
 {
 
@@ -74,5 +81,9 @@ BOOST_PYTHON_MODULE( _GafferSceneTest )
 	def( "connectTraverseSceneToPreDispatchSignal", &connectTraverseSceneToPreDispatchSignal );
 
 	def( "testManyStringToPathCalls", &testManyStringToPathCalls );
+	def( "testPathScopeConstructionPerformance", &testPathScopeConstructionPerformance );
+	def( "testPathScopeHashPerformance", &testPathScopeHashPerformance );
+
+	def( "bruteForceRayCasts", &bruteForceRayCastsWrapper );
 
 }
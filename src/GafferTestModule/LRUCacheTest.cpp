@@ -707,6 +707,126 @@ void testLRUCacheGetIfCached( const std::string &policy )
 	DispatchTest<TestLRUCacheGetIfCached>()( policy );
 }
 
+template<template<typename> class Policy>
+struct TestLRUCacheSharedCost
+{
+
+	void operator()()
+	{
+		// Each value references one of two shared resources, identified
+		// by `value % 2`. Each resource has a cost of 10, which should only
+		// be charged while at least one cached value references it.
+		std::vector<int> references( 2, 0 );
+
+		using Cache = IECorePreview::LRUCache<int, int, Policy>;
+		Cache cache(
+			// Getter
+			[]( int key, size_t &cost ) {
+				cost = 1;
+				return key;
+			},
+			/* maxCost = */ 100,
+			typename Cache::RemovalCallback(),
+			/* cacheErrors = */ true,
+			{
+				// Shared cost
+				[]( int key, int value ) -> size_t {
+					return value < 0 ? 200 : 10;
+				},
+				// Acquire shared cost
+				[&references]( int key, int value ) -> size_t {
+					GAFFERTEST_ASSERT( value >= 0 );
+					return references[value % 2]++ == 0 ? 10 : 0;
+				},
+				// Release shared cost
+				[&references]( int key, int value ) -> size_t {
+					return --references[value % 2] == 0 ? 10 : 0;
+				}
+			}
+		);
+
+		GAFFERTEST_ASSERTEQUAL( cache.get( 0 ), 0 );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 11 );
+		GAFFERTEST_ASSERTEQUAL( cache.get( 2 ), 2 );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 12 );
+		GAFFERTEST_ASSERTEQUAL( cache.get( 1 ), 1 );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 23 );
+		GAFFERTEST_ASSERTEQUAL( cache.get( 3 ), 3 );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 24 );
+
+		// Getting again must not charge again.
+
+		GAFFERTEST_ASSERTEQUAL( cache.get( 3 ), 3 );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 24 );
+
+		// Shared cost is only released with the last reference.
+
+		cache.erase( 0 );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 23 );
+		cache.erase( 2 );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 12 );
+
+		// Replacing a value releases the old one before acquiring
+		// the new one.
+
+		cache.set( 1, 1, 1 );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 12 );
+		cache.set( 4, 4, 1 );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 23 );
+
+		cache.clear();
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 0 );
+		GAFFERTEST_ASSERTEQUAL( references[0], 0 );
+		GAFFERTEST_ASSERTEQUAL( references[1], 0 );
+
+		// Eviction takes shared costs into account.
+
+		for( int i = 0; i < 20; ++i )
+		{
+			cache.get( i );
+		}
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 40 );
+
+		cache.setMaxCost( 15 );
+		GAFFERTEST_ASSERT( cache.currentCost() <= 15 );
+		GAFFERTEST_ASSERTEQUAL(
+			cache.currentCost(),
+			(size_t)( references[0] + references[1] + ( references[0] ? 10 : 0 ) + ( references[1] ? 10 : 0 ) )
+		);
+
+		cache.clear();
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 0 );
+		GAFFERTEST_ASSERTEQUAL( references[0], 0 );
+		GAFFERTEST_ASSERTEQUAL( references[1], 0 );
+
+		// Items whose shared resources alone exceed the maximum cost
+		// are refused without being acquired, and without evicting
+		// anything else.
+
+		cache.setMaxCost( 100 );
+		cache.get( 0 );
+		cache.get( 1 );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 22 );
+
+		GAFFERTEST_ASSERT( !cache.set( -1, -1, 1 ) );
+		GAFFERTEST_ASSERT( !cache.cached( -1 ) );
+		GAFFERTEST_ASSERTEQUAL( cache.get( -2 ), -2 );
+		GAFFERTEST_ASSERT( !cache.cached( -2 ) );
+
+		GAFFERTEST_ASSERT( cache.cached( 0 ) );
+		GAFFERTEST_ASSERT( cache.cached( 1 ) );
+		GAFFERTEST_ASSERTEQUAL( cache.currentCost(), 22 );
+		GAFFERTEST_ASSERTEQUAL( references[0], 1 );
+		GAFFERTEST_ASSERTEQUAL( references[1], 1 );
+	}
+
+};
+
+void testLRUCacheSharedCost( const std::string &policy )
+{
+	DispatchTest<TestLRUCacheSharedCost>()( policy );
+}
+
 } // namespace
 
 void GafferTestModule::bindLRUCacheTest()
@@ -721,4 +841,5 @@ void GafferTestModule::bindLRUCacheTest()
 	def( "testLRUCacheCancellation", &testLRUCacheCancellation );
 	def( "testLRUCacheUncacheableItem", &testLRUCacheUncacheableItem );
 	def( "testLRUCacheGetIfCached", &testLRUCacheGetIfCached );
+	def( "testLRUCacheSharedCost", &testLRUCacheSharedCost );
 }